@@ -10,6 +10,7 @@
 
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/Internal/JobNotify.h>
+#include <AzCore/Task/TaskExecutor.h>
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
@@ -82,15 +83,38 @@ Job* WorkQueue::TryStealFront()
 AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_currentThreadInfo = nullptr;
 
 JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
-    : m_isAsynchronous(!desc.m_workerThreads.empty())
-    , m_workerThreads(AZStd::move(CreateWorkerThreads(desc.m_workerThreads)))
+    : m_isAsynchronous(!desc.m_workerThreads.empty() || desc.m_taskExecutor)
+    , m_taskExecutor(desc.m_taskExecutor)
+    , m_workerThreads(AZStd::move(CreateWorkerThreads(desc.m_taskExecutor ? JobManagerDesc::DescList{} : desc.m_workerThreads)))
 {
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
-    m_initSemaphore.release(static_cast<unsigned int>(desc.m_workerThreads.size()));
+    m_initSemaphore.release(static_cast<unsigned int>(m_workerThreads.size()));
+
+    if (m_taskExecutor)
+    {
+        //task executor workers are not job workers (they have no local queue), but get a stable thread info each so
+        //jobs can query their worker id
+        const AZ::u32 numTaskWorkers = m_taskExecutor->GetThreadCount();
+        m_taskWorkerThreads.reserve(numTaskWorkers);
+        for (AZ::u32 i = 0; i < numTaskWorkers; ++i)
+        {
+            ThreadInfo* info = aznew ThreadInfo;
+            info->m_owningManager = this;
+            info->m_workerId = i;
+            m_taskWorkerThreads.push_back(info);
+            m_threads.push_back(info);
+        }
+    }
 }
 
 JobManagerWorkStealing::~JobManagerWorkStealing()
 {
+    //job tasks queued on the task executor reference this manager, wait for them to drain
+    while (m_pendingJobTasks.load(AZStd::memory_order_acquire) > 0)
+    {
+        AZStd::this_thread::yield();
+    }
+
     //kill worker threads
     if (!m_workerThreads.empty())
     {
@@ -155,7 +179,21 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
     else
     {
         //current thread is not a worker thread, insert into the global queue based on the job's priority
-        if (IsAsynchronous())
+        if (m_taskExecutor)
+        {
+            {
+                AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+                const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
+                                                                                           m_globalJobQueue.end(),
+                                                                                           job->GetPriority(),
+                                                                                           CompareJobPriorities);
+                m_globalJobQueue.insert(locationToinsert, job);
+            }
+
+            //every queued job is paired with a task that will run the highest priority job available
+            SubmitJobTask();
+        }
+        else if (IsAsynchronous())
         {
             AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
             const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
@@ -284,6 +322,11 @@ Job* JobManagerWorkStealing::GetCurrentJob() const
     return info ? info->m_currentJob : nullptr;
 }
 
+AZ::u32 JobManagerWorkStealing::GetNumWorkerThreads() const
+{
+    return m_taskExecutor ? m_taskExecutor->GetThreadCount() : static_cast<AZ::u32>(m_workerThreads.size());
+}
+
 AZ::u32 JobManagerWorkStealing::GetWorkerThreadId() const
 {
     const ThreadInfo* info = m_currentThreadInfo;
@@ -293,9 +336,67 @@ AZ::u32 JobManagerWorkStealing::GetWorkerThreadId() const
         info = CrossModuleFindAndSetWorkerThreadInfo();
     }
 #endif
+    if (!info && m_taskExecutor)
+    {
+        const AZ::u32 taskWorkerIndex = m_taskExecutor->GetWorkerIndex();
+        return taskWorkerIndex == TaskExecutor::InvalidWorkerIndex ? JobManagerBase::InvalidWorkerThreadId : taskWorkerIndex;
+    }
     return info ? info->m_workerId : JobManagerBase::InvalidWorkerThreadId;
 }
 
+void JobManagerWorkStealing::SubmitJobTask()
+{
+    static const TaskDescriptor jobTaskDescriptor{ "AZ::Job", "JobManager" };
+
+    m_pendingJobTasks.fetch_add(1, AZStd::memory_order_acq_rel);
+    m_taskExecutor->Submit(
+        jobTaskDescriptor,
+        [this]
+        {
+            ProcessJobTask();
+            m_pendingJobTasks.fetch_sub(1, AZStd::memory_order_acq_rel);
+        });
+}
+
+void JobManagerWorkStealing::ProcessJobTask()
+{
+    Job* job = nullptr;
+    {
+        AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+        if (!m_globalJobQueue.empty())
+        {
+            job = m_globalJobQueue.front();
+            m_globalJobQueue.pop_front();
+        }
+    }
+
+    if (!job)
+    {
+        //the job paired with this task was already run by a thread assisting with job processing
+        return;
+    }
+
+    const AZ::u32 taskWorkerIndex = m_taskExecutor->GetWorkerIndex();
+    AZ_Assert(taskWorkerIndex < m_taskWorkerThreads.size(), "Job tasks must run on a worker of the job manager's task executor");
+    ThreadInfo* info = m_taskWorkerThreads[taskWorkerIndex];
+    info->m_threadId = AZStd::this_thread::get_id();
+
+    ThreadInfo* oldInfo = m_currentThreadInfo;
+    m_currentThreadInfo = info;
+
+    info->m_currentJob = job;
+    Process(job);
+    info->m_currentJob = nullptr;
+
+    //...after calling Process we cannot use the job pointer again, the job has completed and may not exist anymore
+#ifdef JOBMANAGER_ENABLE_STATS
+    ++info->m_globalJobs;
+    ++info->m_jobsDone;
+#endif
+
+    m_currentThreadInfo = oldInfo;
+}
+
 
 
 void JobManagerWorkStealing::ProcessJobsWorker(ThreadInfo* info)
@@ -24,6 +24,7 @@
 namespace AZ
 {
     class Job;
+    class TaskExecutor;
 
     namespace Internal
     {
@@ -76,7 +77,7 @@ namespace AZ
 
             Job* GetCurrentJob() const;
 
-            AZ::u32 GetNumWorkerThreads() const { return static_cast<AZ::u32>(m_workerThreads.size()); }
+            AZ::u32 GetNumWorkerThreads() const;
 
             AZ::u32 GetWorkerThreadId() const;
 
@@ -84,6 +85,10 @@ namespace AZ
 
             void ActivateWorker();
 
+            // Used when jobs are hosted on a TaskExecutor: queue a task that runs a single job from the global queue
+            void SubmitJobTask();
+            void ProcessJobTask();
+
             struct ThreadInfo
             {
                 AZ_CLASS_ALLOCATOR(ThreadInfo, ThreadPoolAllocator, 0)
@@ -124,6 +129,9 @@ namespace AZ
 
             bool m_isAsynchronous;
 
+            // If set, jobs run on the workers of this executor rather than on m_workerThreads (which will be empty)
+            TaskExecutor* m_taskExecutor = nullptr;
+
             ThreadList m_threads;
             mutable AZStd::mutex m_threadsMutex;
 
@@ -140,6 +148,9 @@ namespace AZ
             volatile bool               m_quitRequested = false;
             AZStd::atomic_uint          m_numAvailableWorkers{0};
 
+            ThreadList                  m_taskWorkerThreads; //thread info per task executor worker, indexed by worker index
+            AZStd::atomic_uint          m_pendingJobTasks{0};
+
             //thread-local pointer to the info for this thread. This is set for worker threads all the time,
             //and user threads only while they are processing jobs
             static AZ_THREAD_LOCAL ThreadInfo* m_currentThreadInfo;
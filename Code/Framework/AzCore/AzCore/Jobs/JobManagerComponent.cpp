@@ -15,6 +15,10 @@
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
 
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/Math/MathUtils.h>
 
@@ -29,6 +33,7 @@ namespace AZ
         , m_jobGlobalContext(nullptr)
         , m_numberOfWorkerThreads(0)
         , m_firstThreadCPU(-1)
+        , m_useTaskExecutor(false)
     {
     }
 
@@ -45,19 +50,28 @@ namespace AZ
         JobManagerDesc desc;
         JobManagerThreadDesc threadDesc;
 
-        int numberOfWorkerThreads = m_numberOfWorkerThreads;
-        if (numberOfWorkerThreads <= 0)
+        // The TaskGraphSystemComponent registers the TaskGraphActiveInterface when it creates the global executor
+        if (m_useTaskExecutor && Interface<TaskGraphActiveInterface>::Get())
         {
-            numberOfWorkerThreads = AZ::GetMin(static_cast<unsigned int>(desc.m_workerThreads.capacity()), AZStd::thread::hardware_concurrency());
-        #if (AZ_TRAIT_MAX_JOB_MANAGER_WORKER_THREADS)
-            numberOfWorkerThreads = AZ::GetMin(numberOfWorkerThreads, AZ_TRAIT_MAX_JOB_MANAGER_WORKER_THREADS);
-        #endif // (AZ_TRAIT_MAX_JOB_MANAGER_WORKER_THREADS)
+            // Share the task executor's workers rather than oversubscribing the cores with a second thread pool
+            desc.m_taskExecutor = &TaskExecutor::Instance();
         }
-
-        threadDesc.m_cpuId = AFFINITY_MASK_USERTHREADS;
-        for (int i = 0; i < numberOfWorkerThreads; ++i)
+        else
         {
-            desc.m_workerThreads.push_back(threadDesc);
+            int numberOfWorkerThreads = m_numberOfWorkerThreads;
+            if (numberOfWorkerThreads <= 0)
+            {
+                numberOfWorkerThreads = AZ::GetMin(static_cast<unsigned int>(desc.m_workerThreads.capacity()), AZStd::thread::hardware_concurrency());
+            #if (AZ_TRAIT_MAX_JOB_MANAGER_WORKER_THREADS)
+                numberOfWorkerThreads = AZ::GetMin(numberOfWorkerThreads, AZ_TRAIT_MAX_JOB_MANAGER_WORKER_THREADS);
+            #endif // (AZ_TRAIT_MAX_JOB_MANAGER_WORKER_THREADS)
+            }
+
+            threadDesc.m_cpuId = AFFINITY_MASK_USERTHREADS;
+            for (int i = 0; i < numberOfWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
         }
 
         m_jobManager = aznew JobManager(desc);
@@ -106,6 +120,7 @@ namespace AZ
     {
         dependent.push_back(AZ_CRC("MemoryService", 0x5c4d473c));
         dependent.push_back(AZ_CRC("ProfilerService", 0x505033c9));
+        dependent.push_back(AZ_CRC_CE("TaskExecutorService"));
     }
 
     //=========================================================================
@@ -119,6 +134,7 @@ namespace AZ
                 ->Version(1)
                 ->Field("NumberOfWorkerThreads", &JobManagerComponent::m_numberOfWorkerThreads)
                 ->Field("FirstThreadCPUID", &JobManagerComponent::m_firstThreadCPU)
+                ->Field("UseTaskExecutor", &JobManagerComponent::m_useTaskExecutor)
                 ;
 
             if (EditContext* editContext = serializeContext->GetEditContext())
@@ -134,6 +150,7 @@ namespace AZ
                     ->DataElement(AZ::Edit::UIHandlers::SpinBox, &JobManagerComponent::m_firstThreadCPU, "CPU ID", "First CPU ID for a worker thread, each consecutive thread will use the next CPU ID. -1 Will not assign CPU Ids")
                         ->Attribute(AZ::Edit::Attributes::Min, -1)
                         ->Attribute(AZ::Edit::Attributes::Max, 16)
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &JobManagerComponent::m_useTaskExecutor, "Use task executor", "Run jobs on the task graph worker threads instead of creating dedicated job worker threads")
                     ;
             }
         }
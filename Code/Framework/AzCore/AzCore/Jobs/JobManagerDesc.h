@@ -12,6 +12,8 @@
 
 namespace AZ
 {
+    class TaskExecutor;
+
     /**
      * Descriptor for a single job manager thread, an array of these is specified in JobManagerDesc.
      */
@@ -53,5 +55,12 @@ namespace AZ
 
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
+
+        /**
+         * When set, jobs are run by the worker threads of this TaskExecutor instead of dedicated job threads, so
+         * both systems share a single thread pool. m_workerThreads is ignored in this case.
+         * The executor must outlive the job manager.
+         */
+        TaskExecutor* m_taskExecutor = nullptr;
     };
 }
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
+
+namespace AZ
+{
+    namespace ShapeIntersection
+    {
+        namespace
+        {
+            // Packs the lanes of a comparison result into the low four bits of an integer, lane N maps to bit N
+            uint32_t MaskToBits(Simd::Vec4::FloatArgType mask)
+            {
+                alignas(16) int32_t lanes[4];
+                Simd::Vec4::StoreAligned(lanes, Simd::Vec4::CastToInt(mask));
+                return (lanes[0] & 0x1) | (lanes[1] & 0x2) | (lanes[2] & 0x4) | (lanes[3] & 0x8);
+            }
+
+            // Runs simdTest on groups of four bounding volumes, and scalarTest on any remaining volumes
+            template <typename SimdTest, typename ScalarTest>
+            void RunBatch(size_t count, uint32_t* outMask, const SimdTest& simdTest, const ScalarTest& scalarTest)
+            {
+                const size_t maskSize = GetBatchMaskSize(count);
+                for (size_t word = 0; word < maskSize; ++word)
+                {
+                    outMask[word] = 0;
+                }
+
+                // Groups of four never straddle a mask word, since 32 is a multiple of 4
+                const size_t simdCount = count & ~static_cast<size_t>(3);
+                size_t index = 0;
+                for (; index < simdCount; index += 4)
+                {
+                    outMask[index / 32] |= MaskToBits(simdTest(index)) << (index % 32);
+                }
+
+                for (; index < count; ++index)
+                {
+                    outMask[index / 32] |= static_cast<uint32_t>(scalarTest(index)) << (index % 32);
+                }
+            }
+
+            Aabb GetAabb(const AabbBatch& aabbs, size_t index)
+            {
+                return Aabb::CreateFromMinMax(
+                    Vector3(aabbs.m_minX[index], aabbs.m_minY[index], aabbs.m_minZ[index]),
+                    Vector3(aabbs.m_maxX[index], aabbs.m_maxY[index], aabbs.m_maxZ[index]));
+            }
+
+            // Frustum planes splatted across all lanes, so they only need to be loaded once per batch
+            struct BatchPlanes
+            {
+                explicit BatchPlanes(const Frustum& frustum)
+                {
+                    for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                    {
+                        const Plane plane = frustum.GetPlane(planeId);
+                        const Vector3 normal = plane.GetNormal();
+                        const Vector3 absNormal = normal.GetAbs();
+                        m_normalX[planeId] = Simd::Vec4::Splat(normal.GetX());
+                        m_normalY[planeId] = Simd::Vec4::Splat(normal.GetY());
+                        m_normalZ[planeId] = Simd::Vec4::Splat(normal.GetZ());
+                        m_absNormalX[planeId] = Simd::Vec4::Splat(absNormal.GetX());
+                        m_absNormalY[planeId] = Simd::Vec4::Splat(absNormal.GetY());
+                        m_absNormalZ[planeId] = Simd::Vec4::Splat(absNormal.GetZ());
+                        m_distance[planeId] = Simd::Vec4::Splat(plane.GetDistance());
+                    }
+                }
+
+                Simd::Vec4::FloatType GetPointDist(
+                    Frustum::PlaneId planeId, Simd::Vec4::FloatArgType x, Simd::Vec4::FloatArgType y, Simd::Vec4::FloatArgType z) const
+                {
+                    return Simd::Vec4::Madd(m_normalX[planeId], x,
+                        Simd::Vec4::Madd(m_normalY[planeId], y,
+                            Simd::Vec4::Madd(m_normalZ[planeId], z, m_distance[planeId])));
+                }
+
+                Simd::Vec4::FloatType m_normalX[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_normalY[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_normalZ[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_absNormalX[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_absNormalY[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_absNormalZ[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_distance[Frustum::PlaneId::MAX];
+            };
+        }
+
+
+        void OverlapsBatch(const Aabb& aabb, const AabbBatch& aabbs, uint32_t* outMask)
+        {
+            const Simd::Vec4::FloatType queryMinX = Simd::Vec4::Splat(aabb.GetMin().GetX());
+            const Simd::Vec4::FloatType queryMinY = Simd::Vec4::Splat(aabb.GetMin().GetY());
+            const Simd::Vec4::FloatType queryMinZ = Simd::Vec4::Splat(aabb.GetMin().GetZ());
+            const Simd::Vec4::FloatType queryMaxX = Simd::Vec4::Splat(aabb.GetMax().GetX());
+            const Simd::Vec4::FloatType queryMaxY = Simd::Vec4::Splat(aabb.GetMax().GetY());
+            const Simd::Vec4::FloatType queryMaxZ = Simd::Vec4::Splat(aabb.GetMax().GetZ());
+
+            RunBatch(aabbs.m_count, outMask,
+                [&](size_t index)
+                {
+                    const Simd::Vec4::FloatType overlapsX = Simd::Vec4::And(
+                        Simd::Vec4::CmpLtEq(queryMinX, Simd::Vec4::LoadUnaligned(&aabbs.m_maxX[index])),
+                        Simd::Vec4::CmpGtEq(queryMaxX, Simd::Vec4::LoadUnaligned(&aabbs.m_minX[index])));
+                    const Simd::Vec4::FloatType overlapsY = Simd::Vec4::And(
+                        Simd::Vec4::CmpLtEq(queryMinY, Simd::Vec4::LoadUnaligned(&aabbs.m_maxY[index])),
+                        Simd::Vec4::CmpGtEq(queryMaxY, Simd::Vec4::LoadUnaligned(&aabbs.m_minY[index])));
+                    const Simd::Vec4::FloatType overlapsZ = Simd::Vec4::And(
+                        Simd::Vec4::CmpLtEq(queryMinZ, Simd::Vec4::LoadUnaligned(&aabbs.m_maxZ[index])),
+                        Simd::Vec4::CmpGtEq(queryMaxZ, Simd::Vec4::LoadUnaligned(&aabbs.m_minZ[index])));
+                    return Simd::Vec4::And(overlapsX, Simd::Vec4::And(overlapsY, overlapsZ));
+                },
+                [&](size_t index)
+                {
+                    return Overlaps(aabb, GetAabb(aabbs, index));
+                });
+        }
+
+
+        void OverlapsBatch(const Sphere& sphere, const AabbBatch& aabbs, uint32_t* outMask)
+        {
+            const Simd::Vec4::FloatType centerX = Simd::Vec4::Splat(sphere.GetCenter().GetX());
+            const Simd::Vec4::FloatType centerY = Simd::Vec4::Splat(sphere.GetCenter().GetY());
+            const Simd::Vec4::FloatType centerZ = Simd::Vec4::Splat(sphere.GetCenter().GetZ());
+            const Simd::Vec4::FloatType radiusSq = Simd::Vec4::Splat(sphere.GetRadius() * sphere.GetRadius());
+
+            RunBatch(aabbs.m_count, outMask,
+                [&](size_t index)
+                {
+                    // Distance from the sphere center to the closest point within each aabb
+                    const Simd::Vec4::FloatType deltaX = Simd::Vec4::Sub(centerX, Simd::Vec4::Clamp(centerX,
+                        Simd::Vec4::LoadUnaligned(&aabbs.m_minX[index]), Simd::Vec4::LoadUnaligned(&aabbs.m_maxX[index])));
+                    const Simd::Vec4::FloatType deltaY = Simd::Vec4::Sub(centerY, Simd::Vec4::Clamp(centerY,
+                        Simd::Vec4::LoadUnaligned(&aabbs.m_minY[index]), Simd::Vec4::LoadUnaligned(&aabbs.m_maxY[index])));
+                    const Simd::Vec4::FloatType deltaZ = Simd::Vec4::Sub(centerZ, Simd::Vec4::Clamp(centerZ,
+                        Simd::Vec4::LoadUnaligned(&aabbs.m_minZ[index]), Simd::Vec4::LoadUnaligned(&aabbs.m_maxZ[index])));
+                    const Simd::Vec4::FloatType distSq = Simd::Vec4::Madd(deltaX, deltaX,
+                        Simd::Vec4::Madd(deltaY, deltaY, Simd::Vec4::Mul(deltaZ, deltaZ)));
+                    return Simd::Vec4::CmpLtEq(distSq, radiusSq);
+                },
+                [&](size_t index)
+                {
+                    return Overlaps(sphere, GetAabb(aabbs, index));
+                });
+        }
+
+
+        void OverlapsBatch(const Frustum& frustum, const AabbBatch& aabbs, uint32_t* outMask)
+        {
+            const BatchPlanes planes(frustum);
+            const Simd::Vec4::FloatType half = Simd::Vec4::Splat(0.5f);
+            const Simd::Vec4::FloatType zero = Simd::Vec4::ZeroFloat();
+
+            RunBatch(aabbs.m_count, outMask,
+                [&](size_t index)
+                {
+                    // Scale before adding or subtracting, so aabbs with extremely large bounds don't overflow
+                    const Simd::Vec4::FloatType halfMinX = Simd::Vec4::Mul(half, Simd::Vec4::LoadUnaligned(&aabbs.m_minX[index]));
+                    const Simd::Vec4::FloatType halfMinY = Simd::Vec4::Mul(half, Simd::Vec4::LoadUnaligned(&aabbs.m_minY[index]));
+                    const Simd::Vec4::FloatType halfMinZ = Simd::Vec4::Mul(half, Simd::Vec4::LoadUnaligned(&aabbs.m_minZ[index]));
+                    const Simd::Vec4::FloatType halfMaxX = Simd::Vec4::Mul(half, Simd::Vec4::LoadUnaligned(&aabbs.m_maxX[index]));
+                    const Simd::Vec4::FloatType halfMaxY = Simd::Vec4::Mul(half, Simd::Vec4::LoadUnaligned(&aabbs.m_maxY[index]));
+                    const Simd::Vec4::FloatType halfMaxZ = Simd::Vec4::Mul(half, Simd::Vec4::LoadUnaligned(&aabbs.m_maxZ[index]));
+                    const Simd::Vec4::FloatType centerX = Simd::Vec4::Add(halfMaxX, halfMinX);
+                    const Simd::Vec4::FloatType centerY = Simd::Vec4::Add(halfMaxY, halfMinY);
+                    const Simd::Vec4::FloatType centerZ = Simd::Vec4::Add(halfMaxZ, halfMinZ);
+                    const Simd::Vec4::FloatType extentsX = Simd::Vec4::Sub(halfMaxX, halfMinX);
+                    const Simd::Vec4::FloatType extentsY = Simd::Vec4::Sub(halfMaxY, halfMinY);
+                    const Simd::Vec4::FloatType extentsZ = Simd::Vec4::Sub(halfMaxZ, halfMinZ);
+
+                    // An aabb is not overlapping if it is fully behind any of the planes
+                    Simd::Vec4::FloatType outside = zero;
+                    for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                    {
+                        const Simd::Vec4::FloatType distance = planes.GetPointDist(planeId, centerX, centerY, centerZ);
+                        const Simd::Vec4::FloatType radius = Simd::Vec4::Madd(planes.m_absNormalX[planeId], extentsX,
+                            Simd::Vec4::Madd(planes.m_absNormalY[planeId], extentsY, Simd::Vec4::Mul(planes.m_absNormalZ[planeId], extentsZ)));
+                        outside = Simd::Vec4::Or(outside, Simd::Vec4::CmpLtEq(Simd::Vec4::Add(distance, radius), zero));
+                    }
+                    return Simd::Vec4::Not(outside);
+                },
+                [&](size_t index)
+                {
+                    return Overlaps(frustum, GetAabb(aabbs, index));
+                });
+        }
+
+
+        void OverlapsBatch(const Frustum& frustum, const SphereBatch& spheres, uint32_t* outMask)
+        {
+            const BatchPlanes planes(frustum);
+            const Simd::Vec4::FloatType zero = Simd::Vec4::ZeroFloat();
+
+            RunBatch(spheres.m_count, outMask,
+                [&](size_t index)
+                {
+                    const Simd::Vec4::FloatType centerX = Simd::Vec4::LoadUnaligned(&spheres.m_centerX[index]);
+                    const Simd::Vec4::FloatType centerY = Simd::Vec4::LoadUnaligned(&spheres.m_centerY[index]);
+                    const Simd::Vec4::FloatType centerZ = Simd::Vec4::LoadUnaligned(&spheres.m_centerZ[index]);
+                    const Simd::Vec4::FloatType radius = Simd::Vec4::LoadUnaligned(&spheres.m_radius[index]);
+
+                    // A sphere is not overlapping if it is fully behind any of the planes
+                    Simd::Vec4::FloatType outside = zero;
+                    for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                    {
+                        const Simd::Vec4::FloatType distance = planes.GetPointDist(planeId, centerX, centerY, centerZ);
+                        outside = Simd::Vec4::Or(outside, Simd::Vec4::CmpLt(Simd::Vec4::Add(distance, radius), zero));
+                    }
+                    return Simd::Vec4::Not(outside);
+                },
+                [&](size_t index)
+                {
+                    const Sphere sphere(Vector3(spheres.m_centerX[index], spheres.m_centerY[index], spheres.m_centerZ[index]), spheres.m_radius[index]);
+                    return Overlaps(frustum, sphere);
+                });
+        }
+    }
+}
@@ -51,6 +51,44 @@ namespace AZ
         bool Contains(const Frustum& frustum,  const Sphere& sphere);
         bool Contains(const Frustum& frustum,  const Vector3& point);
         //! @}
+
+        //! A set of axis aligned bounding boxes stored as separate arrays of components, for batch intersection tests.
+        struct AabbBatch
+        {
+            const float* m_minX = nullptr;
+            const float* m_minY = nullptr;
+            const float* m_minZ = nullptr;
+            const float* m_maxX = nullptr;
+            const float* m_maxY = nullptr;
+            const float* m_maxZ = nullptr;
+            size_t m_count = 0;
+        };
+
+        //! A set of spheres stored as separate arrays of components, for batch intersection tests.
+        struct SphereBatch
+        {
+            const float* m_centerX = nullptr;
+            const float* m_centerY = nullptr;
+            const float* m_centerZ = nullptr;
+            const float* m_radius = nullptr;
+            size_t m_count = 0;
+        };
+
+        //! Returns the number of 32-bit words required to hold the overlap mask for a batch of count bounding volumes.
+        constexpr size_t GetBatchMaskSize(size_t count)
+        {
+            return (count + 31) / 32;
+        }
+
+        //! Tests to see if Arg1 overlaps each bounding volume in the batch Arg2.
+        //! Bit N of outMask is set if the Nth bounding volume overlaps Arg1, with the same result as the corresponding Overlaps test above.
+        //! outMask must hold at least GetBatchMaskSize(batch.m_count) words, all of which are written.
+        //! @{
+        void OverlapsBatch(const Aabb& aabb, const AabbBatch& aabbs, uint32_t* outMask);
+        void OverlapsBatch(const Sphere& sphere, const AabbBatch& aabbs, uint32_t* outMask);
+        void OverlapsBatch(const Frustum& frustum, const AabbBatch& aabbs, uint32_t* outMask);
+        void OverlapsBatch(const Frustum& frustum, const SphereBatch& spheres, uint32_t* outMask);
+        //! @}
     }
 }
 
@@ -34,6 +34,19 @@ namespace AZ
             ++m_useCount;
         }
 
+        bool NameData::TryAddRef()
+        {
+            int useCount = m_useCount.load();
+            while (useCount >= 0)
+            {
+                if (m_useCount.compare_exchange_weak(useCount, useCount + 1))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         void NameData::release()
         {
             // this could be released after we decrement the counter, therefore we will
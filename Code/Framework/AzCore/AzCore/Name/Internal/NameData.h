@@ -40,6 +40,10 @@ namespace AZ
             void add_ref();
             void release();
 
+            // Adds a reference unless the entry is already being removed from the dictionary.
+            // This is used when the entry was found without holding the dictionary lock.
+            bool TryAddRef();
+
             template <typename T>
             friend struct AZStd::IntrusivePtrCountPolicy;
 
@@ -10,7 +10,7 @@
 #include <AzCore/Name/Internal/NameData.h>
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
-#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
 #include <cstring>
@@ -76,18 +76,97 @@ namespace AZ
         return *(*s_instance);
     }
     
+    namespace NameDictionaryInternal
+    {
+        static constexpr size_t InitialTableCapacity = 1024;
+
+        // Small direct-mapped cache of recently used entries, so repeatedly used names don't need to probe the table.
+        // Cached entries are only valid while the dictionary generation they were stored with is current.
+        struct ThreadCacheEntry
+        {
+            const NameDictionary* m_dictionary;
+            uint64_t m_generation;
+            Name::Hash m_hash;
+            Internal::NameData* m_nameData;
+        };
+        static constexpr size_t ThreadCacheSize = 64;
+        static AZ_THREAD_LOCAL ThreadCacheEntry s_threadCache[ThreadCacheSize];
+
+        // Index + 1 of the reader stripe assigned to the current thread, or 0 if none was assigned yet.
+        static AZ_THREAD_LOCAL uint32_t s_readerStripe;
+        static AZStd::atomic<uint32_t> s_nextReaderStripe{ 0 };
+
+        // Each dictionary instance starts its generation in a separate range, so caches filled by a
+        // previous dictionary can't be mistaken for valid entries of a new one at the same address.
+        static AZStd::atomic<uint64_t> s_nextGenerationRange{ 0 };
+    }
+
+    NameDictionary::EntryTable::EntryTable(size_t capacity)
+        : m_capacity(capacity)
+    {
+        AZ_Assert((capacity & (capacity - 1)) == 0, "EntryTable capacity must be a power of two");
+        using SlotType = AZStd::atomic<Internal::NameData*>;
+        m_slots = reinterpret_cast<SlotType*>(azmalloc(sizeof(SlotType) * capacity, alignof(SlotType), AZ::OSAllocator));
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            new (&m_slots[i]) SlotType(nullptr);
+        }
+    }
+
+    NameDictionary::EntryTable::~EntryTable()
+    {
+        azfree(m_slots, AZ::OSAllocator);
+    }
+
+    class NameDictionary::ReadGuard
+    {
+    public:
+        explicit ReadGuard(const NameDictionary& dictionary)
+            : m_dictionary(dictionary)
+        {
+            using namespace NameDictionaryInternal;
+
+            if (s_readerStripe == 0)
+            {
+                s_readerStripe = (s_nextReaderStripe++ % ReaderStripeCount) + 1;
+            }
+            m_stripe = s_readerStripe - 1;
+            m_epoch = dictionary.m_epoch.load();
+            dictionary.m_readers[m_epoch][m_stripe].m_count.fetch_add(1);
+        }
+
+        ~ReadGuard()
+        {
+            m_dictionary.m_readers[m_epoch][m_stripe].m_count.fetch_sub(1);
+        }
+
+    private:
+        const NameDictionary& m_dictionary;
+        uint32_t m_epoch = 0;
+        uint32_t m_stripe = 0;
+    };
+
     NameDictionary::NameDictionary()
-    {}
+        : m_generation(NameDictionaryInternal::s_nextGenerationRange.fetch_add(uint64_t{ 1 } << 32))
+    {
+        m_table = aznew EntryTable(NameDictionaryInternal::InitialTableCapacity);
+    }
 
     NameDictionary::~NameDictionary()
     {
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        EntryTable* table = m_table.load();
+        for (size_t i = 0; i < table->m_capacity; ++i)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
+            Internal::NameData* nameData = table->m_slots[i].load();
+            if (!EntryTable::IsLiveEntry(nameData))
+            {
+                continue;
+            }
+
+            const int useCount = nameData->m_useCount;
+            [[maybe_unused]] const bool hadCollision = nameData->m_hashCollision;
 
             if (useCount == 0)
             {
@@ -98,20 +177,22 @@ namespace AZ
             else
             {
                 leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, nameData->GetHash(), AZ_STRING_ARG(nameData->GetName()));
             }
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
+
+        FreeRetiredEntries(0);
+        FreeRetiredEntries(1);
+        delete table;
     }
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        if (Internal::NameData* nameData = AcquireEntry(hash, {}))
         {
-            return Name(iter->second);
+            return AdoptEntry(nameData);
         }
         return Name();
     }
@@ -127,41 +208,45 @@ namespace AZ
         Name::Hash hash = CalcHash(nameString);
 
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+        // This path is faster than the loop below because AcquireEntry() doesn't take any locks whereas the
+        // loop requires m_mutex to modify the dictionary.
+        if (Internal::NameData* nameData = AcquireEntry(hash, nameString))
         {
-            return AZStd::move(name);
+            return AdoptEntry(nameData);
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
 
-        auto iter = m_dictionary.find(hash);
         bool collisionDetected = false;
         while (true)
         {
+            const EntryTable& table = *m_table.load();
+            const size_t slot = FindSlot(table, hash);
+
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (slot == EntryTable::InvalidSlot)
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                InsertEntry(nameData);
                 return Name(nameData);
             }
+
+            // Entries are only removed while m_mutex is held, so the entry is guaranteed to be alive here.
+            Internal::NameData* nameData = table.m_slots[slot].load();
+
             // Found the desired entry, return it
-            else if (iter->second->GetName() == nameString)
+            if (nameData->GetName() == nameString)
             {
-                return Name(iter->second);
+                return Name(nameData);
             }
             // Hash collision, try a new hash
             else
             {
                 collisionDetected = true;
-                iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
+                nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
     }
@@ -180,10 +265,11 @@ namespace AZ
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
 
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
+        EntryTable& table = *m_table.load();
+        const size_t slot = FindSlot(table, hash);
+        if (slot == EntryTable::InvalidSlot)
         {
             // This check is to safeguard around the following scenario
             // T1, gets into TryReleaseName
@@ -194,9 +280,9 @@ namespace AZ
             return;
         }
 
-        Internal::NameData* nameData = dictIt->second;
+        Internal::NameData* nameData = table.m_slots[slot].load();
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
+        // Check m_hashCollision inside m_mutex because a new collision could have happened
         // on another thread before taking the lock.
         if (nameData->m_hashCollision)
         {
@@ -206,17 +292,200 @@ namespace AZ
         // We need to check the count again in here in case
         // someone was trying to get the name on another thread.
         // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
+        // dictionary and delete the name. Lock-free lookups will also
+        // refuse to take a reference to the name from here on.
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            table.m_slots[slot].store(EntryTable::TombstoneEntry());
+            --m_entryCount;
+            ++m_tombstoneCount;
+
+            // The generation has to change after the entry is unlinked. Any thread that still sees the
+            // old generation is guaranteed to have started reading before the entry was removed.
+            ++m_generation;
+
+            // Other threads may still be reading the entry, so it can't be deleted right away.
+            m_retiredEntries[m_epoch.load()].push_back(nameData);
+            ReclaimRetiredEntries();
         }
 
         ReportStats();
     }
 
+    Internal::NameData* NameDictionary::AcquireEntry(Name::Hash hash, AZStd::string_view nameString) const
+    {
+        using namespace NameDictionaryInternal;
+
+        ReadGuard guard(*this);
+
+        const uint64_t generation = m_generation.load();
+        ThreadCacheEntry& cacheEntry = s_threadCache[hash % ThreadCacheSize];
+
+        Internal::NameData* nameData = nullptr;
+        if (cacheEntry.m_dictionary == this && cacheEntry.m_generation == generation && cacheEntry.m_hash == hash)
+        {
+            nameData = cacheEntry.m_nameData;
+        }
+        else
+        {
+            const EntryTable& table = *m_table.load();
+            const size_t slot = FindSlot(table, hash);
+            if (slot == EntryTable::InvalidSlot)
+            {
+                return nullptr;
+            }
+
+            nameData = table.m_slots[slot].load();
+            cacheEntry = ThreadCacheEntry{ this, generation, hash, nameData };
+        }
+
+        // On a hash collision the caller has to fall back to the locked path to resolve the final hash.
+        if (!nameString.empty() && nameData->GetName() != nameString)
+        {
+            return nullptr;
+        }
+
+        return nameData->TryAddRef() ? nameData : nullptr;
+    }
+
+    Name NameDictionary::AdoptEntry(Internal::NameData* nameData)
+    {
+        Name name(nameData);
+        // The Name now holds its own reference, so the one taken by AcquireEntry can be dropped. This can't
+        // bring the count to zero so there's no need to go through release().
+        --nameData->m_useCount;
+        return name;
+    }
+
+    size_t NameDictionary::FindSlot(const EntryTable& table, Name::Hash hash)
+    {
+        const size_t mask = table.m_capacity - 1;
+        size_t slot = hash & mask;
+        for (size_t probeCount = 0; probeCount < table.m_capacity; ++probeCount)
+        {
+            const Internal::NameData* nameData = table.m_slots[slot].load(AZStd::memory_order_acquire);
+            if (nameData == nullptr)
+            {
+                break;
+            }
+            if (nameData != EntryTable::TombstoneEntry() && nameData->GetHash() == hash)
+            {
+                return slot;
+            }
+            slot = (slot + 1) & mask;
+        }
+        return EntryTable::InvalidSlot;
+    }
+
+    void NameDictionary::InsertEntry(Internal::NameData* nameData)
+    {
+        EntryTable* table = m_table.load();
+
+        // Keep the table at most half full, counting removed slots, so probe sequences stay short.
+        if ((m_entryCount + m_tombstoneCount + 1) * 2 > table->m_capacity)
+        {
+            table = RebuildTable();
+        }
+
+        const size_t mask = table->m_capacity - 1;
+        size_t slot = nameData->GetHash() & mask;
+        while (EntryTable::IsLiveEntry(table->m_slots[slot].load()))
+        {
+            slot = (slot + 1) & mask;
+        }
+
+        if (table->m_slots[slot].load() == EntryTable::TombstoneEntry())
+        {
+            --m_tombstoneCount;
+        }
+        table->m_slots[slot].store(nameData, AZStd::memory_order_release);
+        ++m_entryCount;
+    }
+
+    NameDictionary::EntryTable* NameDictionary::RebuildTable()
+    {
+        EntryTable* oldTable = m_table.load();
+
+        // Grow if the table is getting full, otherwise rebuilding at the same size is enough to clear out removed slots.
+        size_t capacity = oldTable->m_capacity;
+        if ((m_entryCount + 1) * 4 > capacity)
+        {
+            capacity *= 2;
+        }
+
+        EntryTable* newTable = aznew EntryTable(capacity);
+        const size_t mask = capacity - 1;
+        for (size_t i = 0; i < oldTable->m_capacity; ++i)
+        {
+            Internal::NameData* nameData = oldTable->m_slots[i].load();
+            if (EntryTable::IsLiveEntry(nameData))
+            {
+                size_t slot = nameData->GetHash() & mask;
+                while (newTable->m_slots[slot].load() != nullptr)
+                {
+                    slot = (slot + 1) & mask;
+                }
+                newTable->m_slots[slot].store(nameData);
+            }
+        }
+        m_tombstoneCount = 0;
+
+        m_table.store(newTable);
+        m_retiredTables[m_epoch.load()].push_back(oldTable);
+        ReclaimRetiredEntries();
+
+        return newTable;
+    }
+
+    void NameDictionary::ReclaimRetiredEntries()
+    {
+        // Everything in the previous epoch's lists was removed before the epoch advanced, so once no reader is
+        // registered in the previous epoch, nothing can reference those entries anymore. Readers that picked up
+        // the previous epoch but haven't registered yet will only see the table as it is now.
+        const uint32_t currentEpoch = m_epoch.load();
+        const uint32_t previousEpoch = currentEpoch ^ 1;
+        if (HasActiveReaders(previousEpoch))
+        {
+            return;
+        }
+
+        FreeRetiredEntries(previousEpoch);
+
+        // Advance the epoch so the entries retired in the current one can be freed once its readers have left.
+        if (!m_retiredEntries[currentEpoch].empty() || !m_retiredTables[currentEpoch].empty())
+        {
+            m_epoch.store(previousEpoch);
+        }
+    }
+
+    bool NameDictionary::HasActiveReaders(uint32_t epoch) const
+    {
+        for (const ReaderStripe& stripe : m_readers[epoch])
+        {
+            if (stripe.m_count.load() != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void NameDictionary::FreeRetiredEntries(uint32_t epoch)
+    {
+        for (Internal::NameData* nameData : m_retiredEntries[epoch])
+        {
+            delete nameData;
+        }
+        m_retiredEntries[epoch].clear();
+
+        for (EntryTable* table : m_retiredTables[epoch])
+        {
+            delete table;
+        }
+        m_retiredTables[epoch].clear();
+    }
+
     void NameDictionary::ReportStats() const
     {
 #ifdef AZ_DEBUG_BUILD
@@ -232,34 +501,41 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            const EntryTable& table = *m_table.load();
+            for (size_t i = 0; i < table.m_capacity; ++i)
             {
-                const size_t nameLength = iter.second->m_name.size();
+                Internal::NameData* nameData = table.m_slots[i].load();
+                if (!EntryTable::IsLiveEntry(nameData))
+                {
+                    continue;
+                }
+
+                const size_t nameLength = nameData->m_name.size();
                 actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
                 if (!longestName || longestName->m_name.size() < nameLength)
                 {
-                    longestName = iter.second;
+                    longestName = nameData;
                 }
 
                 if (!mostRepeatedName)
                 {
-                    mostRepeatedName = iter.second;
+                    mostRepeatedName = nameData;
                 }
                 else
                 {
                     const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
                     if (currentIndividualSavings > mostIndividualSavings)
                     {
-                        mostRepeatedName = iter.second;
+                        mostRepeatedName = nameData;
                     }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_entryCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -8,10 +8,11 @@
 
 #pragma once
 
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -43,6 +44,11 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! Entries are stored in an open-addressed hash table that can be searched without locking, so
+    //! looking up names that already exist never blocks, even while other threads are adding or
+    //! removing names. Entries that are removed from the table are only deleted once no thread can
+    //! still be reading them.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -73,6 +79,46 @@ namespace AZ
         Name FindName(Name::Hash hash) const;
 
     private:
+        // Open-addressed hash table of dictionary entries, keyed by Name::Hash with linear probing.
+        // Slots can be read without holding m_mutex, but are only modified while it is held.
+        struct EntryTable
+        {
+            AZ_CLASS_ALLOCATOR(EntryTable, AZ::OSAllocator, 0);
+
+            static constexpr size_t InvalidSlot = static_cast<size_t>(-1);
+
+            explicit EntryTable(size_t capacity);
+            ~EntryTable();
+
+            // Marks a slot whose entry was removed. Lookups have to probe past these slots.
+            static Internal::NameData* TombstoneEntry()
+            {
+                return reinterpret_cast<Internal::NameData*>(uintptr_t{ 1 });
+            }
+
+            static bool IsLiveEntry(const Internal::NameData* nameData)
+            {
+                return nameData != nullptr && nameData != TombstoneEntry();
+            }
+
+            AZStd::atomic<Internal::NameData*>* m_slots = nullptr;
+            size_t m_capacity = 0; // Always a power of two.
+        };
+
+        // Registers the calling thread as a reader of the current epoch for the lifetime of the guard.
+        // Entries and tables that are retired while a reader is registered are kept alive until it leaves.
+        class ReadGuard;
+
+        static constexpr uint32_t ReaderStripeCount = 16;
+        static constexpr size_t CacheLineSize = 64;
+
+        // Reader counts are spread over several cache lines to avoid contention between threads.
+        struct ReaderStripe
+        {
+            AZStd::atomic<uint32_t> m_count{ 0 };
+            char m_padding[CacheLineSize - sizeof(AZStd::atomic<uint32_t>)];
+        };
+
         NameDictionary();
         ~NameDictionary();
 
@@ -90,8 +136,39 @@ namespace AZ
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
-                
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+
+        // Looks up the entry for the hash without locking and takes a reference to it. If nameString is
+        // not empty, the entry is only returned if its name matches. Returns null if no live entry was found.
+        Internal::NameData* AcquireEntry(Name::Hash hash, AZStd::string_view nameString) const;
+
+        // Wraps an entry returned by AcquireEntry in a Name, taking over the reference that was acquired.
+        static Name AdoptEntry(Internal::NameData* nameData);
+
+        // Returns the slot index holding the entry for the hash, or EntryTable::InvalidSlot.
+        // Requires either m_mutex to be held or an active ReadGuard.
+        static size_t FindSlot(const EntryTable& table, Name::Hash hash);
+
+        // The following functions require m_mutex to be held.
+        void InsertEntry(Internal::NameData* nameData);
+        EntryTable* RebuildTable();
+        void ReclaimRetiredEntries();
+        bool HasActiveReaders(uint32_t epoch) const;
+        void FreeRetiredEntries(uint32_t epoch);
+
+        AZStd::atomic<EntryTable*> m_table{ nullptr };
+        size_t m_entryCount = 0;
+        size_t m_tombstoneCount = 0;
+
+        // Bumped whenever an entry is removed from the table, which invalidates the per-thread entry caches.
+        AZStd::atomic<uint64_t> m_generation{ 0 };
+
+        // Removed entries and replaced tables are retired into the list for the epoch they were removed in,
+        // and deleted once every reader that could have seen them has left.
+        AZStd::atomic<uint32_t> m_epoch{ 0 };
+        mutable ReaderStripe m_readers[2][ReaderStripeCount];
+        AZStd::vector<Internal::NameData*, AZ::OSStdAllocator> m_retiredEntries[2];
+        AZStd::vector<EntryTable*, AZ::OSStdAllocator> m_retiredTables[2];
+
+        AZStd::mutex m_mutex;
     };
 }
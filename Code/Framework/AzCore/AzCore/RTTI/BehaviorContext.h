@@ -303,6 +303,10 @@ namespace AZ
         virtual void SetDefaultValue(size_t index, BehaviorDefaultValuePtr defaultValue) = 0;
         virtual BehaviorDefaultValuePtr GetDefaultValue(size_t index) const = 0;
         virtual const BehaviorParameter* GetResult() const = 0;
+        /// Returns the address of the stored native function pointer, or nullptr if the method isn't backed by one.
+        /// The pointed to type is R(*)(Args...) for global methods and R(C::*)(Args...) for member methods (const member
+        /// functions are stored without the const qualifier), callers must match the signature through the parameters first.
+        virtual const void* GetFunctionPointerAddress() const { return nullptr; }
 
         bool AddOverload(BehaviorMethod* method);
         bool IsAnOverload(BehaviorMethod* candidate) const;
@@ -544,6 +548,8 @@ namespace AZ
 
             void OverrideParameterTraits(size_t index, AZ::u32 addTraits, AZ::u32 removeTraits) override;
 
+            const void* GetFunctionPointerAddress() const override { return &m_functionPtr; }
+
             FunctionPointer m_functionPtr;
 
             BehaviorParameter m_parameters[sizeof...(Args)+s_startNamedArgumentIndex];
@@ -601,6 +607,8 @@ namespace AZ
 
             void OverrideParameterTraits(size_t index, AZ::u32 addTraits, AZ::u32 removeTraits) override;
 
+            const void* GetFunctionPointerAddress() const override { return &m_functionPtr; }
+
             FunctionPointer m_functionPtr;
             BehaviorParameter m_parameters[sizeof...(Args)+s_startNamedArgumentIndex];
             AZStd::array<BehaviorParameterMetadata, sizeof...(Args)+s_startNamedArgumentIndex> m_metadataParameters; ///< Stores the per parameter metadata which is used to add names, tooltips, trait, default values, etc... to the parameters
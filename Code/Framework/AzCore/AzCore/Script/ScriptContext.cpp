@@ -13,6 +13,7 @@
 #include <AzCore/Script/ScriptProperty.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/string/conversions.h>
+#include <AzCore/std/tuple.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/RTTI/AttributeReader.h>
@@ -20,6 +21,8 @@
 
 #include <AzCore/Script/ScriptPropertyTable.h>
 #include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector3.h>
 
 extern "C" {
 #   include <Lua/lualib.h>
@@ -3421,6 +3424,10 @@ LUA_API const Node* lua_getDummyNode()
                 {
                     m_resultToLua = nullptr;
                 }
+
+                // methods with a plain signature get a typed closure that bypasses the generic marshaling
+                m_functionPointerAddress = method->GetFunctionPointerAddress();
+                m_call = FindFastCall(*this);
             }
 
             int ManualCall(lua_State* lua) override
@@ -3435,9 +3442,12 @@ LUA_API const Node* lua_getDummyNode()
                 lua_pushlightuserdata(lua, this); // if there is no reason to keep the data in the "methods" we can use full user data and rely on __gc to clean it
                 lua_pushstring(lua, debugDescription);
                 lua_pushcclosure(lua, &Internal::LuaMethodTagHelper, 0);
-                lua_pushcclosure(lua, &LuaScriptCaller::Call, 3);
+                lua_pushcclosure(lua, m_call, 3);
             }
 
+            /// Returns a typed closure (see Internal::LuaFastCall) for the method signature, or Call if there is none.
+            static lua_CFunction FindFastCall(const LuaScriptCaller& caller);
+
             static int Call(lua_State* lua)
             {
                 LuaScriptCaller* thisPtr = reinterpret_cast<LuaScriptCaller*>(lua_touserdata(lua, lua_upvalueindex(1)));
@@ -3564,10 +3574,323 @@ LUA_API const Node* lua_getDummyNode()
             LuaPushToStack m_resultToLua;
             LuaPrepareValue m_prepareResult;
             BehaviorClass* m_resultClass;
+            const void* m_functionPointerAddress = nullptr; ///< Address of the method's native function pointer, used by the fast call closures
+            lua_CFunction m_call = &LuaScriptCaller::Call; ///< Closure pushed to Lua
 
             bool m_isResult;
         };
 
+        namespace Internal
+        {
+            //////////////////////////////////////////////////////////////////////////
+            // Fast calls
+            //
+            // Methods whose arguments and result are all arithmetic values, Vector3 or EntityId get a closure that reads the
+            // Lua stack straight into typed locals and calls the native function pointer directly, skipping the
+            // BehaviorValueParameter array, the temp stack allocator and the result callback of LuaScriptCaller::Call.
+            // A fast call only handles the common case, when arguments are missing (default values) or don't hold exactly
+            // the expected type it hands the call over to LuaScriptCaller::Call, which also reports any errors.
+
+            /// Typed Lua stack access for one fast call value, matching the conversions of LuaScriptNumber.
+            template<class T, bool IsArithmetic = AZStd::is_arithmetic<T>::value>
+            struct LuaFastCallValue
+            {
+                static bool IsConversion(LuaLoadFromStack fromLua)
+                {
+                    return fromLua == static_cast<LuaLoadFromStack>(&LuaScriptNumber<T>::FromStack);
+                }
+
+                static bool IsConversion(LuaPushToStack toLua)
+                {
+                    return toLua == static_cast<LuaPushToStack>(&LuaScriptNumber<T>::ToStack);
+                }
+
+                bool Read(lua_State* lua, int stackIndex)
+                {
+                    m_value = ScriptValue<T>::StackRead(lua, stackIndex);
+                    return true;
+                }
+
+                T& Get()
+                {
+                    return m_value;
+                }
+
+                static void Push(lua_State* lua, T value)
+                {
+                    ScriptValue<T>::StackPush(lua, value);
+                }
+
+                T m_value;
+            };
+
+            /// Typed Lua stack access for reflected classes, matching the conversions of LuaScriptReflectedType. Only userdata
+            /// holding exactly T is read (in place), derived types and nil are left to the generic path.
+            template<class T>
+            struct LuaFastCallValue<T, false>
+            {
+                static bool IsConversion(LuaLoadFromStack fromLua)
+                {
+                    return fromLua == static_cast<LuaLoadFromStack>(&LuaScriptReflectedType::FromStack);
+                }
+
+                static bool IsConversion(LuaPushToStack toLua)
+                {
+                    return toLua == static_cast<LuaPushToStack>(&LuaScriptReflectedType::ToStack);
+                }
+
+                bool Read(lua_State* lua, int stackIndex)
+                {
+                    if (lua_isuserdata(lua, stackIndex) && !lua_islightuserdata(lua, stackIndex))
+                    {
+                        LuaUserData* userData = reinterpret_cast<LuaUserData*>(lua_touserdata(lua, stackIndex));
+                        if (userData->magicData == AZLuaUserData && userData->behaviorClass->m_typeId == AzTypeInfo<T>::Uuid())
+                        {
+                            m_value = reinterpret_cast<T*>(userData->value);
+                        }
+                    }
+                    return m_value != nullptr;
+                }
+
+                T& Get()
+                {
+                    return *m_value;
+                }
+
+                static void Push(lua_State* lua, T& value)
+                {
+                    RegisteredObjectToLua(lua, &value, AzTypeInfo<T>::Uuid(), ObjectToLua::ByValue);
+                }
+
+                T* m_value = nullptr;
+            };
+
+            /// Returns true if the method parameter is declared as T and the generic caller converts it like LuaFastCallValue.
+            template<class T>
+            bool IsFastCallParameter(const BehaviorParameter* parameter, LuaLoadFromStack fromLua, u32 extraTraits = 0)
+            {
+                BehaviorParameter expected;
+                SetParameters<T>(&expected);
+                return parameter->m_typeId == expected.m_typeId
+                    && parameter->m_traits == (expected.m_traits | extraTraits)
+                    && LuaFastCallValue<AZStd::remove_pointer_t<AZStd::remove_cvref_t<T>>>::IsConversion(fromLua);
+            }
+
+            template<class R>
+            bool IsFastCallResult(const LuaScriptCaller& caller)
+            {
+                if constexpr (AZStd::is_void_v<R>)
+                {
+                    return !caller.m_method->HasResult();
+                }
+                else
+                {
+                    BehaviorParameter expected;
+                    SetParameters<R>(&expected);
+                    const BehaviorParameter* result = caller.m_method->GetResult();
+                    return caller.m_method->HasResult()
+                        && result->m_typeId == expected.m_typeId
+                        && result->m_traits == expected.m_traits
+                        && LuaFastCallValue<R>::IsConversion(caller.m_resultToLua);
+                }
+            }
+
+            template<class... Args>
+            struct LuaFastCallArguments
+            {
+                using Values = AZStd::tuple<LuaFastCallValue<AZStd::remove_cvref_t<Args>>...>;
+
+                /// Returns true if the method arguments, starting at firstArgument, are exactly Args.
+                template<size_t... Is>
+                static bool Matches(const LuaScriptCaller& caller, size_t firstArgument, AZStd::index_sequence<Is...>)
+                {
+                    return caller.m_method->GetNumArguments() == firstArgument + sizeof...(Args)
+                        && (IsFastCallParameter<Args>(caller.m_method->GetArgument(firstArgument + Is), caller.m_fromLua[firstArgument + Is].first) && ...);
+                }
+
+                /// Reads all arguments starting at stackIndex, returns false if any of them needs the generic path.
+                template<size_t... Is>
+                static bool Read([[maybe_unused]] lua_State* lua, [[maybe_unused]] Values& values, [[maybe_unused]] int stackIndex, AZStd::index_sequence<Is...>)
+                {
+                    return (AZStd::get<Is>(values).Read(lua, stackIndex + static_cast<int>(Is)) && ...);
+                }
+            };
+
+            template<class Function>
+            struct LuaFastCall;
+
+            template<class R, class... Args>
+            struct LuaFastCall<R(Args...)>
+            {
+                using FunctionPointer = R(*)(Args...);
+                using Arguments = LuaFastCallArguments<Args...>;
+
+                static bool Matches(const LuaScriptCaller& caller)
+                {
+                    return !caller.m_method->IsMember()
+                        && IsFastCallResult<R>(caller)
+                        && Arguments::Matches(caller, 0, AZStd::make_index_sequence<sizeof...(Args)>());
+                }
+
+                static int Call(lua_State* lua)
+                {
+                    return Call(lua, AZStd::make_index_sequence<sizeof...(Args)>());
+                }
+
+                template<size_t... Is>
+                static int Call(lua_State* lua, AZStd::index_sequence<Is...> indices)
+                {
+                    typename Arguments::Values values;
+                    if (lua_gettop(lua) < static_cast<int>(sizeof...(Args)) || !Arguments::Read(lua, values, 1, indices))
+                    {
+                        return LuaScriptCaller::Call(lua);
+                    }
+
+                    const LuaScriptCaller* thisPtr = reinterpret_cast<const LuaScriptCaller*>(lua_touserdata(lua, lua_upvalueindex(1)));
+                    FunctionPointer function = *reinterpret_cast<const FunctionPointer*>(thisPtr->m_functionPointerAddress);
+                    if constexpr (AZStd::is_void_v<R>)
+                    {
+                        function(AZStd::get<Is>(values).Get()...);
+                        return 0;
+                    }
+                    else
+                    {
+                        R result = function(AZStd::get<Is>(values).Get()...);
+                        LuaFastCallValue<R>::Push(lua, result);
+                        return 1;
+                    }
+                }
+            };
+
+            template<class R, class C, class... Args>
+            struct LuaFastCall<R(C::*)(Args...)>
+            {
+                using FunctionPointer = R(C::*)(Args...); // const member functions are stored without the qualifier as well
+                using Arguments = LuaFastCallArguments<Args...>;
+
+                static bool Matches(const LuaScriptCaller& caller)
+                {
+                    return caller.m_method->IsMember()
+                        && caller.m_method->GetNumArguments() > 0
+                        && IsFastCallParameter<C*>(caller.m_method->GetArgument(0), caller.m_fromLua[0].first, BehaviorParameter::TR_THIS_PTR)
+                        && IsFastCallResult<R>(caller)
+                        && Arguments::Matches(caller, 1, AZStd::make_index_sequence<sizeof...(Args)>());
+                }
+
+                static int Call(lua_State* lua)
+                {
+                    return Call(lua, AZStd::make_index_sequence<sizeof...(Args)>());
+                }
+
+                template<size_t... Is>
+                static int Call(lua_State* lua, AZStd::index_sequence<Is...> indices)
+                {
+                    LuaFastCallValue<C> object;
+                    typename Arguments::Values values;
+                    if (lua_gettop(lua) < static_cast<int>(sizeof...(Args)) + 1 || !object.Read(lua, 1) || !Arguments::Read(lua, values, 2, indices))
+                    {
+                        return LuaScriptCaller::Call(lua);
+                    }
+
+                    const LuaScriptCaller* thisPtr = reinterpret_cast<const LuaScriptCaller*>(lua_touserdata(lua, lua_upvalueindex(1)));
+                    FunctionPointer function = *reinterpret_cast<const FunctionPointer*>(thisPtr->m_functionPointerAddress);
+                    C* objectPtr = &object.Get();
+                    int numResults = 0;
+                    if constexpr (AZStd::is_void_v<R>)
+                    {
+                        (objectPtr->*function)(AZStd::get<Is>(values).Get()...);
+                    }
+                    else
+                    {
+                        R result = (objectPtr->*function)(AZStd::get<Is>(values).Get()...);
+                        LuaFastCallValue<R>::Push(lua, result);
+                        numResults = 1;
+                    }
+
+                    // only non const methods can change the object, which is all BehaviorObjectSignals handlers are interested in
+                    if (!thisPtr->m_method->m_isConst)
+                    {
+                        EBUS_EVENT_ID(static_cast<void*>(objectPtr), BehaviorObjectSignals, OnMemberMethodCalled, thisPtr->m_method);
+                    }
+                    return numResults;
+                }
+            };
+
+            struct LuaFastCallEntry
+            {
+                bool (*m_matches)(const LuaScriptCaller& caller);
+                lua_CFunction m_call;
+            };
+
+            template<class Function>
+            constexpr LuaFastCallEntry MakeFastCallEntry()
+            {
+                return { &LuaFastCall<Function>::Matches, &LuaFastCall<Function>::Call };
+            }
+
+            /// Signatures with a fast call, the math library functions and the common Vector3/EntityId methods.
+            static const LuaFastCallEntry s_fastCalls[] =
+            {
+                MakeFastCallEntry<float(float)>(),
+                MakeFastCallEntry<float(float, float)>(),
+                MakeFastCallEntry<float(float, float, float)>(),
+                MakeFastCallEntry<double(double)>(),
+                MakeFastCallEntry<double(double, double)>(),
+                MakeFastCallEntry<int(int)>(),
+                MakeFastCallEntry<int(int, int)>(),
+                MakeFastCallEntry<bool(int)>(),
+                MakeFastCallEntry<bool(double, double, double)>(),
+
+                MakeFastCallEntry<float(Vector3::*)()>(),
+                MakeFastCallEntry<Vector3(Vector3::*)()>(),
+                MakeFastCallEntry<void(Vector3::*)()>(),
+                MakeFastCallEntry<void(Vector3::*)(float)>(),
+                MakeFastCallEntry<bool(Vector3::*)(float)>(),
+                MakeFastCallEntry<Vector3(Vector3::*)(float)>(),
+                MakeFastCallEntry<float(Vector3::*)(int32_t)>(),
+                MakeFastCallEntry<void(Vector3::*)(int32_t, float)>(),
+                MakeFastCallEntry<float(Vector3::*)(const Vector3&)>(),
+                MakeFastCallEntry<bool(Vector3::*)(const Vector3&)>(),
+                MakeFastCallEntry<Vector3(Vector3::*)(const Vector3&)>(),
+                MakeFastCallEntry<bool(Vector3::*)(const Vector3&, float)>(),
+                MakeFastCallEntry<Vector3(Vector3::*)(const Vector3&, float)>(),
+
+                MakeFastCallEntry<bool(EntityId::*)()>(),
+                MakeFastCallEntry<bool(EntityId::*)(const EntityId&)>(),
+            };
+        } // namespace Internal
+
+        bool ScriptContext::IsLuaFastCallClosure(lua_State* lua, int stackIndex)
+        {
+            const lua_CFunction function = lua_tocfunction(lua, stackIndex);
+            if (function)
+            {
+                for (const Internal::LuaFastCallEntry& entry : Internal::s_fastCalls)
+                {
+                    if (entry.m_call == function)
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        lua_CFunction LuaScriptCaller::FindFastCall(const LuaScriptCaller& caller)
+        {
+            if (caller.m_functionPointerAddress)
+            {
+                for (const Internal::LuaFastCallEntry& entry : Internal::s_fastCalls)
+                {
+                    if (entry.m_matches(caller))
+                    {
+                        return entry.m_call;
+                    }
+                }
+            }
+            return &LuaScriptCaller::Call;
+        }
+
         class LuaGenericCaller : public LuaCaller
         {
         public:
@@ -90,6 +90,11 @@ namespace AzLsvInternal
 #define LSV_END_VARIABLE(expectedStackChange) (void)(expectedStackChange)
 #endif // AZ_LUA_VALIDATE_STACK
 
+namespace UnitTest
+{
+    class ScriptMathTest;
+}
+
 namespace AZ
 {
     class BehaviorClass;
@@ -928,6 +933,13 @@ namespace AZ
         // Used to convert the value specified at the specified index in the datacontext to a ScriptProperty.
         AZ::ScriptProperty* ConstructScriptProperty(ScriptDataContext& dc, int valueIndex, const char* name = nullptr, bool restrictToPropertyArrays = false);
 
+    private:
+        friend UnitTest::ScriptMathTest;
+
+        //! Returns true if the value at stackIndex is a BehaviorContext method bound through one of the typed fast call closures,
+        //! rather than the generic caller that converts every argument through a BehaviorValueParameter array.
+        static bool IsLuaFastCallClosure(lua_State* lua, int stackIndex);
+
     protected:
         class ScriptContextImpl* m_impl;
         ScriptContextId m_id;
@@ -114,6 +114,10 @@ namespace AZ
             void Enqueue(Task* task);
             Task* TryDequeue();
 
+            // Attempt to dequeue a task of a single priority level. This is safe to call from threads other
+            // than the owning worker, which is how idle workers steal work from busy ones.
+            Task* TryDequeue(uint8_t priority);
+
         private:
             QueueStatus m_status[PriorityLevelCount] = {};
             Task* m_queues[PriorityLevelCount][MaxQueueSize] = {};
@@ -161,32 +165,42 @@ namespace AZ
 
         Task* TaskQueue::TryDequeue()
         {
-            for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
+            for (uint8_t priority = 0; priority != PriorityLevelCount; ++priority)
             {
-                QueueStatus& status = m_status[priority];
-                while (true)
+                if (Task* task = TryDequeue(priority); task)
                 {
-                    uint16_t head = status.head.load();
-                    uint16_t tail = status.tail.load();
-                    if (head == tail)
-                    {
-                        // Queue empty
-                        break;
-                    }
-                    else
-                    {
-                        Task* task = m_queues[priority][status.head];
-                        if (status.head.compare_exchange_weak(head, head + 1))
-                        {
-                            return task;
-                        }
-                    }
+                    return task;
                 }
             }
 
             return nullptr;
         }
 
+        Task* TaskQueue::TryDequeue(uint8_t priority)
+        {
+            QueueStatus& status = m_status[priority];
+            while (true)
+            {
+                uint16_t head = status.head.load();
+                uint16_t tail = status.tail.load();
+                if (head == tail)
+                {
+                    // Queue empty
+                    return nullptr;
+                }
+                else
+                {
+                    // Read the slot at the head we observed (not a reloaded head), as other workers may be
+                    // dequeuing concurrently from this queue
+                    Task* task = m_queues[priority][head];
+                    if (status.head.compare_exchange_weak(head, head + 1))
+                    {
+                        return task;
+                    }
+                }
+            }
+        }
+
         class TaskWorker
         {
         public:
@@ -195,6 +209,7 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
 
                 AZStd::string threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
@@ -244,39 +259,151 @@ namespace AZ
                 m_semaphore.release();
             }
 
+            // Idle workers have exhausted both their own queue and the queues of their peers, and are
+            // waiting to be signaled. This load pairs with the idle store in Run(), see there for why both are seq_cst.
+            bool Idle() const
+            {
+                return m_idle.load(AZStd::memory_order_seq_cst);
+            }
+
+            // Wake this worker without enqueuing any work so it can attempt to steal from its peers
+            bool TryWake()
+            {
+                bool expected = true;
+                if (m_idle.compare_exchange_strong(expected, false, AZStd::memory_order_seq_cst))
+                {
+                    m_semaphore.release();
+                    return true;
+                }
+                return false;
+            }
+
         private:
+            // Tasks are acquired in strict priority order across the entire executor. For each priority level,
+            // the worker's own queue is checked first, followed by the queues of every other worker (starting
+            // from its neighbor to spread contention). A worker will only run lower priority work from its own
+            // queue if no peer has higher priority work waiting.
+            Task* AcquireTask()
+            {
+                const uint32_t threadCount = m_executor->m_threadCount;
+                for (uint8_t priority = 0; priority != TaskQueue::PriorityLevelCount; ++priority)
+                {
+                    if (Task* task = m_queue.TryDequeue(priority); task)
+                    {
+                        return task;
+                    }
+
+                    for (uint32_t i = 1; i < threadCount; ++i)
+                    {
+                        TaskWorker& victim = m_executor->m_workers[(m_id + i) % threadCount];
+                        if (Task* task = victim.m_queue.TryDequeue(priority); task)
+                        {
+                            return task;
+                        }
+                    }
+                }
+
+                return nullptr;
+            }
+
+            // Attach a child graph to the task currently being invoked by this worker. The parent task's
+            // successors are held back until the child graph completes.
+            bool AttachChild(CompiledTaskGraph& graph)
+            {
+                if (!m_activeTask)
+                {
+                    return false;
+                }
+
+                ++m_activeTask->m_dependencyCount;
+                graph.m_parentTask = m_activeTask;
+                return true;
+            }
+
+            void Complete(Task* task)
+            {
+                // Completing a child graph may complete its parent task in turn, so this walks up the chain of
+                // parents rather than recursing
+                while (task)
+                {
+                    if (!task->m_graph)
+                    {
+                        // Tasks submitted outside of a graph are owned by the executor
+                        delete task;
+                        return;
+                    }
+
+                    // Decrement counts for all task successors
+                    for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                    {
+                        Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
+                        if (--successor->m_dependencyCount == 0)
+                        {
+                            m_executor->Submit(*successor);
+                        }
+                    }
+
+                    // The graph may be destroyed (or resubmitted if retained) upon release, so the parent must be read first
+                    CompiledTaskGraph* graph = task->m_graph;
+                    Task* parentTask = graph->m_parentTask;
+                    bool isRetained = graph->m_parent != nullptr;
+                    task = nullptr;
+                    if (graph->Release() == (isRetained ? 1u : 0u))
+                    {
+                        m_executor->ReleaseGraph();
+
+                        if (parentTask && --parentTask->m_dependencyCount == 0)
+                        {
+                            task = parentTask;
+                        }
+                    }
+                }
+            }
+
             void Run()
             {
                 while (m_active)
                 {
                     m_semaphore.acquire();
+                    m_idle.store(false, AZStd::memory_order_release);
 
                     if (!m_active)
                     {
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+                    Task* task = AcquireTask();
+                    while (true)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                        if (!task)
                         {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
+                            // Advertise that we are idle before the final check so that a concurrent submission
+                            // either sees this worker as stealable, or its task is picked up here. This is a store
+                            // followed by a load of the queues, racing with the submitter's enqueue followed by a load
+                            // of m_idle, so both sides need seq_cst to keep the stores from being reordered after the loads.
+                            m_idle.store(true, AZStd::memory_order_seq_cst);
+                            task = AcquireTask();
+                            if (!task)
                             {
-                                m_executor->Submit(*successor);
+                                break;
                             }
+                            m_idle.store(false, AZStd::memory_order_release);
                         }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release() == (isRetained ? 1u : 0u))
+                        // While a task is in flight, its dependency count (which reached zero when the task was
+                        // submitted) is repurposed to count the invocation itself plus any child graphs it spawns.
+                        // The task only completes (releasing its successors) once this count drops to zero again.
+                        task->m_dependencyCount = 1;
+                        m_activeTask = task;
+                        task->Invoke();
+                        m_activeTask = nullptr;
+
+                        if (--task->m_dependencyCount == 0)
                         {
-                            m_executor->ReleaseGraph();
+                            Complete(task);
                         }
 
-                        task = m_queue.TryDequeue();
+                        task = AcquireTask();
                     }
                 }
             }
@@ -284,7 +411,12 @@ namespace AZ
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_idle = true;
             AZStd::binary_semaphore m_semaphore;
+            uint32_t m_id = 0;
+
+            // The task currently being invoked on this worker (used to parent spawned child graphs)
+            Task* m_activeTask = nullptr;
 
             ::AZ::TaskExecutor* m_executor;
             TaskQueue m_queue;
@@ -363,7 +495,10 @@ namespace AZ
     {
         ++m_graphsRemaining;
 
-        event->m_executor = this; // Used to validate event is not waited for inside a job
+        if (event)
+        {
+            event->m_executor = this; // Used to validate event is not waited for inside a job
+        }
 
         // Submit all tasks that have no inbound edges
         for (Internal::Task& task : graph.Tasks())
@@ -375,11 +510,44 @@ namespace AZ
         }
     }
 
+    uint32_t TaskExecutor::GetWorkerIndex() const
+    {
+        if (Internal::TaskWorker::t_worker)
+        {
+            return Internal::TaskWorker::t_worker->m_executor == this ? Internal::TaskWorker::t_worker->m_id : InvalidWorkerIndex;
+        }
+
+        // The thread local worker pointer is not visible across module boundaries, fall back to matching thread ids
+        const AZStd::thread::id threadId = AZStd::this_thread::get_id();
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            if (m_workers[i].m_thread.get_id() == threadId)
+            {
+                return i;
+            }
+        }
+        return InvalidWorkerIndex;
+    }
+
+    TaskExecutor* TaskExecutor::GetActiveExecutor()
+    {
+        return Internal::TaskWorker::t_worker ? Internal::TaskWorker::t_worker->m_executor : nullptr;
+    }
+
+    void TaskExecutor::SubmitChild(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event)
+    {
+        Internal::TaskWorker* worker = GetTaskWorker();
+        [[maybe_unused]] bool attached = worker && worker->AttachChild(graph);
+        AZ_Assert(attached, "Child task graphs may only be submitted from within a running task");
+
+        Submit(graph, event);
+    }
+
     void TaskExecutor::Submit(Internal::Task& task)
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
+        // TODO: Affinity is currently ignored.
+        // Tasks are distributed round-robin, and idle workers steal from the queues of busy workers
+        // so a long-running task does not starve the tasks queued behind it.
         uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
         while (!m_workers[nextWorker].Enabled())
         {
@@ -388,7 +556,21 @@ namespace AZ
             nextWorker = ++m_lastSubmission % m_threadCount;
         }
 
-        m_workers[nextWorker].Enqueue(&task);
+        Internal::TaskWorker& worker = m_workers[nextWorker];
+        worker.Enqueue(&task);
+
+        // If the worker that received the task is busy, wake an idle peer (if any) so the task can be
+        // stolen instead of waiting behind the task currently executing
+        if (!worker.Idle())
+        {
+            for (uint32_t i = 1; i < m_threadCount; ++i)
+            {
+                if (m_workers[(nextWorker + i) % m_threadCount].TryWake())
+                {
+                    break;
+                }
+            }
+        }
     }
 
     void TaskExecutor::ReleaseGraph()
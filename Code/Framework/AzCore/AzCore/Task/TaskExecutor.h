@@ -52,6 +52,8 @@ namespace AZ
             TaskGraphEvent* m_waitEvent = nullptr;
             // The pointer to the parent graph is set only if it is retained
             TaskGraph* m_parent = nullptr;
+            // Set if this graph was spawned as a child of a running task (see TaskGraph::SubmitAsChild)
+            Task* m_parentTask = nullptr;
             AZStd::atomic<uint32_t> m_remaining;
         };
 
@@ -63,6 +65,9 @@ namespace AZ
     public:
         AZ_CLASS_ALLOCATOR(TaskExecutor, SystemAllocator, 0);
 
+        // Value returned by GetWorkerIndex if the calling thread is not a worker of this executor
+        static constexpr uint32_t InvalidWorkerIndex = ~0u;
+
         static TaskExecutor& Instance();
 
         // Invoked by a system component on program launch
@@ -78,9 +83,32 @@ namespace AZ
 
         void Submit(Internal::Task& task);
 
+        // Submit a single task that does not belong to any task graph. The task is released after it runs.
+        // This is intended for adapters that schedule work from other systems onto the executor's workers
+        // (prefer TaskGraph for all other work).
+        template<typename Lambda>
+        void Submit(TaskDescriptor const& descriptor, Lambda&& lambda);
+
+        uint32_t GetThreadCount() const
+        {
+            return m_threadCount;
+        }
+
+        // Returns the 0-based index of the calling worker thread, or InvalidWorkerIndex if the calling thread is
+        // not one of this executor's workers
+        uint32_t GetWorkerIndex() const;
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
+        friend class TaskGraph;
+
+        // Returns the executor owning the calling thread if it is a task worker, nullptr otherwise
+        static TaskExecutor* GetActiveExecutor();
+
+        // Submit a task graph as a child of the task running on the calling worker thread. Successors of the
+        // running task are only released after the child graph completes.
+        void SubmitChild(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event);
 
         Internal::TaskWorker* GetTaskWorker();
         void ReleaseGraph();
@@ -91,4 +119,10 @@ namespace AZ
         AZStd::atomic<uint32_t> m_lastSubmission;
         AZStd::atomic<uint64_t> m_graphsRemaining;
     };
+
+    template<typename Lambda>
+    void TaskExecutor::Submit(TaskDescriptor const& descriptor, Lambda&& lambda)
+    {
+        Submit(*aznew Internal::Task(descriptor, AZStd::forward<Lambda>(lambda)));
+    }
 } // namespace AZ
@@ -63,6 +63,38 @@ namespace AZ
     }
 
     void TaskGraph::SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent)
+    {
+        PrepareSubmission(waitEvent);
+        executor.Submit(*m_compiledTaskGraph, waitEvent);
+        FinishSubmission();
+    }
+
+    void TaskGraph::SubmitAsChild(TaskGraphEvent* waitEvent)
+    {
+        TaskExecutor* executor = TaskExecutor::GetActiveExecutor();
+        AZ_Assert(executor, "TaskGraph::SubmitAsChild must be invoked from within a running task");
+        if (!executor)
+        {
+            SubmitOnExecutor(TaskExecutor::Instance(), waitEvent);
+            return;
+        }
+
+        if (IsEmpty() && !m_compiledTaskGraph)
+        {
+            // Nothing to join back into the parent task
+            if (waitEvent)
+            {
+                waitEvent->Signal();
+            }
+            return;
+        }
+
+        PrepareSubmission(waitEvent);
+        executor->SubmitChild(*m_compiledTaskGraph, waitEvent);
+        FinishSubmission();
+    }
+
+    void TaskGraph::PrepareSubmission(TaskGraphEvent* waitEvent)
     {
         if (!m_compiledTaskGraph)
         {
@@ -70,6 +102,7 @@ namespace AZ
         }
 
         m_compiledTaskGraph->m_waitEvent = waitEvent;
+        m_compiledTaskGraph->m_parentTask = nullptr;
         uint32_t taskCount = aznumeric_cast<uint32_t>(m_compiledTaskGraph->m_tasks.size());
         m_compiledTaskGraph->m_remaining = taskCount + (m_retained ? 1 : 0);
         for (uint32_t i = 0; i != taskCount; ++i)
@@ -77,13 +110,17 @@ namespace AZ
             m_compiledTaskGraph->m_tasks[i].Init();
         }
 
-        executor.Submit(*m_compiledTaskGraph, waitEvent);
-
         if (m_retained)
         {
+            // Flag the submission before the executor sees the graph, as it may complete (and clear this flag)
+            // before the submission call returns
             m_submitted = true;
         }
-        else
+    }
+
+    void TaskGraph::FinishSubmission()
+    {
+        if (!m_retained)
         {
             m_compiledTaskGraph = nullptr;
             Reset();
@@ -146,10 +146,26 @@ namespace AZ
         // Same as submit but run on a different executor than the default system executor
         void SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent = nullptr);
 
+        // Submit this graph from within a running task as a child of that task. Tasks that follow the
+        // running task in its own graph are not released until this graph completes, so a task can fan out
+        // a data-dependent amount of work without blocking its worker on a TaskGraphEvent. The graph runs
+        // on the executor that is running the parent task.
+        //
+        // Child graphs are typically built in the body of the parent task and detached before submission.
+        // Child graphs may in turn spawn child graphs of their own.
+        // NOTE: This operation is invalid outside of a running task
+        void SubmitAsChild(TaskGraphEvent* waitEvent = nullptr);
+
     private:
         friend class TaskToken;
         friend class Internal::CompiledTaskGraph;
 
+        // Compile the graph (if needed) and reset per-submission state prior to handing it to an executor
+        void PrepareSubmission(TaskGraphEvent* waitEvent);
+
+        // Relinquish ownership of the compiled graph if detached, after it was handed to an executor
+        void FinishSubmission();
+
         Internal::CompiledTaskGraph* m_compiledTaskGraph = nullptr;
 
         AZStd::vector<Internal::Task> m_tasks;
@@ -14,6 +14,7 @@
 
 // Create a cvar as a central location for experimentation with switching from the Job system to TaskGraph system.
 AZ_CVAR(bool, cl_activateTaskGraph, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Flag clients of TaskGraph to switch between jobs/taskgraph (Note does not disable task graph system)");
+AZ_CVAR(uint32_t, cl_taskGraphThreadCount, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of TaskGraph worker threads created on activation (0 matches the hardware concurrency). This is the thread count of the whole process when the JobManagerComponent shares the task executor");
 static constexpr uint32_t TaskExecutorServiceCrc = AZ_CRC_CE("TaskExecutorService");
 
 namespace AZ
@@ -25,7 +26,7 @@ namespace AZ
         if (Interface<TaskGraphActiveInterface>::Get() == nullptr)
         {
             Interface<TaskGraphActiveInterface>::Register(this);
-            m_taskExecutor = aznew TaskExecutor();
+            m_taskExecutor = aznew TaskExecutor(cl_taskGraphThreadCount);
             TaskExecutor::SetInstance(m_taskExecutor);
         }
     }
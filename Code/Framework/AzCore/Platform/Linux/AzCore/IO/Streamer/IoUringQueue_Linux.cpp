@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/IoUringQueue_Linux.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ::IO
+{
+    namespace IoUringInternal
+    {
+        template<typename T>
+        static T* RingOffset(void* ring, u32 offset)
+        {
+            return reinterpret_cast<T*>(reinterpret_cast<u8*>(ring) + offset);
+        }
+
+        static u32 LoadAcquire(const u32* value)
+        {
+            return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+        }
+
+        static void StoreRelease(u32* target, u32 value)
+        {
+            __atomic_store_n(target, value, __ATOMIC_RELEASE);
+        }
+    } // namespace IoUringInternal
+
+    IoUringQueue::~IoUringQueue()
+    {
+        Shutdown();
+    }
+
+    bool IoUringQueue::Initialize(u32 queueDepth)
+    {
+        using namespace IoUringInternal;
+
+        AZ_Assert(!IsInitialized(), "IoUringQueue has already been initialized.");
+
+        io_uring_params params{};
+        int ringFd = aznumeric_caster(::syscall(__NR_io_uring_setup, queueDepth, &params));
+        if (ringFd < 0)
+        {
+            AZ_Warning("IoUringQueue", false, "Failed to create an io_uring (Error: %i).\n", errno);
+            return false;
+        }
+        m_ringFd = ringFd;
+
+        // IORING_OP_READ was introduced in the same kernel release as IORING_FEAT_RW_CUR_POS, so use the feature flag to detect
+        // if the plain read operation is available rather than having to probe for it.
+        if ((params.features & IORING_FEAT_RW_CUR_POS) == 0)
+        {
+            AZ_Warning("IoUringQueue", false, "The available io_uring doesn't support the required read operations.\n");
+            Shutdown();
+            return false;
+        }
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = ::mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFd, IORING_OFF_SQ_RING);
+        if (m_submissionRing == MAP_FAILED)
+        {
+            m_submissionRing = nullptr;
+            AZ_Warning("IoUringQueue", false, "Failed to map the io_uring submission queue (Error: %i).\n", errno);
+            Shutdown();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            m_completionRing = ::mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_ringFd, IORING_OFF_CQ_RING);
+            if (m_completionRing == MAP_FAILED)
+            {
+                m_completionRing = nullptr;
+                AZ_Warning("IoUringQueue", false, "Failed to map the io_uring completion queue (Error: %i).\n", errno);
+                Shutdown();
+                return false;
+            }
+        }
+
+        void* entries = ::mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+        if (entries == MAP_FAILED)
+        {
+            AZ_Warning("IoUringQueue", false, "Failed to map the io_uring submission entries (Error: %i).\n", errno);
+            Shutdown();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(entries);
+        m_submissionEntryCount = params.sq_entries;
+
+        m_submissionHead = RingOffset<u32>(m_submissionRing, params.sq_off.head);
+        m_submissionTail = RingOffset<u32>(m_submissionRing, params.sq_off.tail);
+        m_submissionArray = RingOffset<u32>(m_submissionRing, params.sq_off.array);
+        m_submissionMask = *RingOffset<u32>(m_submissionRing, params.sq_off.ring_mask);
+        m_localSubmissionTail = *m_submissionTail;
+
+        m_completionHead = RingOffset<u32>(m_completionRing, params.cq_off.head);
+        m_completionTail = RingOffset<u32>(m_completionRing, params.cq_off.tail);
+        m_completionEntries = RingOffset<io_uring_cqe>(m_completionRing, params.cq_off.cqes);
+        m_completionMask = *RingOffset<u32>(m_completionRing, params.cq_off.ring_mask);
+
+        return true;
+    }
+
+    void IoUringQueue::Shutdown()
+    {
+        UnregisterBuffers();
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntryCount * sizeof(io_uring_sqe));
+            m_submissionEntries = nullptr;
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            ::munmap(m_completionRing, m_completionRingSize);
+        }
+        m_completionRing = nullptr;
+        if (m_submissionRing)
+        {
+            ::munmap(m_submissionRing, m_submissionRingSize);
+            m_submissionRing = nullptr;
+        }
+        if (m_ringFd >= 0)
+        {
+            ::close(m_ringFd);
+            m_ringFd = -1;
+        }
+
+        m_submissionHead = nullptr;
+        m_submissionTail = nullptr;
+        m_submissionArray = nullptr;
+        m_completionHead = nullptr;
+        m_completionTail = nullptr;
+        m_completionEntries = nullptr;
+        m_submissionEntryCount = 0;
+        m_unsubmittedCount = 0;
+    }
+
+    bool IoUringQueue::IsInitialized() const
+    {
+        return m_submissionEntries != nullptr;
+    }
+
+    int IoUringQueue::GetFileDescriptor() const
+    {
+        return m_ringFd;
+    }
+
+    u32 IoUringQueue::GetQueueDepth() const
+    {
+        return m_submissionEntryCount;
+    }
+
+    bool IoUringQueue::RegisterBuffers(const iovec* buffers, u32 count)
+    {
+        AZ_Assert(IsInitialized(), "Buffers can't be registered with an io_uring that hasn't been initialized.");
+        AZ_Assert(!m_hasRegisteredBuffers, "Buffers have already been registered with the io_uring.");
+
+        if (::syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_BUFFERS, buffers, count) < 0)
+        {
+            // The most common cause for failure is that the buffers exceed the memory lock limit (RLIMIT_MEMLOCK).
+            AZ_Warning("IoUringQueue", false, "Failed to register %u buffers with the io_uring (Error: %i).\n", count, errno);
+            return false;
+        }
+        m_hasRegisteredBuffers = true;
+        return true;
+    }
+
+    void IoUringQueue::UnregisterBuffers()
+    {
+        if (m_hasRegisteredBuffers)
+        {
+            ::syscall(__NR_io_uring_register, m_ringFd, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+            m_hasRegisteredBuffers = false;
+        }
+    }
+
+    bool IoUringQueue::HasRegisteredBuffers() const
+    {
+        return m_hasRegisteredBuffers;
+    }
+
+    io_uring_sqe* IoUringQueue::AcquireSubmissionEntry()
+    {
+        using namespace IoUringInternal;
+
+        const u32 head = LoadAcquire(m_submissionHead);
+        if (m_localSubmissionTail - head >= m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 index = m_localSubmissionTail & m_submissionMask;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        m_localSubmissionTail++;
+        m_unsubmittedCount++;
+        return entry;
+    }
+
+    s32 IoUringQueue::Submit()
+    {
+        using namespace IoUringInternal;
+
+        if (m_unsubmittedCount == 0)
+        {
+            return 0;
+        }
+
+        StoreRelease(m_submissionTail, m_localSubmissionTail);
+        s32 result = 0;
+        do
+        {
+            result = aznumeric_caster(::syscall(__NR_io_uring_enter, m_ringFd, m_unsubmittedCount, 0, 0, nullptr, 0));
+        } while (result < 0 && errno == EINTR);
+
+        if (result < 0)
+        {
+            return -errno;
+        }
+        m_unsubmittedCount -= AZStd::min(aznumeric_cast<u32>(result), m_unsubmittedCount);
+        return result;
+    }
+
+    u32 IoUringQueue::GetNumUnsubmittedEntries() const
+    {
+        return m_unsubmittedCount;
+    }
+
+    const io_uring_cqe* IoUringQueue::PeekCompletion() const
+    {
+        using namespace IoUringInternal;
+
+        const u32 head = *m_completionHead;
+        if (head == LoadAcquire(m_completionTail))
+        {
+            return nullptr;
+        }
+        return &m_completionEntries[head & m_completionMask];
+    }
+
+    void IoUringQueue::ReleaseCompletion()
+    {
+        using namespace IoUringInternal;
+        StoreRelease(m_completionHead, *m_completionHead + 1);
+    }
+} // namespace AZ::IO
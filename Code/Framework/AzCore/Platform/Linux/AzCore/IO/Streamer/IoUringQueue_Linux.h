@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+#include <AzCore/base.h>
+
+namespace AZ::IO
+{
+    //! Thin wrapper around a single io_uring instance. The kernel interface is used directly through system calls so
+    //! no additional libraries are needed. The queue isn't thread safe and is expected to be used from a single thread,
+    //! which for Streamer is the scheduler thread.
+    class IoUringQueue
+    {
+    public:
+        IoUringQueue() = default;
+        ~IoUringQueue();
+
+        IoUringQueue(const IoUringQueue&) = delete;
+        IoUringQueue& operator=(const IoUringQueue&) = delete;
+
+        //! Creates the ring with room for at least the requested number of submissions. Returns false if io_uring isn't
+        //! available, for instance because the kernel is too old or because the system call is blocked by a sandbox.
+        bool Initialize(u32 queueDepth);
+        void Shutdown();
+        bool IsInitialized() const;
+
+        //! The file descriptor of the ring. This becomes readable when there are completions waiting to be reaped.
+        int GetFileDescriptor() const;
+        u32 GetQueueDepth() const;
+
+        //! Registers a set of buffers with the kernel so they can be used with IORING_OP_READ_FIXED. This avoids mapping
+        //! and unmapping the buffer pages for every read.
+        bool RegisterBuffers(const iovec* buffers, u32 count);
+        void UnregisterBuffers();
+        bool HasRegisteredBuffers() const;
+
+        //! Gets the next free submission entry or null if the submission queue is full. The returned entry is cleared.
+        io_uring_sqe* AcquireSubmissionEntry();
+        //! Hands all submission entries acquired since the last call to the kernel.
+        //! @return The number of submitted entries or a negative error code.
+        s32 Submit();
+        u32 GetNumUnsubmittedEntries() const;
+
+        //! Returns the oldest completion that hasn't been reaped yet or null if there are none.
+        const io_uring_cqe* PeekCompletion() const;
+        //! Releases the completion returned by PeekCompletion back to the kernel.
+        void ReleaseCompletion();
+
+    private:
+        void* m_submissionRing{ nullptr };
+        void* m_completionRing{ nullptr };
+        io_uring_sqe* m_submissionEntries{ nullptr };
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_submissionArray{ nullptr };
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        io_uring_cqe* m_completionEntries{ nullptr };
+
+        u32 m_submissionMask{ 0 };
+        u32 m_submissionEntryCount{ 0 };
+        u32 m_completionMask{ 0 };
+        u32 m_localSubmissionTail{ 0 };
+        u32 m_unsubmittedCount{ 0 };
+
+        int m_ringFd{ -1 };
+        bool m_hasRegisteredBuffers{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableDirectReads = m_enableDirectReads;
+        options.m_minimalReporting = m_minimalReporting;
+        if (const LinuxHardwareInformation* linuxHardware = AZStd::any_cast<LinuxHardwareInformation>(&hardware.m_platformData))
+        {
+            options.m_hasSeekPenalty = linuxHardware->m_hasSeekPenalty;
+        }
+
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(m_maxFileHandles, m_maxMetaDataCache, hardware.m_maxPhysicalSectorSize,
+            hardware.m_maxLogicalSectorSize, m_queueDepth, aznumeric_cast<s32>(m_overcommit), m_stagingBufferSizeKib * 1_kib, options);
+        if (stackEntry->IsInitialized())
+        {
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        // io_uring can be unavailable on older kernels or blocked inside containers, in which case use the generic drive so
+        // files can still be read.
+        if (!parent)
+        {
+            AZ_Warning("Streamer", false, "io_uring isn't available. Falling back to the generic storage drive.\n");
+            return AZStd::make_shared<StorageDrive>(m_maxFileHandles);
+        }
+        AZ_Warning("Streamer", false, "io_uring isn't available. The Linux storage drive will not be added.\n");
+        return parent;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("StagingBufferSizeKib", &LinuxStorageDriveConfig::m_stagingBufferSizeKib)
+                ->Field("EnableDirectReads", &LinuxStorageDriveConfig::m_enableDirectReads)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/std/any.h>
+
+namespace AZ::IO
+{
+    static bool ReadBlockDeviceQueueValue(const char* deviceName, const char* entry, size_t& value)
+    {
+        char path[256];
+        azsnprintf(path, AZ_ARRAY_SIZE(path), "/sys/block/%s/queue/%s", deviceName, entry);
+        FILE* file = fopen(path, "r");
+        if (!file)
+        {
+            return false;
+        }
+        unsigned long long result = 0;
+        const bool success = fscanf(file, "%llu", &result) == 1;
+        fclose(file);
+        if (success)
+        {
+            value = aznumeric_caster(result);
+        }
+        return success;
+    }
+
+    static bool IsVirtualBlockDevice(const char* deviceName)
+    {
+        // Loop back devices, ram disks and compressed swap don't represent actual storage hardware.
+        return strncmp(deviceName, "loop", 4) == 0 || strncmp(deviceName, "ram", 3) == 0 || strncmp(deviceName, "zram", 4) == 0;
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool includeAllHardware, bool reportHardware)
+    {
+        DIR* blockDevices = opendir("/sys/block");
+        if (!blockDevices)
+        {
+            return false;
+        }
+
+        LinuxHardwareInformation linuxInfo;
+        linuxInfo.m_hasSeekPenalty = false;
+        size_t maxPhysicalSectorSize = 0;
+        size_t maxLogicalSectorSize = 0;
+        size_t maxTransfer = 0;
+        bool foundDevice = false;
+
+        while (dirent* entry = readdir(blockDevices))
+        {
+            const char* deviceName = entry->d_name;
+            if (deviceName[0] == '.' || (!includeAllHardware && IsVirtualBlockDevice(deviceName)))
+            {
+                continue;
+            }
+
+            size_t physicalSectorSize = 0;
+            size_t logicalSectorSize = 0;
+            if (!ReadBlockDeviceQueueValue(deviceName, "physical_block_size", physicalSectorSize) ||
+                !ReadBlockDeviceQueueValue(deviceName, "logical_block_size", logicalSectorSize))
+            {
+                continue;
+            }
+            size_t maxTransferKib = 0;
+            ReadBlockDeviceQueueValue(deviceName, "max_sectors_kb", maxTransferKib);
+            size_t isRotational = 1;
+            ReadBlockDeviceQueueValue(deviceName, "rotational", isRotational);
+
+            maxPhysicalSectorSize = AZStd::max(maxPhysicalSectorSize, physicalSectorSize);
+            maxLogicalSectorSize = AZStd::max(maxLogicalSectorSize, logicalSectorSize);
+            maxTransfer = AZStd::max(maxTransfer, aznumeric_cast<size_t>(maxTransferKib * 1_kib));
+            linuxInfo.m_hasSeekPenalty = linuxInfo.m_hasSeekPenalty || (isRotational != 0);
+            foundDevice = true;
+
+            if (reportHardware)
+            {
+                AZ_Printf("Streamer", "Block device '%s' found.\n", deviceName);
+                AZ_Printf("Streamer", "    Physical sector size: %zu\n", physicalSectorSize);
+                AZ_Printf("Streamer", "    Logical sector size: %zu\n", logicalSectorSize);
+                AZ_Printf("Streamer", "    Max transfer: %zu kib\n", maxTransferKib);
+                AZ_Printf("Streamer", "    Has seek penalty: %s\n", isRotational != 0 ? "Yes" : "No");
+            }
+        }
+        closedir(blockDevices);
+
+        if (!foundDevice)
+        {
+            return false;
+        }
+
+        hardwareInfo.m_maxPageSize = 4096;
+        hardwareInfo.m_maxPhysicalSectorSize = AZStd::max(maxPhysicalSectorSize, size_t{ 512 });
+        hardwareInfo.m_maxLogicalSectorSize = AZStd::max(maxLogicalSectorSize, size_t{ 512 });
+        hardwareInfo.m_maxTransfer = maxTransfer > 0 ? maxTransfer : 512_kib;
+        hardwareInfo.m_profile = "Generic";
+        hardwareInfo.m_platformData = AZStd::make_any<LinuxHardwareInformation>(linuxInfo);
+        return true;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, includeAllHardware, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
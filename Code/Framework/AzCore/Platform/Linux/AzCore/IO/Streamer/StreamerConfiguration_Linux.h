@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+
+namespace AZ::IO
+{
+    struct LinuxHardwareInformation
+    {
+        AZ_TYPE_INFO(AZ::IO::LinuxHardwareInformation, "{0E4D2B7A-61C3-4F58-A9D0-3B7E5C1F8A26}");
+
+        //! True if any of the block devices reported itself as rotational.
+        bool m_hasSeekPenalty{ true };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        int wakeUpEvent = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        AZ_Assert(wakeUpEvent >= 0, "Failed to create a required event for IO Scheduler (Error: %i).", errno);
+        m_pollEntries[0].fd = wakeUpEvent;
+        m_pollEntries[0].events = POLLIN;
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        AZ_Assert(m_handleCount == 1, "There are still %zu IO wait handles registered with the IO Scheduler.", m_handleCount - 1);
+        if (m_pollEntries[0].fd >= 0)
+        {
+            ::close(m_pollEntries[0].fd);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_pollEntries[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        int result = 0;
+        do
+        {
+            result = ::poll(m_pollEntries, aznumeric_cast<nfds_t>(m_handleCount), -1);
+        } while (result < 0 && errno == EINTR);
+        AZ_Assert(result >= 0, "Unexpected wait result: %i (Error: %i).", result, errno);
+
+        if (m_pollEntries[0].revents & POLLIN)
+        {
+            // Reset the event. Any other handles are reset by reading their results.
+            eventfd_t value;
+            ::eventfd_read(m_pollEntries[0].fd, &value);
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_pollEntries[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_pollEntries[0].fd, 1);
+    }
+
+    void StreamerContextThreadSync::AddWaitHandle(int fileDescriptor)
+    {
+        AZ_Assert(AreWaitHandlesAvailable(), "There are no more slots available to add a new IO wait handle to.");
+        pollfd& entry = m_pollEntries[m_handleCount++];
+        entry.fd = fileDescriptor;
+        entry.events = POLLIN;
+        entry.revents = 0;
+    }
+
+    void StreamerContextThreadSync::RemoveWaitHandle(int fileDescriptor)
+    {
+        AZ_Assert(m_handleCount > 1, "There are no more IO wait handles that can be removed.");
+
+        for (size_t i = 1; i < m_handleCount; ++i)
+        {
+            if (m_pollEntries[i].fd == fileDescriptor)
+            {
+                m_handleCount--;
+                AZStd::swap(m_pollEntries[i], m_pollEntries[m_handleCount]);
+                return;
+            }
+        }
+
+        AZ_Assert(false, "IO wait handle couldn't be removed as it wasn't found.");
+    }
+
+    size_t StreamerContextThreadSync::GetWaitHandleCount() const
+    {
+        return m_handleCount - 1;
+    }
+
+    bool StreamerContextThreadSync::AreWaitHandlesAvailable() const
+    {
+        return m_handleCount < AZ_ARRAY_SIZE(m_pollEntries);
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <poll.h>
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 15;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Adds a file descriptor that will wake up the scheduler thread when it becomes readable. This is used by
+        //! stream stack entries that have asynchronous operations in flight, such as reads queued on an io_uring.
+        void AddWaitHandle(int fileDescriptor);
+        void RemoveWaitHandle(int fileDescriptor);
+        size_t GetWaitHandleCount() const;
+        bool AreWaitHandlesAvailable() const;
+
+    private:
+        // Note: The first entry is reserved for the eventfd that's used for synchronization of the
+        // scheduler thread with the rest of the engine. The remaining entries can be freely used by
+        // Streamer's internals.
+        pollfd m_pollEntries[MaxIoEvents + 1]{};
+        size_t m_handleCount{ 1 }; // The first entry is for external wake up calls.
+    };
+
+} // namespace AZ::Platform
@@ -14,6 +14,7 @@
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/task_group.h>
 #include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/std/delegate/delegate.h>
 #include <AzCore/std/bind/bind.h>
 
@@ -1555,6 +1556,131 @@ namespace UnitTest
         run();
     }
 
+    // Runs jobs on the workers of a TaskExecutor instead of dedicated job worker threads
+    class TaskExecutorJobManagerSetupFixture
+        : public AllocatorsTestFixture
+    {
+    protected:
+        TaskExecutor* m_taskExecutor = nullptr;
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            m_taskExecutor = aznew TaskExecutor(4);
+
+            JobManagerDesc desc;
+            desc.m_taskExecutor = m_taskExecutor;
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+
+            JobContext::SetGlobalContext(m_jobContext);
+        }
+
+        void TearDown() override
+        {
+            JobContext::SetGlobalContext(nullptr);
+
+            delete m_jobContext;
+            delete m_jobManager;
+            azdestroy(m_taskExecutor);
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            AllocatorsTestFixture::TearDown();
+        }
+    };
+
+    TEST_F(TaskExecutorJobManagerSetupFixture, JobManager_SharesTaskExecutorThreads)
+    {
+        EXPECT_TRUE(m_jobManager->IsAsynchronous());
+        EXPECT_EQ(m_taskExecutor->GetThreadCount(), m_jobManager->GetNumWorkerThreads());
+        EXPECT_EQ(JobManager::InvalidWorkerThreadId, m_jobManager->GetWorkerThreadId());
+
+        AZStd::atomic<AZ::u32> workerId{ JobManager::InvalidWorkerThreadId };
+        Job* job = CreateJobFunction(
+            [this, &workerId]()
+            {
+                workerId = m_jobManager->GetWorkerThreadId();
+            },
+            true, m_jobContext);
+        job->StartAndWaitForCompletion();
+
+        // The job may be run by the waiting thread while it assists, in which case it has no worker id
+        const AZ::u32 id = workerId;
+        EXPECT_TRUE(id == JobManager::InvalidWorkerThreadId || id < m_taskExecutor->GetThreadCount());
+    }
+
+    TEST_F(TaskExecutorJobManagerSetupFixture, JobFunction_JobCompletion_AllJobsRun)
+    {
+        constexpr int numJobs = 256;
+        AZStd::atomic<int> count{ 0 };
+
+        JobCompletion completion(m_jobContext);
+        for (int i = 0; i < numJobs; ++i)
+        {
+            Job* job = CreateJobFunction(
+                [&count]()
+                {
+                    ++count;
+                },
+                true, m_jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+
+        EXPECT_EQ(numJobs, count);
+    }
+
+    TEST_F(TaskExecutorJobManagerSetupFixture, ChildJobsAndContinuations_Fibonacci)
+    {
+        int result = 0;
+        Job* job = aznew FibonacciJobFork(g_fibonacciFast, &result, m_jobContext);
+        JobCompletionSpin doneJob(m_jobContext);
+        job->SetDependent(&doneJob);
+        job->Start();
+        doneJob.StartAndWaitForCompletion();
+
+        EXPECT_EQ(g_fibonacciFastResult, result);
+    }
+
+    TEST_F(TaskExecutorJobManagerSetupFixture, SuspendedJobsWaitForChildren_Fibonacci)
+    {
+        int result = 0;
+        Job* job = aznew FibonacciJob2(g_fibonacciFast, &result, m_jobContext);
+        JobCompletion doneJob(m_jobContext);
+        job->SetDependent(&doneJob);
+        job->Start();
+        doneJob.StartAndWaitForCompletion();
+
+        EXPECT_EQ(g_fibonacciFastResult, result);
+    }
+
+    TEST_F(TaskExecutorJobManagerSetupFixture, ParallelFor_AllIndicesVisited)
+    {
+        constexpr int numIterations = 10000;
+        AZStd::vector<int> results(numIterations, 0);
+
+        parallel_for(0, numIterations,
+            [&results](int i)
+            {
+                results[i] = i * 2;
+            });
+
+        for (int i = 0; i < numIterations; ++i)
+        {
+            EXPECT_EQ(i * 2, results[i]);
+        }
+    }
+
     class TestJobWithPriority : public Job
     {
     public:
@@ -56,6 +56,29 @@ namespace Benchmark
                 testData.vector2 = AZ::Vector3(unif(rng), unif(rng), unif(rng));
                 return testData;
             });
+
+            // Copy the bounding volumes into separate component arrays for the batch tests
+            for (std::vector<float>* components : { &m_aabbMinX, &m_aabbMinY, &m_aabbMinZ, &m_aabbMaxX, &m_aabbMaxY, &m_aabbMaxZ,
+                &m_sphereCenterX, &m_sphereCenterY, &m_sphereCenterZ, &m_sphereRadius })
+            {
+                components->clear();
+            }
+            for (const TestData& testData : m_testDataArray)
+            {
+                m_aabbMinX.push_back(testData.aabb.GetMin().GetX());
+                m_aabbMinY.push_back(testData.aabb.GetMin().GetY());
+                m_aabbMinZ.push_back(testData.aabb.GetMin().GetZ());
+                m_aabbMaxX.push_back(testData.aabb.GetMax().GetX());
+                m_aabbMaxY.push_back(testData.aabb.GetMax().GetY());
+                m_aabbMaxZ.push_back(testData.aabb.GetMax().GetZ());
+                m_sphereCenterX.push_back(testData.sphere.GetCenter().GetX());
+                m_sphereCenterY.push_back(testData.sphere.GetCenter().GetY());
+                m_sphereCenterZ.push_back(testData.sphere.GetCenter().GetZ());
+                m_sphereRadius.push_back(testData.sphere.GetRadius());
+            }
+            m_aabbBatch = { m_aabbMinX.data(), m_aabbMinY.data(), m_aabbMinZ.data(), m_aabbMaxX.data(), m_aabbMaxY.data(), m_aabbMaxZ.data(), m_testDataArray.size() };
+            m_sphereBatch = { m_sphereCenterX.data(), m_sphereCenterY.data(), m_sphereCenterZ.data(), m_sphereRadius.data(), m_testDataArray.size() };
+            m_batchMask.resize(AZ::ShapeIntersection::GetBatchMaskSize(m_testDataArray.size()));
         }
     public:
         void SetUp(const benchmark::State&) override
@@ -76,6 +99,12 @@ namespace Benchmark
         };
 
         std::vector<TestData> m_testDataArray;
+
+        std::vector<float> m_aabbMinX, m_aabbMinY, m_aabbMinZ, m_aabbMaxX, m_aabbMaxY, m_aabbMaxZ;
+        std::vector<float> m_sphereCenterX, m_sphereCenterY, m_sphereCenterZ, m_sphereRadius;
+        AZ::ShapeIntersection::AabbBatch m_aabbBatch;
+        AZ::ShapeIntersection::SphereBatch m_sphereBatch;
+        std::vector<uint32_t> m_batchMask;
     };
 
     BENCHMARK_F(BM_MathShapeIntersection, ContainsFrustumPoint)(benchmark::State& state)
@@ -168,6 +197,51 @@ namespace Benchmark
             }
         }
     }
+
+    BENCHMARK_F(BM_MathShapeIntersection, OverlapsBatchFrustumSphere)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::ShapeIntersection::OverlapsBatch(frustum1, m_sphereBatch, m_batchMask.data());
+            benchmark::DoNotOptimize(m_batchMask.data());
+
+            AZ::ShapeIntersection::OverlapsBatch(frustum2, m_sphereBatch, m_batchMask.data());
+            benchmark::DoNotOptimize(m_batchMask.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathShapeIntersection, OverlapsBatchFrustumAabb)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::ShapeIntersection::OverlapsBatch(frustum1, m_aabbBatch, m_batchMask.data());
+            benchmark::DoNotOptimize(m_batchMask.data());
+
+            AZ::ShapeIntersection::OverlapsBatch(frustum2, m_aabbBatch, m_batchMask.data());
+            benchmark::DoNotOptimize(m_batchMask.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathShapeIntersection, OverlapsAabbAabb)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (auto& testData : m_testDataArray)
+            {
+                bool result = AZ::ShapeIntersection::Overlaps(m_testDataArray[0].aabb, testData.aabb);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathShapeIntersection, OverlapsBatchAabbAabb)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::ShapeIntersection::OverlapsBatch(m_testDataArray[0].aabb, m_aabbBatch, m_batchMask.data());
+            benchmark::DoNotOptimize(m_batchMask.data());
+        }
+    }
 }
 
 #endif
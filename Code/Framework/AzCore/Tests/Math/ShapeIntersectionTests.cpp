@@ -11,6 +11,8 @@
 #include <AzCore/Math/Frustum.h>
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/containers/vector.h>
+#include <random>
 
 namespace UnitTest
 {
@@ -145,4 +147,116 @@ namespace UnitTest
             EXPECT_FALSE(AZ::ShapeIntersection::Overlaps(frustum, obb1));
         }
     }
+
+    class MATH_ShapeIntersectionBatch
+        : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            // An odd count exercises both the four-wide path and the remainder path
+            constexpr size_t BoundsCount = 1003;
+
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> unif(-100.0f, 100.0f);
+            for (size_t i = 0; i < BoundsCount; ++i)
+            {
+                const AZ::Vector3 center(unif(rng), unif(rng), unif(rng));
+                const AZ::Vector3 halfExtents = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 0.1f;
+                const AZ::Aabb aabb = AZ::Aabb::CreateCenterHalfExtents(center, halfExtents);
+                m_aabbs.push_back(aabb);
+                m_minX.push_back(aabb.GetMin().GetX());
+                m_minY.push_back(aabb.GetMin().GetY());
+                m_minZ.push_back(aabb.GetMin().GetZ());
+                m_maxX.push_back(aabb.GetMax().GetX());
+                m_maxY.push_back(aabb.GetMax().GetY());
+                m_maxZ.push_back(aabb.GetMax().GetZ());
+
+                m_spheres.push_back(AZ::Sphere(center, halfExtents.GetX()));
+                m_centerX.push_back(center.GetX());
+                m_centerY.push_back(center.GetY());
+                m_centerZ.push_back(center.GetZ());
+                m_radius.push_back(halfExtents.GetX());
+            }
+
+            m_aabbBatch = { m_minX.data(), m_minY.data(), m_minZ.data(), m_maxX.data(), m_maxY.data(), m_maxZ.data(), BoundsCount };
+            m_sphereBatch = { m_centerX.data(), m_centerY.data(), m_centerZ.data(), m_radius.data(), BoundsCount };
+            m_mask.resize(AZ::ShapeIntersection::GetBatchMaskSize(BoundsCount));
+
+            const AZ::Plane nearPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.0f, 1.0f, 0.0f), AZ::Vector3(0.0f, -50.0f, 0.0f));
+            const AZ::Plane farPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.0f, -1.0f, 0.0f), AZ::Vector3(0.0f, 60.0f, 0.0f));
+            const AZ::Plane leftPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(1.0f, 0.3f, 0.0f).GetNormalized(), AZ::Vector3(-40.0f, 0.0f, 0.0f));
+            const AZ::Plane rightPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(-1.0f, 0.3f, 0.0f).GetNormalized(), AZ::Vector3(40.0f, 0.0f, 0.0f));
+            const AZ::Plane topPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.0f, 0.3f, -1.0f).GetNormalized(), AZ::Vector3(0.0f, 0.0f, 40.0f));
+            const AZ::Plane bottomPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.0f, 0.3f, 1.0f).GetNormalized(), AZ::Vector3(0.0f, 0.0f, -40.0f));
+            m_frustum = AZ::Frustum(nearPlane, farPlane, leftPlane, rightPlane, topPlane, bottomPlane);
+        }
+
+        bool IsBitSet(size_t index) const
+        {
+            return ((m_mask[index / 32] >> (index % 32)) & 1) != 0;
+        }
+
+        template <typename ExpectedFunction>
+        void ValidateMask(const ExpectedFunction& expected) const
+        {
+            size_t overlapCount = 0;
+            for (size_t i = 0; i < m_aabbs.size(); ++i)
+            {
+                EXPECT_EQ(IsBitSet(i), expected(i)) << "Mismatch at index " << i;
+                overlapCount += expected(i) ? 1 : 0;
+            }
+
+            // Make sure the test data actually covers both outcomes
+            EXPECT_GT(overlapCount, 0);
+            EXPECT_LT(overlapCount, m_aabbs.size());
+
+            // Bits past the end of the batch must be cleared
+            const size_t count = m_aabbs.size();
+            EXPECT_EQ(m_mask.back() >> (count % 32), 0);
+        }
+
+        AZStd::vector<AZ::Aabb> m_aabbs;
+        AZStd::vector<AZ::Sphere> m_spheres;
+        AZStd::vector<float> m_minX, m_minY, m_minZ, m_maxX, m_maxY, m_maxZ;
+        AZStd::vector<float> m_centerX, m_centerY, m_centerZ, m_radius;
+        AZ::ShapeIntersection::AabbBatch m_aabbBatch;
+        AZ::ShapeIntersection::SphereBatch m_sphereBatch;
+        AZStd::vector<uint32_t> m_mask;
+        AZ::Frustum m_frustum;
+    };
+
+    TEST_F(MATH_ShapeIntersectionBatch, OverlapsBatchAabbAabb_MatchesOverlaps)
+    {
+        const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-30.0f), AZ::Vector3(40.0f));
+        AZ::ShapeIntersection::OverlapsBatch(aabb, m_aabbBatch, m_mask.data());
+        ValidateMask([this, &aabb](size_t index) { return AZ::ShapeIntersection::Overlaps(aabb, m_aabbs[index]); });
+    }
+
+    TEST_F(MATH_ShapeIntersectionBatch, OverlapsBatchSphereAabb_MatchesOverlaps)
+    {
+        const AZ::Sphere sphere(AZ::Vector3(10.0f), 35.0f);
+        AZ::ShapeIntersection::OverlapsBatch(sphere, m_aabbBatch, m_mask.data());
+        ValidateMask([this, &sphere](size_t index) { return AZ::ShapeIntersection::Overlaps(sphere, m_aabbs[index]); });
+    }
+
+    TEST_F(MATH_ShapeIntersectionBatch, OverlapsBatchFrustumAabb_MatchesOverlaps)
+    {
+        AZ::ShapeIntersection::OverlapsBatch(m_frustum, m_aabbBatch, m_mask.data());
+        ValidateMask([this](size_t index) { return AZ::ShapeIntersection::Overlaps(m_frustum, m_aabbs[index]); });
+    }
+
+    TEST_F(MATH_ShapeIntersectionBatch, OverlapsBatchFrustumSphere_MatchesOverlaps)
+    {
+        AZ::ShapeIntersection::OverlapsBatch(m_frustum, m_sphereBatch, m_mask.data());
+        ValidateMask([this](size_t index) { return AZ::ShapeIntersection::Overlaps(m_frustum, m_spheres[index]); });
+    }
+
+    TEST(MATH_ShapeIntersection, OverlapsBatch_EmptyBatch_WritesNothing)
+    {
+        uint32_t mask = 0xFFFFFFFF;
+        AZ::ShapeIntersection::AabbBatch emptyBatch;
+        AZ::ShapeIntersection::OverlapsBatch(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(1.0f)), emptyBatch, &mask);
+        EXPECT_EQ(mask, 0xFFFFFFFF);
+    }
 }
@@ -48,14 +48,29 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static size_t GetEntryCount()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            AZ::NameDictionary& dictionary = AZ::NameDictionary::Instance();
+            AZStd::scoped_lock<AZStd::mutex> lock(dictionary.m_mutex);
+            return dictionary.m_entryCount;
         }
-        
-        static size_t GetEntryCount()
+
+        //! Searches the dictionary entries directly for a name, rather than going through the hash lookup
+        static bool ContainsName(AZStd::string_view name)
         {
-            return GetDictionary().size();
+            AZ::NameDictionary& dictionary = AZ::NameDictionary::Instance();
+            AZStd::scoped_lock<AZStd::mutex> lock(dictionary.m_mutex);
+
+            const AZ::NameDictionary::EntryTable& table = *dictionary.m_table.load();
+            for (size_t i = 0; i < table.m_capacity; ++i)
+            {
+                const AZ::Internal::NameData* nameData = table.m_slots[i].load();
+                if (AZ::NameDictionary::EntryTable::IsLiveEntry(nameData) && nameData->GetName() == name)
+                {
+                    return true;
+                }
+            }
+            return false;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -280,11 +295,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
-                return entry.second->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::ContainsName(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -846,3 +857,136 @@ namespace UnitTest
     }
 }
 
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class NameDictionaryBenchmarkEnvironment
+        : public UnitTest::AllocatorsBase
+    {
+    public:
+        static constexpr size_t ExistingNameCount = 1000;
+
+        NameDictionaryBenchmarkEnvironment()
+        {
+            SetupAllocator();
+            AZ::NameDictionary::Create();
+
+            m_existingNames.reserve(ExistingNameCount);
+            m_existingNameStrings.reserve(ExistingNameCount);
+            for (size_t i = 0; i < ExistingNameCount; ++i)
+            {
+                m_existingNameStrings.push_back(AZStd::string::format("ExistingName%zu", i));
+                m_existingNames.push_back(AZ::Name(m_existingNameStrings.back()));
+            }
+        }
+
+        ~NameDictionaryBenchmarkEnvironment()
+        {
+            m_existingNames = {};
+            m_existingNameStrings = {};
+
+            AZ::NameDictionary::Destroy();
+            TeardownAllocator();
+        }
+
+        AZStd::vector<AZ::Name> m_existingNames;
+        AZStd::vector<AZStd::string> m_existingNameStrings;
+    };
+
+    static AZStd::unique_ptr<NameDictionaryBenchmarkEnvironment> s_nameBenchmarkEnvironment;
+
+    static void SetUpNameBenchmark(const ::benchmark::State& state)
+    {
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment = AZStd::make_unique<NameDictionaryBenchmarkEnvironment>();
+        }
+    }
+
+    static void TearDownNameBenchmark(const ::benchmark::State& state)
+    {
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment.reset();
+        }
+    }
+
+    // Constructs names from strings that already exist in the dictionary, which is the most common case
+    static void BM_Name_CreateExistingName(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state);
+
+        size_t index = state.thread_index;
+        for (auto _ : state)
+        {
+            const AZStd::string& nameString = s_nameBenchmarkEnvironment->m_existingNameStrings[index];
+            AZ::Name name(nameString);
+            benchmark::DoNotOptimize(name.GetHash());
+            index = (index + 1) % NameDictionaryBenchmarkEnvironment::ExistingNameCount;
+        }
+
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_CreateExistingName)->ThreadRange(1, 16)->UseRealTime();
+
+    // Repeatedly constructs the same small set of names, as is typical for names used in a hot loop
+    static void BM_Name_CreateHotName(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state);
+
+        constexpr size_t HotNameCount = 4;
+        size_t index = 0;
+        for (auto _ : state)
+        {
+            const AZStd::string& nameString = s_nameBenchmarkEnvironment->m_existingNameStrings[index];
+            AZ::Name name(nameString);
+            benchmark::DoNotOptimize(name.GetHash());
+            index = (index + 1) % HotNameCount;
+        }
+
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_CreateHotName)->ThreadRange(1, 16)->UseRealTime();
+
+    static void BM_Name_CreateFromHash(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state);
+
+        size_t index = state.thread_index;
+        for (auto _ : state)
+        {
+            AZ::Name name(s_nameBenchmarkEnvironment->m_existingNames[index].GetHash());
+            benchmark::DoNotOptimize(name.GetHash());
+            index = (index + 1) % NameDictionaryBenchmarkEnvironment::ExistingNameCount;
+        }
+
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_CreateFromHash)->ThreadRange(1, 16)->UseRealTime();
+
+    // Each thread adds and releases its own names, which exercises insertion and removal from the dictionary
+    static void BM_Name_CreateAndReleaseNewName(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state);
+
+        AZStd::vector<AZStd::string> nameStrings;
+        for (size_t i = 0; i < 64; ++i)
+        {
+            nameStrings.push_back(AZStd::string::format("Thread%dName%zu", state.thread_index, i));
+        }
+
+        size_t index = 0;
+        for (auto _ : state)
+        {
+            AZ::Name name(nameStrings[index]);
+            benchmark::DoNotOptimize(name.GetHash());
+            index = (index + 1) % nameStrings.size();
+        }
+
+        nameStrings = {};
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_CreateAndReleaseNewName)->ThreadRange(1, 16)->UseRealTime();
+}
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    static float AddFloat(float lhs, float rhs)
+    {
+        return lhs + rhs;
+    }
+
+    // float(float, double) has no fast call, so this is bound through the generic LuaScriptCaller path
+    static float AddFloatGeneric(float lhs, double rhs)
+    {
+        return lhs + static_cast<float>(rhs);
+    }
+
+    // pointers don't have a fast call either, this does the same work as Vector3:Dot through the generic path
+    static float DotGeneric(const AZ::Vector3* lhs, const AZ::Vector3* rhs)
+    {
+        return lhs->Dot(*rhs);
+    }
+
+    //! Measures the overhead of calling BehaviorContext methods from Lua. Every benchmark runs a Lua loop making
+    //! CallsPerIteration calls, the fast and generic variants of a call do the same work.
+    class ScriptCallBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_behavior = aznew AZ::BehaviorContext();
+            AZ::MathReflect(m_behavior);
+            m_behavior->Method("AddFloat", &AddFloat);
+            m_behavior->Method("AddFloatGeneric", &AddFloatGeneric);
+            m_behavior->Method("DotGeneric", &DotGeneric);
+
+            m_script = aznew AZ::ScriptContext();
+            m_script->BindTo(m_behavior);
+            m_script->Execute(R"LUA(
+                function RunAddFloat(count)
+                    local sum = 0
+                    for i = 1, count do sum = AddFloat(sum, 1) end
+                    return sum
+                end
+                function RunAddFloatGeneric(count)
+                    local sum = 0
+                    for i = 1, count do sum = AddFloatGeneric(sum, 1) end
+                    return sum
+                end
+                function RunMathSqrt(count)
+                    local sum = 0
+                    for i = 1, count do sum = sum + Math.Sqrt(i) end
+                    return sum
+                end
+                function RunVector3Dot(count)
+                    local v1 = Vector3(1, 2, 3)
+                    local v2 = Vector3(4, 5, 6)
+                    local sum = 0
+                    for i = 1, count do sum = sum + v1:Dot(v2) end
+                    return sum
+                end
+                function RunVector3DotGeneric(count)
+                    local v1 = Vector3(1, 2, 3)
+                    local v2 = Vector3(4, 5, 6)
+                    local sum = 0
+                    for i = 1, count do sum = sum + DotGeneric(v1, v2) end
+                    return sum
+                end
+                function RunVector3Cross(count)
+                    local v1 = Vector3(1, 2, 3)
+                    local v2 = Vector3(4, 5, 6)
+                    for i = 1, count do v1 = v1:Cross(v2) end
+                    return v1
+                end
+            )LUA");
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            delete m_script;
+            delete m_behavior;
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunLuaLoop(benchmark::State& state, const char* functionName)
+        {
+            for (auto _ : state)
+            {
+                AZ::ScriptDataContext call;
+                if (m_script->Call(functionName, call))
+                {
+                    call.PushArg(CallsPerIteration);
+                    call.CallExecute();
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * CallsPerIteration);
+        }
+
+        static constexpr int CallsPerIteration = 1000;
+
+        AZ::BehaviorContext* m_behavior = nullptr;
+        AZ::ScriptContext* m_script = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(ScriptCallBenchmark, AddFloat)(benchmark::State& state)
+    {
+        RunLuaLoop(state, "RunAddFloat");
+    }
+    BENCHMARK_REGISTER_F(ScriptCallBenchmark, AddFloat)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(ScriptCallBenchmark, AddFloatGeneric)(benchmark::State& state)
+    {
+        RunLuaLoop(state, "RunAddFloatGeneric");
+    }
+    BENCHMARK_REGISTER_F(ScriptCallBenchmark, AddFloatGeneric)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(ScriptCallBenchmark, MathSqrt)(benchmark::State& state)
+    {
+        RunLuaLoop(state, "RunMathSqrt");
+    }
+    BENCHMARK_REGISTER_F(ScriptCallBenchmark, MathSqrt)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(ScriptCallBenchmark, Vector3Dot)(benchmark::State& state)
+    {
+        RunLuaLoop(state, "RunVector3Dot");
+    }
+    BENCHMARK_REGISTER_F(ScriptCallBenchmark, Vector3Dot)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(ScriptCallBenchmark, Vector3DotGeneric)(benchmark::State& state)
+    {
+        RunLuaLoop(state, "RunVector3DotGeneric");
+    }
+    BENCHMARK_REGISTER_F(ScriptCallBenchmark, Vector3DotGeneric)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(ScriptCallBenchmark, Vector3Cross)(benchmark::State& state)
+    {
+        RunLuaLoop(state, "RunVector3Cross");
+    }
+    BENCHMARK_REGISTER_F(ScriptCallBenchmark, Vector3Cross)->Unit(benchmark::kMicrosecond);
+}
+
+#endif
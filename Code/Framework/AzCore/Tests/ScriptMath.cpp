@@ -65,6 +65,11 @@ namespace UnitTest
             AllocatorsFixture::TearDown();
         }
 
+        static bool IsLuaFastCallClosure(lua_State* lua, int stackIndex)
+        {
+            return ScriptContext::IsLuaFastCallClosure(lua, stackIndex);
+        }
+
         BehaviorContext* behavior = nullptr;
         ScriptContext* script = nullptr;
     };
@@ -1854,4 +1859,80 @@ namespace UnitTest
             AZTestAssert(Math.IsClose(1.0, 5.0, 10.0))
 )LUA");
     }
+
+    TEST_F(ScriptMathTest, LuaFastCallTest)
+    {
+        // plain signatures are called through typed closures, the results must match the generic path
+        script->Execute(R"LUA(
+            AZTestAssertFloatClose(Math.Sqrt(16.0), 4.0)
+            AZTestAssertFloatClose(Math.Pow(2.0, 3.0), 8.0)
+            AZTestAssertFloatClose(Math.Clamp(5.0, 0.0, 1.0), 1.0)
+            AZTestAssert(Math.IsEven(4))
+            AZTestAssert(not Math.IsOdd(4))
+
+            v1 = Vector3(1, 2, 3)
+            v2 = Vector3(4, 5, 6)
+            AZTestAssertFloatClose(v1:Dot(v2), 32.0)
+            AZTestAssertFloatClose(v1:GetLengthSq(), 14.0)
+            AZTestAssertFloatClose(v1:GetElement(2), 3.0)
+            AZTestAssert(v1:IsClose(Vector3(1, 2, 3), 0.001))
+            AZTestAssert(not v1:IsZero(0.001))
+
+            vCross = v1:Cross(v2)
+            AZTestAssert(vCross:IsClose(Vector3(-3, 6, -3)))
+            vLerp = v1:Lerp(v2, 0.5)
+            AZTestAssert(vLerp:IsClose(Vector3(2.5, 3.5, 4.5)))
+
+            -- results are returned by value
+            vNormalized = v1:GetNormalized()
+            vNormalized:SetX(0)
+            AZTestAssertFloatClose(v1.x, 1.0)
+
+            -- non const methods change the object in place
+            v1:SetElement(0, 7)
+            AZTestAssertFloatClose(v1.x, 7.0)
+            v1:SetLength(2)
+            AZTestAssertFloatClose(v1:GetLength(), 2.0)
+            v1:Normalize()
+            AZTestAssert(v1:IsNormalized(0.001))
+)LUA");
+
+        // missing arguments are left to the generic path, which fills in the default values
+        script->Execute(R"LUA(
+            v3 = Vector3(1, 2, 3)
+            AZTestAssert(v3:IsClose(Vector3(1, 2, 3)))
+            AZTestAssert(not v3:IsZero())
+            AZTestAssert(Math.IsClose(3.0, 3.0))
+)LUA");
+
+        // the methods above are actually bound to the typed closures, while other signatures keep the generic caller
+        script->Execute(R"LUA(
+            mathSqrt = Math.Sqrt
+            vector3Dot = Vector3.Dot
+            vector3Cross = Vector3.Cross
+            testAssert = AZTestAssert
+)LUA");
+        lua_State* lua = script->NativeContext();
+        const auto isFastCallGlobal = [lua](const char* name)
+        {
+            lua_getglobal(lua, name);
+            EXPECT_TRUE(lua_iscfunction(lua, -1)) << name;
+            const bool isFastCall = IsLuaFastCallClosure(lua, -1);
+            lua_pop(lua, 1);
+            return isFastCall;
+        };
+        EXPECT_TRUE(isFastCallGlobal("mathSqrt"));
+        EXPECT_TRUE(isFastCallGlobal("vector3Dot"));
+        EXPECT_TRUE(isFastCallGlobal("vector3Cross"));
+        EXPECT_FALSE(isFastCallGlobal("testAssert"));
+
+        // arguments that don't hold exactly the expected type fall back to the generic path, which reports the error
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        script->Execute("Vector3.Dot(nil, Vector3(4, 5, 6))");
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        script->Execute("Vector3(1, 2, 3):Dot(Vector4(4, 5, 6, 7))");
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
 }
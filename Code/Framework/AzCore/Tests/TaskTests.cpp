@@ -9,6 +9,9 @@
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/functional.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -546,6 +549,172 @@ namespace UnitTest
         ev.Wait();
     }
 
+    TEST_F(TaskGraphTestFixture, SpawnChildGraph)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        auto a = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 0b111;
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 1;
+            });
+        auto c = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 2;
+
+                TaskGraph subgraph;
+                auto e = subgraph.AddTask(
+                    defaultTD,
+                    [&]
+                    {
+                        x ^= 0b1000;
+                    });
+                auto f = subgraph.AddTask(
+                    defaultTD,
+                    [&]
+                    {
+                        x ^= 0b10000;
+                    });
+                auto g = subgraph.AddTask(
+                    defaultTD,
+                    [&]
+                    {
+                        x += 0b1000;
+                    });
+                e.Precedes(g);
+                f.Precedes(g);
+                subgraph.Detach();
+                subgraph.SubmitAsChild();
+            });
+        auto d = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x -= 1;
+            });
+
+        // The subgraph spawned by c joins back into the parent graph before d
+        //   a  <-- Root
+        //  / \
+        // b   c - f
+        //  \   \   \
+        //   \   e - g
+        //    \     /
+        //     \   /
+        //      \ /
+        //       d
+
+        a.Precedes(b, c);
+        d.Follows(b, c);
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(3 | 0b100000, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, SpawnNestedChildGraphs)
+    {
+        // Each level fans out a data-dependent number of tasks, the last of which recurses another level
+        constexpr int depth = 4;
+        AZStd::atomic<int> count = 0;
+        AZStd::atomic<int> observed = 0;
+
+        AZStd::function<void(int)> spawn = [&](int level)
+        {
+            TaskGraph subgraph;
+            for (int i = 0; i != level + 1; ++i)
+            {
+                subgraph.AddTask(
+                    defaultTD,
+                    [&count, &spawn, level, i]
+                    {
+                        ++count;
+                        if (i == level && level + 1 < depth)
+                        {
+                            spawn(level + 1);
+                        }
+                    });
+            }
+            subgraph.Detach();
+            subgraph.SubmitAsChild();
+        };
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                spawn(0);
+            });
+        auto tail = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                observed = count.load();
+            });
+        root.Precedes(tail);
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        // 1 + 2 + 3 + 4 tasks spawned across all levels, all complete before the tail task runs
+        EXPECT_EQ(10, observed);
+    }
+
+    TEST_F(TaskGraphTestFixture, RetainedGraphWithChildGraph)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        auto a = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                TaskGraph subgraph;
+                for (int i = 0; i != 8; ++i)
+                {
+                    subgraph.AddTask(
+                        defaultTD,
+                        [&]
+                        {
+                            ++x;
+                        });
+                }
+                subgraph.Detach();
+                subgraph.SubmitAsChild();
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = x * 2;
+            });
+        a.Precedes(b);
+
+        for (int i = 0; i != 2; ++i)
+        {
+            x = 0;
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(16, x);
+        }
+    }
+
     TEST_F(TaskGraphTestFixture, RetainedGraph)
     {
         AZStd::atomic<int> x = 0;
@@ -622,6 +791,90 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, IdleWorkersStealFromBlockedWorker)
+    {
+        // With two workers, tasks are distributed round-robin and half of the short tasks below are queued
+        // behind the long task. Without work stealing, the long task would never observe them completing.
+        TaskExecutor executor{ 2 };
+
+        constexpr int shortTaskCount = 16;
+        AZStd::atomic<int> completed = 0;
+        AZStd::atomic<bool> allObserved = false;
+
+        TaskGraph graph;
+        graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                auto start = AZStd::chrono::system_clock::now();
+                while (completed < shortTaskCount)
+                {
+                    if (AZStd::chrono::system_clock::now() - start > AZStd::chrono::seconds{ 5 })
+                    {
+                        return;
+                    }
+                    AZStd::this_thread::yield();
+                }
+                allObserved = true;
+            });
+
+        for (int i = 0; i != shortTaskCount; ++i)
+        {
+            graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    ++completed;
+                });
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_TRUE(allObserved);
+        EXPECT_EQ(shortTaskCount, completed);
+    }
+
+    TEST_F(TaskGraphTestFixture, StolenTasksRespectDependencies)
+    {
+        TaskExecutor executor{ 4 };
+
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 1;
+            });
+        auto tail = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = x * 2;
+            });
+
+        for (int i = 0; i != 64; ++i)
+        {
+            auto middle = graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    x += 1;
+                });
+            root.Precedes(middle);
+            middle.Precedes(tail);
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(130, x);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -735,5 +988,40 @@ namespace Benchmark
             ev.Wait();
         }
     }
+
+    BENCHMARK_F(TaskGraphBenchmarkFixture, UnbalancedFanOut)(benchmark::State& state)
+    {
+        // A single long task submitted ahead of many short tasks. Idle workers are expected to steal the short
+        // tasks queued behind the long task, so the graph should complete in roughly the time of the long task.
+        graph->AddTask(
+            descriptors[2],
+            []
+            {
+                auto start = AZStd::chrono::system_clock::now();
+                while (AZStd::chrono::system_clock::now() - start < AZStd::chrono::microseconds{ 500 })
+                {
+                }
+            });
+
+        for (int i = 0; i != 256; ++i)
+        {
+            graph->AddTask(
+                descriptors[2],
+                []
+                {
+                    auto start = AZStd::chrono::system_clock::now();
+                    while (AZStd::chrono::system_clock::now() - start < AZStd::chrono::microseconds{ 10 })
+                    {
+                    }
+                });
+        }
+
+        for (auto _ : state)
+        {
+            TaskGraphEvent ev;
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
 } // namespace Benchmark
 #endif
@@ -55,6 +55,7 @@ set(FILES
     RemappableId.cpp
     Rtti.cpp
     Script.cpp
+    ScriptBenchmarks.cpp
     ScriptMath.cpp
     Serialization.cpp
     SerializeContextFixture.h
@@ -25,6 +25,7 @@
 
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
+#include <AzFramework/Asset/AssetCatalogImage.h>
 #include <AzFramework/Asset/AssetRegistry.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -171,10 +172,52 @@ namespace AzFramework
     // GetAssetPathByIdInternal
     //=========================================================================
     AZStd::string AssetCatalog::GetAssetPathByIdInternal(const AZ::Data::AssetId& id) const
+    {
+        return GetAssetInfoByIdInternal(id).m_relativePath;
+    }
+
+    //=========================================================================
+    // GetAssetInfoById
+    //=========================================================================
+    AZ::Data::AssetInfo AssetCatalog::GetAssetInfoById(const AZ::Data::AssetId& id)
+    {
+        return GetAssetInfoByIdInternal(id);
+    }
+
+    //=========================================================================
+    // GetAssetInfoByIdInternal
+    //=========================================================================
+    AZ::Data::AssetInfo AssetCatalog::GetAssetInfoByIdInternal(const AZ::Data::AssetId& id) const
     {
         if (!id.IsValid())
         {
-            return AZStd::string();
+            return AZ::Data::AssetInfo();
+        }
+
+        AZ::Data::AssetInfo assetInfo;
+        if (FindAssetInfoInternal(id, assetInfo))
+        {
+            return assetInfo;
+        }
+
+        // we did not find it - try the backup mapping!
+        AZ::Data::AssetId legacyMapping = GetAssetIdByLegacyAssetIdInternal(id);
+        if (legacyMapping.IsValid())
+        {
+            return GetAssetInfoByIdInternal(legacyMapping);
+        }
+
+        return AZ::Data::AssetInfo();
+    }
+
+    //=========================================================================
+    // FindAssetInfoInternal
+    //=========================================================================
+    bool AssetCatalog::FindAssetInfoInternal(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& outInfo) const
+    {
+        if (const AssetCatalogImage* image = m_lockFreeImage.load(AZStd::memory_order_acquire))
+        {
+            return image->GetAssetInfo(id, outInfo);
         }
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
@@ -182,53 +225,141 @@ namespace AzFramework
         auto foundIter = m_registry->m_assetIdToInfo.find(id);
         if (foundIter != m_registry->m_assetIdToInfo.end())
         {
-            return foundIter->second.m_relativePath;
+            outInfo = foundIter->second;
+            return true;
         }
 
-        // we did not find it - try the backup mapping!
-        AZ::Data::AssetId legacyMapping = m_registry->GetAssetIdByLegacyAssetId(id);
-        if (legacyMapping.IsValid())
+        return IsBaseImageEntryVisible(id) && m_baseImage->GetAssetInfo(id, outInfo);
+    }
+
+    //=========================================================================
+    // FindAssetDependenciesInternal
+    //=========================================================================
+    bool AssetCatalog::FindAssetDependenciesInternal(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& outDependencies) const
+    {
+        if (const AssetCatalogImage* image = m_lockFreeImage.load(AZStd::memory_order_acquire))
+        {
+            return image->GetAssetDependencies(id, outDependencies);
+        }
+
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+
+        auto foundIter = m_registry->m_assetDependencies.find(id);
+        if (foundIter != m_registry->m_assetDependencies.end())
         {
-            return GetAssetPathByIdInternal(legacyMapping);
+            outDependencies = foundIter->second;
+            return true;
         }
 
-        return AZStd::string();
+        return IsBaseImageEntryVisible(id) && m_baseImage->GetAssetDependencies(id, outDependencies);
     }
 
     //=========================================================================
-    // GetAssetInfoById
+    // GetAssetIdByPathInternal
     //=========================================================================
-    AZ::Data::AssetInfo AssetCatalog::GetAssetInfoById(const AZ::Data::AssetId& id)
+    AZ::Data::AssetId AssetCatalog::GetAssetIdByPathInternal(const char* assetPath) const
     {
-        return GetAssetInfoByIdInternal(id);
+        if (const AssetCatalogImage* image = m_lockFreeImage.load(AZStd::memory_order_acquire))
+        {
+            return image->GetAssetIdByPath(assetPath);
+        }
+
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+
+        AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(assetPath);
+        if (!foundId.IsValid() && m_baseImage)
+        {
+            // If the registry replaced the asset, the path in the image might not be the path of the asset anymore.
+            foundId = m_baseImage->GetAssetIdByPath(assetPath);
+            if (foundId.IsValid() && !IsBaseImageEntryVisible(foundId))
+            {
+                foundId = AZ::Data::AssetId();
+            }
+        }
+        return foundId;
     }
 
     //=========================================================================
-    // GetAssetInfoByIdInternal
+    // GetAssetIdByLegacyAssetIdInternal
     //=========================================================================
-    AZ::Data::AssetInfo AssetCatalog::GetAssetInfoByIdInternal(const AZ::Data::AssetId& id) const
+    AZ::Data::AssetId AssetCatalog::GetAssetIdByLegacyAssetIdInternal(const AZ::Data::AssetId& legacyAssetId) const
     {
-        if (!id.IsValid())
+        if (const AssetCatalogImage* image = m_lockFreeImage.load(AZStd::memory_order_acquire))
         {
-            return AZ::Data::AssetInfo();
+            return image->GetAssetIdByLegacyAssetId(legacyAssetId);
         }
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-        auto foundIter = m_registry->m_assetIdToInfo.find(id);
-        if (foundIter != m_registry->m_assetIdToInfo.end())
+        AZ::Data::AssetId foundId = m_registry->GetAssetIdByLegacyAssetId(legacyAssetId);
+        if (!foundId.IsValid() && m_baseImage && m_removedImageIds.find(legacyAssetId) == m_removedImageIds.end())
         {
-            return foundIter->second;
+            foundId = m_baseImage->GetAssetIdByLegacyAssetId(legacyAssetId);
         }
+        return foundId;
+    }
 
-        // we did not find it - try the backup mapping!
-        AZ::Data::AssetId legacyMapping = m_registry->GetAssetIdByLegacyAssetId(id);
-        if (legacyMapping.IsValid())
+    //=========================================================================
+    // IsBaseImageEntryVisible
+    //=========================================================================
+    bool AssetCatalog::IsBaseImageEntryVisible(const AZ::Data::AssetId& id) const
+    {
+        return m_baseImage &&
+            m_removedImageIds.find(id) == m_removedImageIds.end() &&
+            m_registry->m_assetIdToInfo.find(id) == m_registry->m_assetIdToInfo.end();
+    }
+
+    //=========================================================================
+    // DetachFromBaseImage
+    //=========================================================================
+    void AssetCatalog::DetachFromBaseImage(const AZ::Data::AssetId& id)
+    {
+        DisableLockFreeLookups();
+
+        AZStd::vector<AZ::Data::ProductDependency> dependencies;
+        if (IsBaseImageEntryVisible(id) &&
+            m_registry->m_assetDependencies.find(id) == m_registry->m_assetDependencies.end() &&
+            m_baseImage->GetAssetDependencies(id, dependencies))
         {
-            return GetAssetInfoByIdInternal(legacyMapping);
+            m_registry->m_assetDependencies.emplace(id, AZStd::move(dependencies));
         }
+    }
 
-        return AZ::Data::AssetInfo();
+    //=========================================================================
+    // DisableLockFreeLookups
+    //=========================================================================
+    void AssetCatalog::DisableLockFreeLookups()
+    {
+        // Readers that already loaded the image finish their lookup before the change, which is fine since
+        // the image itself is never modified or freed while the catalog is alive.
+        m_lockFreeImage.store(nullptr, AZStd::memory_order_release);
+    }
+
+    //=========================================================================
+    // SetBaseImage
+    //=========================================================================
+    void AssetCatalog::SetBaseImage(AZStd::unique_ptr<AssetCatalogImage> image)
+    {
+        DisableLockFreeLookups();
+        if (m_baseImage)
+        {
+            m_retiredImages.push_back(AZStd::move(m_baseImage));
+        }
+        m_baseImage = AZStd::move(image);
+        m_removedImageIds.clear();
+    }
+
+    //=========================================================================
+    // CreateMergedRegistry
+    //=========================================================================
+    AZStd::unique_ptr<AssetRegistry> AssetCatalog::CreateMergedRegistry() const
+    {
+        AZStd::unique_ptr<AssetRegistry> mergedRegistry = AZStd::make_unique<AssetRegistry>(*m_registry);
+        if (m_baseImage)
+        {
+            m_baseImage->CopyToRegistry(*mergedRegistry, m_removedImageIds);
+        }
+        return mergedRegistry;
     }
 
     //=========================================================================
@@ -243,16 +374,13 @@ namespace AzFramework
         m_pathBuffer = path;
         EBUS_EVENT(AzFramework::ApplicationRequests::Bus, MakePathAssetRootRelative, m_pathBuffer);
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-
-            AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(m_pathBuffer.c_str());
+            AZ::Data::AssetId foundId = GetAssetIdByPathInternal(m_pathBuffer.c_str());
             if (foundId.IsValid())
             {
-                const AZ::Data::AssetInfo& assetInfo = m_registry->m_assetIdToInfo.find(foundId)->second;
-
                 // If the type is already registered, but with no valid type, allow it to be re-registered.
                 // Otherwise, return the Id.
-                if (!autoRegisterIfNotFound || !assetInfo.m_assetType.IsNull())
+                AZ::Data::AssetInfo assetInfo;
+                if (!autoRegisterIfNotFound || (FindAssetInfoInternal(foundId, assetInfo) && !assetInfo.m_assetType.IsNull()))
                 {
                     return foundId;
                 }
@@ -281,6 +409,7 @@ namespace AzFramework
 
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+                DetachFromBaseImage(generatedID);
                 m_registry->RegisterAsset(generatedID, newInfo);
             }
 
@@ -302,21 +431,29 @@ namespace AzFramework
         {
             registeredAssetPaths.emplace_back(assetIdToInfoPair.second.m_relativePath);
         }
+        if (m_baseImage)
+        {
+            m_baseImage->EnumerateAssets([this, &registeredAssetPaths](const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& assetInfo)
+            {
+                if (IsBaseImageEntryVisible(id))
+                {
+                    registeredAssetPaths.emplace_back(assetInfo.m_relativePath);
+                }
+            });
+        }
 
         return registeredAssetPaths;
     }
 
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetDirectProductDependencies(const AZ::Data::AssetId& id)
     {
-        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-        auto itr = m_registry->m_assetDependencies.find(id);
-
-        if (itr == m_registry->m_assetDependencies.end())
+        AZStd::vector<AZ::Data::ProductDependency> dependencies;
+        if (!FindAssetDependenciesInternal(id, dependencies))
         {
             return AZ::Failure<AZStd::string>("Failed to find asset in dependency map");
         }
 
-        return AZ::Success(itr->second);
+        return AZ::Success(AZStd::move(dependencies));
     }
     
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetAllProductDependencies(const AZ::Data::AssetId& id)
@@ -420,13 +557,9 @@ namespace AzFramework
     {
         using namespace AZ::Data;
 
-        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-        auto itr = m_registry->m_assetDependencies.find(searchAssetId);
-
-        if (itr != m_registry->m_assetDependencies.end())
+        AZStd::vector<ProductDependency> assetDependencyList;
+        if (FindAssetDependenciesInternal(searchAssetId, assetDependencyList))
         {
-            AZStd::vector<ProductDependency>& assetDependencyList = itr->second;
-
             for (const ProductDependency& dependency : assetDependencyList)
             {
                 if (!dependency.m_assetId.IsValid())
@@ -502,6 +635,16 @@ namespace AzFramework
             {
                 enumerateCB(it.first, it.second);
             }
+            if (m_baseImage)
+            {
+                m_baseImage->EnumerateAssets([this, &enumerateCB](const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& assetInfo)
+                {
+                    if (IsBaseImageEntryVisible(id))
+                    {
+                        enumerateCB(id, assetInfo);
+                    }
+                });
+            }
         }
 
         if (endCB)
@@ -563,8 +706,52 @@ namespace AzFramework
                 }
             }
 
-            if (!bytes.empty())
+            if (!bytes.empty() && AssetCatalogImage::IsCatalogImage(bytes.data(), bytes.size()))
             {
+                AZStd::shared_ptr<AzFramework::AssetRegistry> prevRegistry;
+                if (!m_initialized)
+                {
+                    // First time initialization may have updates already processed which we want to apply
+                    prevRegistry = AZStd::move(m_registry);
+                    m_registry.reset(aznew AssetRegistry());
+                }
+
+                // Catalogs are reloaded from the same file whenever a delta catalog is removed, keep the image in that case
+                // so readers don't have to switch over to a copy of it.
+                bool isImageLoaded = m_baseImage && m_baseImage->HasSameData(bytes);
+                if (!isImageLoaded)
+                {
+                    AZStd::unique_ptr<AssetCatalogImage> image = AssetCatalogImage::Create(AZStd::move(bytes));
+                    isImageLoaded = image != nullptr;
+                    SetBaseImage(AZStd::move(image));
+                }
+
+                if (isImageLoaded)
+                {
+                    AZ_TracePrintf("AssetCatalog", "Loaded catalog image containing %zu assets.\n", m_baseImage->GetAssetCount());
+
+                    if (!m_initialized)
+                    {
+                        ApplyDeltaCatalog(prevRegistry);
+                        m_initialized = true;
+                    }
+
+                    if (m_registry->m_assetIdToInfo.empty() && m_registry->m_assetDependencies.empty() &&
+                        m_registry->m_assetPathToId.empty() && m_registry->m_legacyAssetIdToRealAssetId.empty() && m_removedImageIds.empty())
+                    {
+                        m_lockFreeImage.store(m_baseImage.get(), AZStd::memory_order_release);
+                    }
+                    shouldBroadcast = true;
+                }
+                else
+                {
+                    AZ_Error("AssetCatalog", false, "Unable to load the asset catalog image from %s!", catalogRegistryFile);
+                }
+            }
+            else if (!bytes.empty())
+            {
+                SetBaseImage(nullptr);
+
                 AZStd::shared_ptr < AzFramework::AssetRegistry> prevRegistry;
                 if (!m_initialized)
                 {
@@ -651,6 +838,7 @@ namespace AzFramework
         }
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            DetachFromBaseImage(id);
             m_registry->RegisterAsset(id, info);
         }
         EBUS_EVENT(AzFramework::AssetCatalogEventBus, OnCatalogAssetAdded, id);
@@ -671,6 +859,11 @@ namespace AzFramework
             });
 
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            if (m_baseImage)
+            {
+                DisableLockFreeLookups();
+                m_removedImageIds.insert(assetId);
+            }
             m_registry->UnregisterAsset(assetId);
         }
     }
@@ -799,8 +992,8 @@ namespace AzFramework
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
                 // is it an add or a change?
-                auto assetInfoPair = m_registry->m_assetIdToInfo.find(assetId);
-                isNewAsset = (assetInfoPair == m_registry->m_assetIdToInfo.end());
+                AZ::Data::AssetInfo existingInfo;
+                isNewAsset = !FindAssetInfoInternal(assetId, existingInfo);
 
     #if defined(AZ_ENABLE_TRACING)
                 if (message.m_assetType == AZ::Data::s_invalidAssetType)
@@ -809,7 +1002,7 @@ namespace AzFramework
                 }
     #endif
 
-                const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : assetInfoPair->second.m_assetType;
+                const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : existingInfo.m_assetType;
 
                 AZ::Data::AssetInfo newData;
                 newData.m_assetId = assetId;
@@ -817,6 +1010,7 @@ namespace AzFramework
                 newData.m_relativePath = message.m_data;
                 newData.m_sizeBytes = message.m_sizeBytes;
 
+                DetachFromBaseImage(assetId);
                 m_registry->RegisterAsset(assetId, newData);
                 m_registry->SetAssetDependencies(assetId, message.m_dependencies);
 
@@ -895,6 +1089,11 @@ namespace AzFramework
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
                 for (const auto& mapping : message.m_legacyAssetIds)
                 {
+                    if (m_baseImage)
+                    {
+                        DisableLockFreeLookups();
+                        m_removedImageIds.insert(mapping);
+                    }
                     m_registry->UnregisterLegacyAssetMapping(mapping);
                 }
             }
@@ -930,7 +1129,7 @@ namespace AzFramework
 #if defined(DEBUG_DUMP_CATALOG)
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-            for (auto& it : m_registry->m_assetIdToInfo)
+            for (auto& it : CreateMergedRegistry()->m_assetIdToInfo)
             {
                 AZ_TracePrintf("Asset Registry: AssetID->Info", "%s --> %s %llu bytes\n", it.first.ToString<AZStd::string>().c_str(), it.second.m_relativePath.c_str(), it.second.m_sizeBytes);
             }
@@ -968,6 +1167,9 @@ namespace AzFramework
         }
 
         ResetRegistry();
+
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+        SetBaseImage(nullptr);
     }
 
     //=========================================================================
@@ -977,7 +1179,10 @@ namespace AzFramework
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+        // The base image is kept, since it's most likely loaded again right after the reset.
+        DisableLockFreeLookups();
         m_registry->Clear();
+        m_removedImageIds.clear();
     }
 
 
@@ -1024,8 +1229,41 @@ namespace AzFramework
 
     AZStd::shared_ptr<AzFramework::AssetRegistry> AssetCatalog::LoadCatalogFromFile(const char* catalogFile) 
     {
+        // Delta catalogs can be stored as catalog images as well, those are expanded into a registry since they're applied on top
+        // of the registry anyway.  The file is read once, and the bytes are deserialized directly if it isn't an image.
+        AZStd::vector<char> bytes;
+        AZ::IO::FileIOStream catalogStream(catalogFile, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (catalogStream.IsOpen())
+        {
+            bytes.resize_no_construct(catalogStream.GetLength());
+            if (catalogStream.Read(bytes.size(), bytes.data()) != bytes.size())
+            {
+                bytes.clear();
+            }
+            catalogStream.Close();
+        }
+
+        if (bytes.empty())
+        {
+            AZ_Error("AssetCatalog", false, "Failed to read catalog %s", catalogFile);
+            return {};
+        }
+
         AZStd::shared_ptr<AzFramework::AssetRegistry> deltaCatalog;
-        deltaCatalog.reset(AZ::Utils::LoadObjectFromFile<AzFramework::AssetRegistry>(catalogFile));
+        if (AssetCatalogImage::IsCatalogImage(bytes.data(), bytes.size()))
+        {
+            AZStd::unique_ptr<AssetCatalogImage> image = AssetCatalogImage::Create(AZStd::move(bytes));
+            if (!image)
+            {
+                AZ_Error("AssetCatalog", false, "Failed to load catalog image %s", catalogFile);
+                return {};
+            }
+            deltaCatalog = AZStd::make_shared<AzFramework::AssetRegistry>();
+            image->CopyToRegistry(*deltaCatalog, {});
+            return deltaCatalog;
+        }
+
+        deltaCatalog.reset(AZ::Utils::LoadObjectFromBuffer<AzFramework::AssetRegistry>(bytes.data(), bytes.size()));
         if (!deltaCatalog)
         {
             AZ_Error("AssetCatalog", false, "Failed to load catalog %s", catalogFile);
@@ -1083,6 +1321,11 @@ namespace AzFramework
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+        DisableLockFreeLookups();
+        for (const auto& element : deltaCatalog->m_assetIdToInfo)
+        {
+            DetachFromBaseImage(element.first);
+        }
         m_registry->AddRegistry(deltaCatalog);
         return true;
     }
@@ -1113,7 +1356,11 @@ namespace AzFramework
         }
 
         ResetRegistry();
-        LoadBaseCatalogInternal();
+        if (!LoadBaseCatalogInternal())
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            SetBaseImage(nullptr);
+        }
 
         for (size_t catalogSlot = 0; catalogSlot < m_deltaCatalogList.size(); ++catalogSlot)
         {
@@ -1147,6 +1394,10 @@ namespace AzFramework
     bool AssetCatalog::SaveCatalog(const char* catalogRegistryFile)
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+        if (m_baseImage)
+        {
+            return SaveCatalog(catalogRegistryFile, CreateMergedRegistry().get());
+        }
         return SaveCatalog(catalogRegistryFile, m_registry.get());
     }
 
@@ -1226,7 +1477,7 @@ namespace AzFramework
         AZStd::vector<AZ::Data::AssetId> deltaPakAssetIds;
         for (const AZStd::string& file : files)
         {
-            AZ::Data::AssetId asset = m_registry->GetAssetIdByPath(file.c_str());
+            AZ::Data::AssetId asset = GetAssetIdByPathInternal(file.c_str());
             if (!asset.IsValid())
             {
                 // Asset is not listed in the registry, we can early out and fail as there should never be an asset that isn't in the registry.
@@ -1249,7 +1500,13 @@ namespace AzFramework
                 deltaRegistry.RegisterAssetDependency(asset, dependency);
             }            
         }
-        for (auto legacyToRealPair : m_registry->GetLegacyMappingSubsetFromRealIds(deltaPakAssetIds))
+        AzFramework::AssetRegistry::LegacyAssetIdToRealAssetIdMap legacyMappings;
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            legacyMappings = m_baseImage ? CreateMergedRegistry()->GetLegacyMappingSubsetFromRealIds(deltaPakAssetIds)
+                                         : m_registry->GetLegacyMappingSubsetFromRealIds(deltaPakAssetIds);
+        }
+        for (auto legacyToRealPair : legacyMappings)
         {
             deltaRegistry.RegisterLegacyAssetMapping(legacyToRealPair.first, legacyToRealPair.second);
         }
@@ -12,6 +12,7 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -23,9 +24,15 @@ namespace AzFramework
 {
     class AssetRegistry;
     class AssetBundleManifest;
+    class AssetCatalogImage;
 
     /*
      * An asset catalog keeps a registry of asset data information (file name, size, type, etc)
+     * When the base catalog is an AssetCatalogImage, the image is queried in place and the registry only holds the
+     * changes made on top of it (delta catalogs, registered and unregistered assets).
+     * Lookups only skip the registry lock while nothing is layered on top of the image. Once a delta catalog is added or an
+     * asset is registered or unregistered, lookups take the lock again until the catalog is reloaded without changes.
+     * Catalogs that are layered by design (bundles, editor asset updates) therefore keep the locked lookup cost.
      */
     class AssetCatalog 
         : public AZ::Data::AssetCatalog
@@ -130,6 +137,25 @@ namespace AzFramework
         AZStd::string GetAssetPathByIdInternal(const AZ::Data::AssetId& id) const;
         AZ::Data::AssetInfo GetAssetInfoByIdInternal(const AZ::Data::AssetId& id) const;
         bool DoesAssetIdMatchWildcardPatternInternal(const AZ::Data::AssetId& assetId, const AZStd::string& wildcardPattern) const;
+
+        // Lookups over the registry and the base catalog image, these don't follow legacy asset id mappings.
+        bool FindAssetInfoInternal(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& outInfo) const;
+        bool FindAssetDependenciesInternal(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& outDependencies) const;
+        AZ::Data::AssetId GetAssetIdByPathInternal(const char* assetPath) const;
+        AZ::Data::AssetId GetAssetIdByLegacyAssetIdInternal(const AZ::Data::AssetId& legacyAssetId) const;
+
+        // The following require m_registryMutex to be held.
+        // Returns true if the base catalog image entry of the asset hasn't been replaced or removed by the registry.
+        bool IsBaseImageEntryVisible(const AZ::Data::AssetId& id) const;
+        // Called before the registry changes an asset, copies the dependencies the image has for the asset into the registry
+        // since the registry entry of an asset hides its image entry.
+        void DetachFromBaseImage(const AZ::Data::AssetId& id);
+        // Called before the registry changes, readers have to take the lock from now on.
+        void DisableLockFreeLookups();
+        // Replaces the base catalog image, pass nullptr to remove it.
+        void SetBaseImage(AZStd::unique_ptr<AssetCatalogImage> image);
+        // Returns a copy of the registry with the visible entries of the base catalog image added to it.
+        AZStd::unique_ptr<AssetRegistry> CreateMergedRegistry() const;
     private:
 
         AZStd::atomic_bool m_shutdownThreadSignal;                  ///< Signals the monitoring thread to stop.
@@ -138,6 +164,16 @@ namespace AzFramework
         AZStd::unordered_set<AZStd::string> m_extensions;           ///< Valid asset extensions.
         mutable AZStd::recursive_mutex m_registryMutex;
         AZStd::unique_ptr<AssetRegistry> m_registry;
+        //! Base catalog that m_registry is layered on top of, can be null.
+        AZStd::unique_ptr<AssetCatalogImage> m_baseImage;
+        //! Images that were replaced, lock-free readers might still be using them so they're kept until the catalog is destroyed.
+        AZStd::vector<AZStd::unique_ptr<AssetCatalogImage>> m_retiredImages;
+        //! Asset and legacy asset ids of the base image that have been unregistered.
+        AZStd::unordered_set<AZ::Data::AssetId> m_removedImageIds;
+        //! Set to the base image while nothing has been layered on top of it, so lookups can read the image without locking.
+        //! There's no merged image for layered catalogs, images readers might still use can't be freed before the catalog
+        //! is destroyed, so one image per delta catalog change would keep growing memory in long sessions.
+        AZStd::atomic<const AssetCatalogImage*> m_lockFreeImage{ nullptr };
         AZStd::string m_pathBuffer;
         mutable AZStd::recursive_mutex m_baseCatalogNameMutex;
         AZStd::string m_baseCatalogName;
@@ -0,0 +1,671 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Asset/AssetCatalogImage.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/sort.h>
+
+namespace AzFramework
+{
+    namespace
+    {
+        // Asset ids are stored without the alignment of AZ::Uuid, so the records don't need any padding for it.
+        struct ImageAssetId
+        {
+            AZ::u8 m_guid[16];
+            AZ::u32 m_subId;
+        };
+    } // namespace
+
+    // The records are stored as they are in the image, so only fixed size members and explicit padding go in here,
+    // and Version needs to be updated when changing them.
+    struct AssetCatalogImage::AssetRecord
+    {
+        enum Flags : AZ::u32
+        {
+            HasInfo = 1 << 0,
+            HasDependencies = 1 << 1
+        };
+
+        ImageAssetId m_assetId;
+        AZ::u32 m_flags;
+        ImageAssetId m_infoAssetId;
+        AZ::u32 m_pathLength;
+        AZ::u8 m_assetType[16];
+        AZ::u64 m_sizeBytes;
+        AZ::u32 m_pathOffset;
+        AZ::u32 m_dependencyIndex;
+        AZ::u32 m_dependencyCount;
+        AZ::u32 m_padding;
+    };
+
+    struct AssetCatalogImage::DependencyRecord
+    {
+        ImageAssetId m_assetId;
+        AZ::u32 m_padding;
+        AZ::u64 m_flags;
+    };
+
+    struct AssetCatalogImage::PathRecord
+    {
+        AZ::u8 m_pathKey[16];
+        ImageAssetId m_assetId;
+    };
+
+    struct AssetCatalogImage::LegacyRecord
+    {
+        ImageAssetId m_legacyAssetId;
+        ImageAssetId m_assetId;
+    };
+
+    namespace
+    {
+        constexpr AZ::u32 InvalidRecord = 0xFFFFFFFF;
+
+        // Buckets hold a few keys on average, so that a bucket seed has to be stored for a fraction of the keys only.
+        constexpr AZ::u32 KeysPerBucket = 4;
+        // The number of seeds tried before giving up on placing a bucket in the current number of slots.
+        constexpr AZ::u32 MaxBucketSeed = 1 << 16;
+        // The number of times the slots are grown when buckets can't be placed.
+        constexpr AZ::u32 MaxBuildAttempts = 8;
+        constexpr size_t SectionAlignment = 8;
+
+        AZ::u64 MixHash(AZ::u64 value)
+        {
+            value ^= value >> 30;
+            value *= 0xBF58476D1CE4E5B9ull;
+            value ^= value >> 27;
+            value *= 0x94D049BB133111EBull;
+            value ^= value >> 31;
+            return value;
+        }
+
+        AZ::u64 HashKey(const AZ::u8* keyBytes, AZ::u32 keyExtra)
+        {
+            AZ::u64 low;
+            AZ::u64 high;
+            memcpy(&low, keyBytes, sizeof(low));
+            memcpy(&high, keyBytes + sizeof(low), sizeof(high));
+            return MixHash(low ^ MixHash(high ^ keyExtra));
+        }
+
+        AZ::u64 HashAssetId(const AZ::Data::AssetId& id)
+        {
+            return HashKey(id.m_guid.begin(), id.m_subId);
+        }
+
+        AZ::u32 GetBucket(AZ::u64 hash, AZ::u32 bucketCount)
+        {
+            return static_cast<AZ::u32>(hash % bucketCount);
+        }
+
+        AZ::u32 GetSlot(AZ::u64 hash, AZ::u32 seed, AZ::u32 slotCount)
+        {
+            return static_cast<AZ::u32>(MixHash(hash + (static_cast<AZ::u64>(seed) + 1) * 0x9E3779B97F4A7C15ull) % slotCount);
+        }
+
+        struct PerfectHashTable
+        {
+            AZStd::vector<AZ::u32> m_seeds;
+            AZStd::vector<AZ::u32> m_slots;
+        };
+
+        // Tries to find a seed for every bucket that moves all of its keys to free slots, largest buckets first.
+        bool PlaceBuckets(
+            const AZStd::vector<AZ::u64>& hashes, const AZStd::vector<AZStd::vector<AZ::u32>>& buckets,
+            const AZStd::vector<AZ::u32>& bucketOrder, AZ::u32 slotCount, PerfectHashTable& outTable)
+        {
+            outTable.m_seeds.assign(buckets.size(), 0);
+            outTable.m_slots.assign(slotCount, InvalidRecord);
+
+            AZStd::vector<AZ::u32> bucketSlots;
+            for (AZ::u32 bucketIndex : bucketOrder)
+            {
+                const AZStd::vector<AZ::u32>& bucket = buckets[bucketIndex];
+                if (bucket.empty())
+                {
+                    // Buckets are sorted by size, so all remaining buckets are empty as well.
+                    break;
+                }
+
+                bool placed = false;
+                for (AZ::u32 seed = 0; seed < MaxBucketSeed && !placed; ++seed)
+                {
+                    placed = true;
+                    bucketSlots.clear();
+                    for (AZ::u32 keyIndex : bucket)
+                    {
+                        const AZ::u32 slot = GetSlot(hashes[keyIndex], seed, slotCount);
+                        if (outTable.m_slots[slot] != InvalidRecord || AZStd::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+                        {
+                            placed = false;
+                            break;
+                        }
+                        bucketSlots.push_back(slot);
+                    }
+
+                    if (placed)
+                    {
+                        outTable.m_seeds[bucketIndex] = seed;
+                        for (size_t i = 0; i < bucket.size(); ++i)
+                        {
+                            outTable.m_slots[bucketSlots[i]] = bucket[i];
+                        }
+                    }
+                }
+
+                if (!placed)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool BuildPerfectHashTable(const AZStd::vector<AZ::u64>& hashes, PerfectHashTable& outTable)
+        {
+            const AZ::u32 keyCount = aznumeric_cast<AZ::u32>(hashes.size());
+            if (keyCount == 0)
+            {
+                outTable.m_seeds.clear();
+                outTable.m_slots.clear();
+                return true;
+            }
+
+            const AZ::u32 bucketCount = keyCount / KeysPerBucket + 1;
+            AZStd::vector<AZStd::vector<AZ::u32>> buckets(bucketCount);
+            for (AZ::u32 keyIndex = 0; keyIndex < keyCount; ++keyIndex)
+            {
+                buckets[GetBucket(hashes[keyIndex], bucketCount)].push_back(keyIndex);
+            }
+
+            AZStd::vector<AZ::u32> bucketOrder;
+            bucketOrder.reserve(bucketCount);
+            for (AZ::u32 bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+            {
+                bucketOrder.push_back(bucketIndex);
+            }
+            AZStd::sort(bucketOrder.begin(), bucketOrder.end(), [&buckets](AZ::u32 lhs, AZ::u32 rhs)
+            {
+                return buckets[lhs].size() != buckets[rhs].size() ? buckets[lhs].size() > buckets[rhs].size() : lhs < rhs;
+            });
+
+            // Start at a load factor of 80% and add slots whenever the buckets can't be placed.
+            AZ::u32 slotCount = keyCount + keyCount / 4 + 1;
+            for (AZ::u32 attempt = 0; attempt < MaxBuildAttempts; ++attempt)
+            {
+                if (PlaceBuckets(hashes, buckets, bucketOrder, slotCount, outTable))
+                {
+                    return true;
+                }
+                slotCount += slotCount / 8 + 1;
+            }
+            return false;
+        }
+
+        AZ::u64 AppendSection(AZStd::vector<AZ::u8>& data, const void* sectionData, size_t sectionSize)
+        {
+            const size_t offset = AZ_SIZE_ALIGN_UP(data.size(), SectionAlignment);
+            data.resize(offset + sectionSize, 0);
+            if (sectionSize > 0)
+            {
+                memcpy(data.data() + offset, sectionData, sectionSize);
+            }
+            return offset;
+        }
+    } // namespace
+
+    namespace
+    {
+        ImageAssetId ToImageAssetId(const AZ::Data::AssetId& id)
+        {
+            ImageAssetId imageId;
+            memcpy(imageId.m_guid, id.m_guid.begin(), sizeof(imageId.m_guid));
+            imageId.m_subId = id.m_subId;
+            return imageId;
+        }
+
+        AZ::Uuid ToUuid(const AZ::u8 (&bytes)[16])
+        {
+            AZ::Uuid uuid;
+            memcpy(uuid.begin(), bytes, sizeof(bytes));
+            return uuid;
+        }
+
+        AZ::Data::AssetId ToAssetId(const ImageAssetId& imageId)
+        {
+            return AZ::Data::AssetId(ToUuid(imageId.m_guid), imageId.m_subId);
+        }
+
+        bool IsSameAssetId(const ImageAssetId& imageId, const AZ::Data::AssetId& id)
+        {
+            return imageId.m_subId == id.m_subId && memcmp(imageId.m_guid, id.m_guid.begin(), sizeof(imageId.m_guid)) == 0;
+        }
+    } // namespace
+
+    AssetCatalogImage::AssetCatalogImage(AZStd::vector<char>&& data)
+        : m_data(AZStd::move(data))
+    {
+        memset(&m_header, 0, sizeof(m_header));
+        if (m_data.size() >= sizeof(m_header))
+        {
+            memcpy(&m_header, m_data.data(), sizeof(m_header));
+        }
+    }
+
+    bool AssetCatalogImage::IsCatalogImage(const void* data, size_t size)
+    {
+        AZ::u32 magic = 0;
+        if (!data || size < sizeof(ImageHeader))
+        {
+            return false;
+        }
+        memcpy(&magic, data, sizeof(magic));
+        return magic == Magic;
+    }
+
+    AZStd::unique_ptr<AssetCatalogImage> AssetCatalogImage::Create(AZStd::vector<char>&& data)
+    {
+        // The constructor is private, so make_unique can't be used.
+        AZStd::unique_ptr<AssetCatalogImage> image(aznew AssetCatalogImage(AZStd::move(data)));
+        if (!image->IsValid())
+        {
+            return nullptr;
+        }
+        return image;
+    }
+
+    bool AssetCatalogImage::IsValid() const
+    {
+        if (!IsCatalogImage(m_data.data(), m_data.size()))
+        {
+            return false;
+        }
+        if (m_header.m_version != Version)
+        {
+            AZ_Error("AssetCatalogImage", false, "Asset catalog image has version %u, expected version %u.", m_header.m_version, Version);
+            return false;
+        }
+
+        const AZ::u64 dataSize = m_data.size();
+        const bool isValid = IsTableValid(m_header.m_assets, sizeof(AssetRecord)) &&
+            IsTableValid(m_header.m_paths, sizeof(PathRecord)) &&
+            IsTableValid(m_header.m_legacyIds, sizeof(LegacyRecord)) &&
+            m_header.m_dependenciesOffset <= dataSize &&
+            static_cast<AZ::u64>(m_header.m_dependencyCount) * sizeof(DependencyRecord) <= dataSize - m_header.m_dependenciesOffset &&
+            m_header.m_stringsOffset <= dataSize &&
+            m_header.m_stringsSize <= dataSize - m_header.m_stringsOffset;
+        AZ_Error("AssetCatalogImage", isValid, "Asset catalog image is truncated or corrupted.");
+        return isValid;
+    }
+
+    bool AssetCatalogImage::IsTableValid(const TableHeader& table, size_t recordSize) const
+    {
+        if (table.m_recordCount > 0 && (table.m_bucketCount == 0 || table.m_slotCount < table.m_recordCount))
+        {
+            return false;
+        }
+
+        const AZ::u64 dataSize = m_data.size();
+        return table.m_seedsOffset <= dataSize &&
+            static_cast<AZ::u64>(table.m_bucketCount) * sizeof(AZ::u32) <= dataSize - table.m_seedsOffset &&
+            table.m_slotsOffset <= dataSize &&
+            static_cast<AZ::u64>(table.m_slotCount) * sizeof(AZ::u32) <= dataSize - table.m_slotsOffset &&
+            table.m_recordsOffset <= dataSize &&
+            static_cast<AZ::u64>(table.m_recordCount) * recordSize <= dataSize - table.m_recordsOffset;
+    }
+
+    bool AssetCatalogImage::Build(const AssetRegistry& registry, AZStd::vector<AZ::u8>& outData)
+    {
+        static_assert(sizeof(AssetRecord) == 88, "Unexpected size of the asset records of the image.");
+        static_assert(sizeof(DependencyRecord) == 32, "Unexpected size of the dependency records of the image.");
+        static_assert(sizeof(PathRecord) == 36, "Unexpected size of the path records of the image.");
+        static_assert(sizeof(LegacyRecord) == 40, "Unexpected size of the legacy records of the image.");
+
+        // Every asset with info or dependencies gets a single record, so both can be found with one lookup.
+        AZStd::vector<AZ::Data::AssetId> assetIds;
+        assetIds.reserve(registry.m_assetIdToInfo.size());
+        for (const auto& element : registry.m_assetIdToInfo)
+        {
+            assetIds.push_back(element.first);
+        }
+        for (const auto& element : registry.m_assetDependencies)
+        {
+            if (registry.m_assetIdToInfo.find(element.first) == registry.m_assetIdToInfo.end())
+            {
+                assetIds.push_back(element.first);
+            }
+        }
+
+        AZStd::vector<AssetRecord> assetRecords;
+        AZStd::vector<DependencyRecord> dependencyRecords;
+        AZStd::vector<char> strings;
+        AZStd::vector<AZ::u64> assetHashes;
+        assetRecords.reserve(assetIds.size());
+        assetHashes.reserve(assetIds.size());
+        for (const AZ::Data::AssetId& assetId : assetIds)
+        {
+            AssetRecord record;
+            memset(&record, 0, sizeof(record));
+            record.m_assetId = ToImageAssetId(assetId);
+
+            auto infoIter = registry.m_assetIdToInfo.find(assetId);
+            if (infoIter != registry.m_assetIdToInfo.end())
+            {
+                const AZ::Data::AssetInfo& assetInfo = infoIter->second;
+                record.m_flags |= AssetRecord::HasInfo;
+                record.m_infoAssetId = ToImageAssetId(assetInfo.m_assetId);
+                memcpy(record.m_assetType, assetInfo.m_assetType.begin(), sizeof(record.m_assetType));
+                record.m_sizeBytes = assetInfo.m_sizeBytes;
+                record.m_pathOffset = aznumeric_cast<AZ::u32>(strings.size());
+                record.m_pathLength = aznumeric_cast<AZ::u32>(assetInfo.m_relativePath.size());
+                strings.insert(strings.end(), assetInfo.m_relativePath.begin(), assetInfo.m_relativePath.end());
+            }
+
+            auto dependenciesIter = registry.m_assetDependencies.find(assetId);
+            if (dependenciesIter != registry.m_assetDependencies.end())
+            {
+                record.m_flags |= AssetRecord::HasDependencies;
+                record.m_dependencyIndex = aznumeric_cast<AZ::u32>(dependencyRecords.size());
+                record.m_dependencyCount = aznumeric_cast<AZ::u32>(dependenciesIter->second.size());
+                for (const AZ::Data::ProductDependency& dependency : dependenciesIter->second)
+                {
+                    DependencyRecord& dependencyRecord = dependencyRecords.emplace_back();
+                    memset(&dependencyRecord, 0, sizeof(dependencyRecord));
+                    dependencyRecord.m_assetId = ToImageAssetId(dependency.m_assetId);
+                    dependencyRecord.m_flags = dependency.m_flags.to_ullong();
+                }
+            }
+
+            assetRecords.push_back(record);
+            assetHashes.push_back(HashAssetId(assetId));
+        }
+
+        AZStd::vector<PathRecord> pathRecords;
+        AZStd::vector<AZ::u64> pathHashes;
+        pathRecords.reserve(registry.m_assetPathToId.size());
+        pathHashes.reserve(registry.m_assetPathToId.size());
+        for (const auto& element : registry.m_assetPathToId)
+        {
+            PathRecord& record = pathRecords.emplace_back();
+            memcpy(record.m_pathKey, element.first.begin(), sizeof(record.m_pathKey));
+            record.m_assetId = ToImageAssetId(element.second);
+            pathHashes.push_back(HashKey(record.m_pathKey, 0));
+        }
+
+        AZStd::vector<LegacyRecord> legacyRecords;
+        AZStd::vector<AZ::u64> legacyHashes;
+        legacyRecords.reserve(registry.m_legacyAssetIdToRealAssetId.size());
+        legacyHashes.reserve(registry.m_legacyAssetIdToRealAssetId.size());
+        for (const auto& element : registry.m_legacyAssetIdToRealAssetId)
+        {
+            LegacyRecord& record = legacyRecords.emplace_back();
+            record.m_legacyAssetId = ToImageAssetId(element.first);
+            record.m_assetId = ToImageAssetId(element.second);
+            legacyHashes.push_back(HashAssetId(element.first));
+        }
+
+        ImageHeader header;
+        memset(&header, 0, sizeof(header));
+        header.m_magic = Magic;
+        header.m_version = Version;
+
+        outData.clear();
+        outData.resize(sizeof(header), 0);
+
+        auto appendTable = [&outData](TableHeader& table, const AZStd::vector<AZ::u64>& hashes, const void* records, size_t recordSize)
+        {
+            PerfectHashTable hashTable;
+            if (!BuildPerfectHashTable(hashes, hashTable))
+            {
+                return false;
+            }
+            table.m_recordCount = aznumeric_cast<AZ::u32>(hashes.size());
+            table.m_bucketCount = aznumeric_cast<AZ::u32>(hashTable.m_seeds.size());
+            table.m_slotCount = aznumeric_cast<AZ::u32>(hashTable.m_slots.size());
+            table.m_seedsOffset = AppendSection(outData, hashTable.m_seeds.data(), hashTable.m_seeds.size() * sizeof(AZ::u32));
+            table.m_slotsOffset = AppendSection(outData, hashTable.m_slots.data(), hashTable.m_slots.size() * sizeof(AZ::u32));
+            table.m_recordsOffset = AppendSection(outData, records, hashes.size() * recordSize);
+            return true;
+        };
+
+        if (!appendTable(header.m_assets, assetHashes, assetRecords.data(), sizeof(AssetRecord)) ||
+            !appendTable(header.m_paths, pathHashes, pathRecords.data(), sizeof(PathRecord)) ||
+            !appendTable(header.m_legacyIds, legacyHashes, legacyRecords.data(), sizeof(LegacyRecord)))
+        {
+            AZ_Error("AssetCatalogImage", false, "Failed to build the lookup tables of the asset catalog image.");
+            outData.clear();
+            return false;
+        }
+
+        header.m_dependencyCount = aznumeric_cast<AZ::u32>(dependencyRecords.size());
+        header.m_dependenciesOffset = AppendSection(outData, dependencyRecords.data(), dependencyRecords.size() * sizeof(DependencyRecord));
+        header.m_stringsSize = aznumeric_cast<AZ::u32>(strings.size());
+        header.m_stringsOffset = AppendSection(outData, strings.data(), strings.size());
+
+        memcpy(outData.data(), &header, sizeof(header));
+        return true;
+    }
+
+    bool AssetCatalogImage::SaveToFile(const char* imageFile, const AssetRegistry& registry)
+    {
+        AZStd::vector<AZ::u8> data;
+        if (!Build(registry, data))
+        {
+            return false;
+        }
+
+        if (!AZ::Utils::SaveStreamToFile(imageFile, data))
+        {
+            AZ_Warning("AssetCatalogImage", false, "Failed to save asset catalog image %s", imageFile);
+            return false;
+        }
+        return true;
+    }
+
+    template<typename ValueType>
+    ValueType AssetCatalogImage::Read(AZ::u64 offset) const
+    {
+        // Sections of the image are aligned, but the image itself might not be, so copy instead of casting.
+        ValueType value;
+        memcpy(&value, m_data.data() + offset, sizeof(ValueType));
+        return value;
+    }
+
+    template<typename RecordType>
+    RecordType AssetCatalogImage::ReadRecord(const TableHeader& table, AZ::u32 recordIndex) const
+    {
+        return Read<RecordType>(table.m_recordsOffset + static_cast<AZ::u64>(recordIndex) * sizeof(RecordType));
+    }
+
+    AZ::u32 AssetCatalogImage::FindRecord(const TableHeader& table, AZ::u64 hash) const
+    {
+        if (table.m_recordCount == 0)
+        {
+            return InvalidRecord;
+        }
+
+        const AZ::u32 seed = Read<AZ::u32>(table.m_seedsOffset + static_cast<AZ::u64>(GetBucket(hash, table.m_bucketCount)) * sizeof(AZ::u32));
+        const AZ::u32 slot = GetSlot(hash, seed, table.m_slotCount);
+        const AZ::u32 recordIndex = Read<AZ::u32>(table.m_slotsOffset + static_cast<AZ::u64>(slot) * sizeof(AZ::u32));
+        return recordIndex < table.m_recordCount ? recordIndex : InvalidRecord;
+    }
+
+    bool AssetCatalogImage::FindAssetRecord(const AZ::Data::AssetId& id, AssetRecord& outRecord) const
+    {
+        const AZ::u32 recordIndex = FindRecord(m_header.m_assets, HashAssetId(id));
+        if (recordIndex == InvalidRecord)
+        {
+            return false;
+        }
+
+        outRecord = ReadRecord<AssetRecord>(m_header.m_assets, recordIndex);
+        return IsSameAssetId(outRecord.m_assetId, id);
+    }
+
+    size_t AssetCatalogImage::GetAssetCount() const
+    {
+        return m_header.m_assets.m_recordCount;
+    }
+
+    bool AssetCatalogImage::GetAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& outInfo) const
+    {
+        AssetRecord record;
+        if (!FindAssetRecord(id, record) || (record.m_flags & AssetRecord::HasInfo) == 0)
+        {
+            return false;
+        }
+
+        if (static_cast<AZ::u64>(record.m_pathOffset) + record.m_pathLength > m_header.m_stringsSize)
+        {
+            AZ_Error("AssetCatalogImage", false, "Asset %s has an invalid path in the asset catalog image.", id.ToString<AZStd::string>().c_str());
+            return false;
+        }
+
+        outInfo.m_assetId = ToAssetId(record.m_infoAssetId);
+        outInfo.m_assetType = ToUuid(record.m_assetType);
+        outInfo.m_sizeBytes = record.m_sizeBytes;
+        outInfo.m_relativePath.assign(m_data.data() + m_header.m_stringsOffset + record.m_pathOffset, record.m_pathLength);
+        return true;
+    }
+
+    bool AssetCatalogImage::GetAssetDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& outDependencies) const
+    {
+        AssetRecord record;
+        if (!FindAssetRecord(id, record) || (record.m_flags & AssetRecord::HasDependencies) == 0)
+        {
+            return false;
+        }
+
+        if (static_cast<AZ::u64>(record.m_dependencyIndex) + record.m_dependencyCount > m_header.m_dependencyCount)
+        {
+            AZ_Error("AssetCatalogImage", false, "Asset %s has invalid dependencies in the asset catalog image.", id.ToString<AZStd::string>().c_str());
+            return false;
+        }
+
+        outDependencies.clear();
+        outDependencies.reserve(record.m_dependencyCount);
+        for (AZ::u32 i = 0; i < record.m_dependencyCount; ++i)
+        {
+            const DependencyRecord dependencyRecord = Read<DependencyRecord>(
+                m_header.m_dependenciesOffset + static_cast<AZ::u64>(record.m_dependencyIndex + i) * sizeof(DependencyRecord));
+            outDependencies.emplace_back(ToAssetId(dependencyRecord.m_assetId), AZ::Data::ProductDependencyInfo::ProductDependencyFlags(dependencyRecord.m_flags));
+        }
+        return true;
+    }
+
+    AZ::Data::AssetId AssetCatalogImage::GetAssetIdByPath(const char* assetPath) const
+    {
+        if ((!assetPath) || (assetPath[0] == 0))
+        {
+            // the empty path has no asset ID.
+            return AZ::Data::AssetId();
+        }
+
+        const AZ::Uuid pathKey = AssetRegistryInternal::CreateUUIDForName(assetPath);
+        const AZ::u32 recordIndex = FindRecord(m_header.m_paths, HashKey(pathKey.begin(), 0));
+        if (recordIndex != InvalidRecord)
+        {
+            const PathRecord record = ReadRecord<PathRecord>(m_header.m_paths, recordIndex);
+            if (memcmp(record.m_pathKey, pathKey.begin(), sizeof(record.m_pathKey)) == 0)
+            {
+                return ToAssetId(record.m_assetId);
+            }
+        }
+        return AZ::Data::AssetId();
+    }
+
+    AZ::Data::AssetId AssetCatalogImage::GetAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const
+    {
+        const AZ::u32 recordIndex = FindRecord(m_header.m_legacyIds, HashAssetId(legacyAssetId));
+        if (recordIndex != InvalidRecord)
+        {
+            const LegacyRecord record = ReadRecord<LegacyRecord>(m_header.m_legacyIds, recordIndex);
+            if (IsSameAssetId(record.m_legacyAssetId, legacyAssetId))
+            {
+                return ToAssetId(record.m_assetId);
+            }
+        }
+        return AZ::Data::AssetId();
+    }
+
+    void AssetCatalogImage::EnumerateAssets(const AssetEnumerationCB& enumerateCB) const
+    {
+        AZ::Data::AssetInfo assetInfo;
+        for (AZ::u32 recordIndex = 0; recordIndex < m_header.m_assets.m_recordCount; ++recordIndex)
+        {
+            const AssetRecord record = ReadRecord<AssetRecord>(m_header.m_assets, recordIndex);
+            const AZ::Data::AssetId assetId = ToAssetId(record.m_assetId);
+            if (GetAssetInfo(assetId, assetInfo))
+            {
+                enumerateCB(assetId, assetInfo);
+            }
+        }
+    }
+
+    void AssetCatalogImage::CopyToRegistry(AssetRegistry& registry, const AZStd::unordered_set<AZ::Data::AssetId>& excludedIds) const
+    {
+        // Assets the registry already has info for replace their whole entry in the image, including the path.
+        AZStd::unordered_set<AZ::Data::AssetId> replacedIds;
+        for (const auto& element : registry.m_assetIdToInfo)
+        {
+            replacedIds.insert(element.first);
+        }
+
+        AZ::Data::AssetInfo assetInfo;
+        AZStd::vector<AZ::Data::ProductDependency> dependencies;
+        for (AZ::u32 recordIndex = 0; recordIndex < m_header.m_assets.m_recordCount; ++recordIndex)
+        {
+            const AssetRecord record = ReadRecord<AssetRecord>(m_header.m_assets, recordIndex);
+            const AZ::Data::AssetId assetId = ToAssetId(record.m_assetId);
+            if (excludedIds.find(assetId) != excludedIds.end() || replacedIds.find(assetId) != replacedIds.end())
+            {
+                continue;
+            }
+
+            if (GetAssetInfo(assetId, assetInfo))
+            {
+                registry.m_assetIdToInfo.emplace(assetId, assetInfo);
+            }
+            if (registry.m_assetDependencies.find(assetId) == registry.m_assetDependencies.end() && GetAssetDependencies(assetId, dependencies))
+            {
+                registry.m_assetDependencies.emplace(assetId, dependencies);
+            }
+        }
+
+        for (AZ::u32 recordIndex = 0; recordIndex < m_header.m_paths.m_recordCount; ++recordIndex)
+        {
+            const PathRecord record = ReadRecord<PathRecord>(m_header.m_paths, recordIndex);
+            const AZ::Data::AssetId assetId = ToAssetId(record.m_assetId);
+            if (excludedIds.find(assetId) == excludedIds.end() && replacedIds.find(assetId) == replacedIds.end())
+            {
+                registry.m_assetPathToId.emplace(ToUuid(record.m_pathKey), assetId);
+            }
+        }
+
+        for (AZ::u32 recordIndex = 0; recordIndex < m_header.m_legacyIds.m_recordCount; ++recordIndex)
+        {
+            const LegacyRecord record = ReadRecord<LegacyRecord>(m_header.m_legacyIds, recordIndex);
+            const AZ::Data::AssetId legacyAssetId = ToAssetId(record.m_legacyAssetId);
+            if (excludedIds.find(legacyAssetId) == excludedIds.end())
+            {
+                registry.m_legacyAssetIdToRealAssetId.emplace(legacyAssetId, ToAssetId(record.m_assetId));
+            }
+        }
+    }
+
+    bool AssetCatalogImage::HasSameData(const AZStd::vector<char>& data) const
+    {
+        return data.size() == m_data.size() && memcmp(data.data(), m_data.data(), data.size()) == 0;
+    }
+} // namespace AzFramework
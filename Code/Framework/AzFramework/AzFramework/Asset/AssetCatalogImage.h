@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzFramework
+{
+    class AssetRegistry;
+
+    /**
+    * Immutable binary image of an asset registry that is queried in place.
+    * The image is made of flat record arrays with a perfect hash table for each kind of lookup (asset id, asset path
+    * and legacy asset id), so loading it doesn't need to deserialize or allocate per asset, and lookups are a couple
+    * of reads into the image. Since the image never changes after it's created, it can be read from any thread without locking.
+    * Offsets in the image are relative to its start, so the image can be used from any memory it's loaded to.
+    * The image is stored in native byte order.
+    */
+    class AssetCatalogImage
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AssetCatalogImage, AZ::SystemAllocator, 0);
+
+        using AssetEnumerationCB = AZStd::function<void(const AZ::Data::AssetId&, const AZ::Data::AssetInfo&)>;
+
+        static constexpr AZ::u32 Magic = 0x49434641; // 'AFCI'
+        static constexpr AZ::u32 Version = 1;
+
+        //! Returns true if the data starts with the header of an asset catalog image.
+        static bool IsCatalogImage(const void* data, size_t size);
+
+        //! Creates an image from data previously built with Build, taking ownership of the data.
+        //! Returns nullptr if the data isn't a valid image.
+        static AZStd::unique_ptr<AssetCatalogImage> Create(AZStd::vector<char>&& data);
+
+        //! Builds the image data for the contents of an asset registry.
+        static bool Build(const AssetRegistry& registry, AZStd::vector<AZ::u8>& outData);
+
+        //! Builds the image for the contents of an asset registry and writes it to a file.
+        static bool SaveToFile(const char* imageFile, const AssetRegistry& registry);
+
+        size_t GetAssetCount() const;
+
+        bool GetAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& outInfo) const;
+
+        //! Returns false if no dependencies were registered for the asset, which is different from the asset having no dependencies.
+        bool GetAssetDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& outDependencies) const;
+
+        //! LEGACY - see AssetRegistry::GetAssetIdByPath.
+        AZ::Data::AssetId GetAssetIdByPath(const char* assetPath) const;
+
+        AZ::Data::AssetId GetAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const;
+
+        void EnumerateAssets(const AssetEnumerationCB& enumerateCB) const;
+
+        //! Adds the contents of the image to an asset registry, keeping the entries the registry already has.
+        //! Assets the registry has info for are skipped entirely, since the registry entry replaces the image entry.
+        //! @param excludedIds Asset ids to leave out of the copy, as asset or as legacy asset id.
+        void CopyToRegistry(AssetRegistry& registry, const AZStd::unordered_set<AZ::Data::AssetId>& excludedIds) const;
+
+        //! Returns true if the image was created from the same data.
+        bool HasSameData(const AZStd::vector<char>& data) const;
+
+    private:
+        struct AssetRecord;
+        struct DependencyRecord;
+        struct PathRecord;
+        struct LegacyRecord;
+
+        struct TableHeader
+        {
+            AZ::u32 m_recordCount;
+            AZ::u32 m_bucketCount;
+            AZ::u32 m_slotCount;
+            AZ::u32 m_padding;
+            AZ::u64 m_seedsOffset;
+            AZ::u64 m_slotsOffset;
+            AZ::u64 m_recordsOffset;
+        };
+
+        struct ImageHeader
+        {
+            AZ::u32 m_magic;
+            AZ::u32 m_version;
+            AZ::u32 m_dependencyCount;
+            AZ::u32 m_stringsSize;
+            AZ::u64 m_dependenciesOffset;
+            AZ::u64 m_stringsOffset;
+            TableHeader m_assets;
+            TableHeader m_paths;
+            TableHeader m_legacyIds;
+        };
+
+        explicit AssetCatalogImage(AZStd::vector<char>&& data);
+
+        bool IsValid() const;
+        bool IsTableValid(const TableHeader& table, size_t recordSize) const;
+
+        //! Returns the index of the record the hash maps to, the caller still needs to compare the key of the record.
+        AZ::u32 FindRecord(const TableHeader& table, AZ::u64 hash) const;
+        bool FindAssetRecord(const AZ::Data::AssetId& id, AssetRecord& outRecord) const;
+
+        template<typename RecordType>
+        RecordType ReadRecord(const TableHeader& table, AZ::u32 recordIndex) const;
+
+        template<typename ValueType>
+        ValueType Read(AZ::u64 offset) const;
+
+        AZStd::vector<char> m_data;
+        ImageHeader m_header;
+    };
+} // namespace AzFramework
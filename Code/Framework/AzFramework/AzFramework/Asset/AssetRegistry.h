@@ -15,6 +15,12 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
+namespace AssetRegistryInternal
+{
+    //! Creates the key that asset paths are looked up by, the path is normalized so the key doesn't depend on case or slash direction.
+    AZ::Uuid CreateUUIDForName(const char* name);
+}
+
 namespace AzFramework
 {
     /**
@@ -24,6 +30,7 @@ namespace AzFramework
     class AssetRegistry
     {
         friend class AssetCatalog;
+        friend class AssetCatalogImage;
     public:
         AZ_TYPE_INFO(AssetRegistry, "{5DBC20D9-7143-48B3-ADEE-CCBD2FA6D443}");
         AZ_CLASS_ALLOCATOR(AssetRegistry, AZ::SystemAllocator, 0);
@@ -137,6 +137,7 @@ namespace AzPhysics
         //! @param sceneHandle A handle to the scene to make the scene query with.
         //! @param requestId A user defined value to identify the request when the callback is called.
         //! @param request The request to make. Should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
+        //! The request must remain valid until the callback is called.
         //! @param callback The callback to trigger when the request is complete.
         //! @return Returns If the request was queued successfully. If returns false, the callback will never be called.
         [[nodiscard]] virtual bool QuerySceneAsync(SceneHandle sceneHandle, SceneQuery::AsyncRequestId requestId,
@@ -347,6 +348,7 @@ namespace AzPhysics
         //! Make a non-blocking query into the scene.
         //! @param requestId A user defined valid to identify the request when the callback is called.
         //! @param request The request to make. Should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
+        //! The request must remain valid until the callback is called.
         //! @param callback The callback to trigger when the request is complete.
         //! @return Returns if the request was queued successfully. If returns false, the callback will never be called.
         [[nodiscard]] virtual bool QuerySceneAsync(SceneQuery::AsyncRequestId requestId,
@@ -12,8 +12,20 @@
 
 namespace AzFramework
 {
+    static AZ::u64 CreateEntitiesRevision()
+    {
+        static AZStd::atomic<AZ::u64> s_nextRevision{ 0 };
+        return s_nextRevision.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    Spawnable::Spawnable()
+        : m_entitiesRevision(CreateEntitiesRevision())
+    {
+    }
+
     Spawnable::Spawnable(const AZ::Data::AssetId& id, AssetStatus status)
         : AZ::Data::AssetData(id, status)
+        , m_entitiesRevision(CreateEntitiesRevision())
     {
     }
 
@@ -24,6 +36,7 @@ namespace AzFramework
 
     Spawnable::EntityList& Spawnable::GetEntities()
     {
+        m_entitiesRevision.store(CreateEntitiesRevision(), AZStd::memory_order_relaxed);
         return m_entities;
     }
 
@@ -32,6 +45,11 @@ namespace AzFramework
         return m_entities.empty();
     }
 
+    AZ::u64 Spawnable::GetEntitiesRevision() const
+    {
+        return m_entitiesRevision.load(AZStd::memory_order_relaxed);
+    }
+
     SpawnableMetaData& Spawnable::GetMetaData()
     {
         return m_metaData;
@@ -12,6 +12,7 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 
@@ -34,7 +35,7 @@ namespace AzFramework
         inline static constexpr const char* FileExtension = "spawnable";
         inline static constexpr const char* DotFileExtension = ".spawnable";
 
-        Spawnable() = default;
+        Spawnable();
         explicit Spawnable(const AZ::Data::AssetId& id, AssetStatus status = AssetStatus::NotLoaded);
         Spawnable(const Spawnable& rhs) = delete;
         Spawnable(Spawnable&& other) = delete;
@@ -44,9 +45,15 @@ namespace AzFramework
         Spawnable& operator=(Spawnable&& other) = delete;
 
         const EntityList& GetEntities() const;
+        //! Code that changes the entities of the spawnable has to get them through this call, since it updates the revision.
         EntityList& GetEntities();
         bool IsEmpty() const;
 
+        //! Returns a revision that changes every time the entities are accessed for modification, so data derived from the
+        //! entities can detect that the spawnable was rebuilt in place. Revisions are unique across spawnables, so a spawnable
+        //! that's created at the address of a destroyed one doesn't match data derived from the destroyed one either.
+        AZ::u64 GetEntitiesRevision() const;
+
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
@@ -58,6 +65,7 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+        AZStd::atomic<AZ::u64> m_entitiesRevision;
     };
 
     using SpawnableList = AZStd::vector<Spawnable>;
@@ -273,14 +273,157 @@ namespace AzFramework
         }
     }
 
-    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityTemplate,
+    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityTemplate, EntityCloneMode cloneMode,
         EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext)
     {
         // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
         constexpr bool allowDuplicateIds = false;
+        using EntityIdRemapper = AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>;
 
-        return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-                &entityTemplate, templateToCloneMap, &serializeContext);
+        // The id map is pre-generated for all template entities, so the cheaper clone modes only need to look up ids in it.
+        // Anything the map doesn't cover goes through the remapper, which generates the missing ids.
+        switch (cloneMode)
+        {
+        case EntityCloneMode::ReplaceId:
+            if (auto cloneId = templateToCloneMap.find(entityTemplate.GetId()); cloneId != templateToCloneMap.end())
+            {
+                AZ::Entity* clone = serializeContext.CloneObject(&entityTemplate);
+                if (clone)
+                {
+                    clone->SetId(cloneId->second);
+                }
+                return clone;
+            }
+            break;
+        case EntityCloneMode::RemapReferences:
+            {
+                AZ::Entity* clone = serializeContext.CloneObject(&entityTemplate);
+                if (clone)
+                {
+                    EntityIdRemapper::RemapIdsAndIdRefs(
+                        clone,
+                        [&templateToCloneMap](const AZ::EntityId& originalId) -> AZ::EntityId
+                        {
+                            auto cloneId = templateToCloneMap.find(originalId);
+                            return cloneId != templateToCloneMap.end() ? cloneId->second : originalId;
+                        },
+                        &serializeContext);
+                }
+                return clone;
+            }
+        default:
+            break;
+        }
+
+        return EntityIdRemapper::CloneObjectAndGenerateNewIdsAndFixRefs(&entityTemplate, templateToCloneMap, &serializeContext);
+    }
+
+    auto SpawnableEntitiesManager::GetClonePlan(Ticket& ticket, const Spawnable& spawnable, AZ::SerializeContext& serializeContext)
+        -> const ClonePlan&
+    {
+        if (ticket.m_clonePlan && IsClonePlanValid(*ticket.m_clonePlan, spawnable, serializeContext))
+        {
+            return *ticket.m_clonePlan;
+        }
+
+        AZStd::scoped_lock lock(m_clonePlansMutex);
+        if (auto it = m_clonePlans.find(&spawnable); it != m_clonePlans.end())
+        {
+            AZStd::shared_ptr<const ClonePlan> clonePlan = it->second.lock();
+            if (clonePlan && IsClonePlanValid(*clonePlan, spawnable, serializeContext))
+            {
+                ticket.m_clonePlan = AZStd::move(clonePlan);
+                return *ticket.m_clonePlan;
+            }
+        }
+
+        // Building a plan is rare, so use the opportunity to drop the entries of spawnables that are no longer used by any ticket.
+        AZStd::erase_if(
+            m_clonePlans,
+            [](const auto& clonePlan)
+            {
+                return clonePlan.second.expired();
+            });
+
+        AZStd::shared_ptr<const ClonePlan> clonePlan = BuildClonePlan(spawnable, serializeContext);
+        m_clonePlans[&spawnable] = clonePlan;
+        ticket.m_clonePlan = AZStd::move(clonePlan);
+        return *ticket.m_clonePlan;
+    }
+
+    auto SpawnableEntitiesManager::BuildClonePlan(const Spawnable& spawnable, AZ::SerializeContext& serializeContext) const
+        -> AZStd::shared_ptr<ClonePlan>
+    {
+        const Spawnable::EntityList& entities = spawnable.GetEntities();
+
+        auto clonePlan = AZStd::make_shared<ClonePlan>();
+        clonePlan->m_spawnable = &spawnable;
+        clonePlan->m_serializeContext = &serializeContext;
+        clonePlan->m_entitiesRevision = spawnable.GetEntitiesRevision();
+        clonePlan->m_entityCloneModes.reserve(entities.size());
+
+        AZStd::unordered_set<AZ::EntityId> templateEntityIds;
+        templateEntityIds.reserve(entities.size());
+        for (const auto& entity : entities)
+        {
+            templateEntityIds.emplace(entity->GetId());
+        }
+
+        for (const auto& entity : entities)
+        {
+            // Go through all entity ids in the template the same way the remapper does. Ids with a generator function get
+            // replaced by a new id, all other ids are references that get replaced if they point to an entity in the spawnable.
+            EntityCloneMode cloneMode = EntityCloneMode::ReplaceId;
+            size_t generatedIdCount = 0;
+            auto beginCB = [&](void* ptr, const AZ::SerializeContext::ClassData* classData,
+                               const AZ::SerializeContext::ClassElement* elementData) -> bool
+            {
+                if (classData->m_typeId != azrtti_typeid<AZ::EntityId>())
+                {
+                    return true;
+                }
+
+                const AZ::EntityId* entityId = reinterpret_cast<const AZ::EntityId*>(ptr);
+                if (elementData && (elementData->m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER))
+                {
+                    entityId = *reinterpret_cast<const AZ::EntityId* const*>(ptr);
+                }
+
+                const bool isGeneratedId = elementData && elementData->FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction);
+                if (isGeneratedId)
+                {
+                    ++generatedIdCount;
+                    if (!templateEntityIds.contains(*entityId))
+                    {
+                        cloneMode = EntityCloneMode::GenerateIds;
+                    }
+                    else if (*entityId != entity->GetId() || generatedIdCount > 1)
+                    {
+                        cloneMode = AZStd::max(cloneMode, EntityCloneMode::RemapReferences);
+                    }
+                }
+                else if (templateEntityIds.contains(*entityId))
+                {
+                    cloneMode = AZStd::max(cloneMode, EntityCloneMode::RemapReferences);
+                }
+                return true;
+            };
+            serializeContext.EnumerateObject(entity.get(), beginCB, nullptr, AZ::SerializeContext::ENUM_ACCESS_FOR_READ);
+
+            clonePlan->m_entityCloneModes.push_back(cloneMode);
+        }
+
+        return clonePlan;
+    }
+
+    bool SpawnableEntitiesManager::IsClonePlanValid(
+        const ClonePlan& clonePlan, const Spawnable& spawnable, AZ::SerializeContext& serializeContext) const
+    {
+        // Spawnables are expected to be immutable once loaded, but they can be rebuilt in place, for instance in tools and tests.
+        // Any change to the entities, including to the references between them, goes through the non-const GetEntities which
+        // moves the revision forward.
+        return clonePlan.m_spawnable == &spawnable && clonePlan.m_serializeContext == &serializeContext &&
+            clonePlan.m_entitiesRevision == spawnable.GetEntitiesRevision();
     }
 
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
@@ -328,8 +471,10 @@ namespace AzFramework
             // Keep track how many entities there were in the array initially
             size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
-            // These are 'template' entities we'll be cloning from
-            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+            // These are 'template' entities we'll be cloning from. They're only read, so use the const spawnable to leave the
+            // entities revision untouched.
+            const Spawnable& spawnable = *ticket.m_spawnable;
+            const Spawnable::EntityList& entitiesToSpawn = spawnable.GetEntities();
             size_t entitiesToSpawnSize = entitiesToSpawn.size();
 
             // Reserve buffers
@@ -344,12 +489,15 @@ namespace AzFramework
             // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
             InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
+            const ClonePlan& clonePlan = GetClonePlan(ticket, spawnable, *request.m_serializeContext);
+
             for (size_t i = 0; i < entitiesToSpawnSize; ++i)
             {
                 // If this entity has previously been spawned, give it a new id in the reference map
                 RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                AZ::Entity* clone = CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                AZ::Entity* clone = CloneSingleEntity(
+                    *entitiesToSpawn[i], clonePlan.m_entityCloneModes[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                 AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                 spawnedEntities.emplace_back(clone);
@@ -403,8 +551,10 @@ namespace AzFramework
             // Keep track of how many entities there were in the array initially
             size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
-            // These are 'template' entities we'll be cloning from
-            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+            // These are 'template' entities we'll be cloning from. They're only read, so use the const spawnable to leave the
+            // entities revision untouched.
+            const Spawnable& spawnable = *ticket.m_spawnable;
+            const Spawnable::EntityList& entitiesToSpawn = spawnable.GetEntities();
             size_t entitiesToSpawnSize = request.m_entityIndices.size();
 
             if (ticket.m_entityIdReferenceMap.empty() || !request.m_referencePreviouslySpawnedEntities)
@@ -423,6 +573,8 @@ namespace AzFramework
             spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
             spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
+            const ClonePlan& clonePlan = GetClonePlan(ticket, spawnable, *request.m_serializeContext);
+
             for (size_t index : request.m_entityIndices)
             {
                 if (index < entitiesToSpawn.size())
@@ -431,8 +583,9 @@ namespace AzFramework
                     RefreshEntityIdMapping(
                         entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone =
-                        CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = CloneSingleEntity(
+                        *entitiesToSpawn[index], clonePlan.m_entityCloneModes[index], ticket.m_entityIdReferenceMap,
+                        *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     spawnedEntities.push_back(clone);
@@ -559,7 +712,8 @@ namespace AzFramework
 
             // Rebuild the list of entities.
             ticket.m_spawnedEntities.clear();
-            const Spawnable::EntityList& entities = request.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *request.m_spawnable;
+            const Spawnable::EntityList& entities = spawnable.GetEntities();
 
             // Pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
             // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
@@ -567,6 +721,8 @@ namespace AzFramework
             // match the new set of template entities getting spawned.
             InitializeEntityIdMappings(entities, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
+            const ClonePlan& clonePlan = GetClonePlan(ticket, spawnable, *request.m_serializeContext);
+
             if (ticket.m_loadAll)
             {
                 // The new spawnable may have a different number of entities and since the intent of the user was
@@ -579,7 +735,8 @@ namespace AzFramework
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = CloneSingleEntity(
+                        *entities[i], clonePlan.m_entityCloneModes[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -600,7 +757,9 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone = CloneSingleEntity(
+                            *entities[index], clonePlan.m_entityCloneModes[index], ticket.m_entityIdReferenceMap,
+                            *request.m_serializeContext);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
@@ -12,9 +12,12 @@
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 
 namespace AZ
@@ -78,6 +81,31 @@ namespace AzFramework
         CommandQueueStatus ProcessQueue(CommandQueuePriority priority);
 
     protected:
+        //! Describes how much work is needed to clone a template entity and fix up its entity ids.
+        enum class EntityCloneMode : uint8_t
+        {
+            //! The entity doesn't reference any entity in the spawnable other than through its own id, so only its id needs replacing.
+            ReplaceId,
+            //! The entity references entities in the spawnable, which are all remapped in a single pass.
+            RemapReferences,
+            //! The entity contains ids that aren't part of the spawnable and need to be generated, which requires the full remapper.
+            GenerateIds
+        };
+
+        //! The precomputed steps to clone the entities of a spawnable. The plan is built once per spawnable and shared between
+        //! all tickets that spawn from it, so that spawning many instances doesn't need to inspect the template entities again.
+        struct ClonePlan
+        {
+            AZ_CLASS_ALLOCATOR(ClonePlan, AZ::SystemAllocator, 0);
+
+            //! The clone mode for each template entity, in the same order as the entities in the spawnable.
+            AZStd::vector<EntityCloneMode> m_entityCloneModes;
+            const Spawnable* m_spawnable{ nullptr };
+            AZ::SerializeContext* m_serializeContext{ nullptr };
+            //! The entities revision of the spawnable the plan was built for, used to detect spawnables that were rebuilt in place.
+            AZ::u64 m_entitiesRevision{ 0 };
+        };
+
         struct Ticket
         {
             AZ_CLASS_ALLOCATOR(Ticket, AZ::ThreadPoolAllocator, 0);
@@ -102,6 +130,7 @@ namespace AzFramework
             AZStd::vector<AZ::Entity*> m_spawnedEntities;
             AZStd::vector<size_t> m_spawnedEntityIndices;
             AZ::Data::Asset<Spawnable> m_spawnable;
+            AZStd::shared_ptr<const ClonePlan> m_clonePlan;
             uint32_t m_nextRequestId{ 0 }; //!< Next id for this ticket.
             uint32_t m_currentRequestId { 0 }; //!< The id for the command that should be executed.
             bool m_loadAll{ true };
@@ -212,7 +241,14 @@ namespace AzFramework
         CommandQueueStatus ProcessQueue(Queue& queue);
 
         AZ::Entity* CloneSingleEntity(
-            const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext);
+            const AZ::Entity& entityTemplate, EntityCloneMode cloneMode, EntityIdMap& templateToCloneMap,
+            AZ::SerializeContext& serializeContext);
+
+        //! Get the clone plan for the spawnable, building it if no up-to-date plan is available yet.
+        //! The plan is stored on the ticket, which keeps it alive for as long as the ticket uses the spawnable.
+        const ClonePlan& GetClonePlan(Ticket& ticket, const Spawnable& spawnable, AZ::SerializeContext& serializeContext);
+        AZStd::shared_ptr<ClonePlan> BuildClonePlan(const Spawnable& spawnable, AZ::SerializeContext& serializeContext) const;
+        bool IsClonePlanValid(const ClonePlan& clonePlan, const Spawnable& spawnable, AZ::SerializeContext& serializeContext) const;
         
         bool ProcessRequest(SpawnAllEntitiesCommand& request);
         bool ProcessRequest(SpawnEntitiesCommand& request);
@@ -237,6 +273,11 @@ namespace AzFramework
         Queue m_highPriorityQueue;
         Queue m_regularPriorityQueue;
 
+        //! Clone plans of the spawnables that are currently used by tickets. The tickets own the plans, so expired entries
+        //! belong to spawnables that are no longer used.
+        AZStd::unordered_map<const Spawnable*, AZStd::weak_ptr<const ClonePlan>> m_clonePlans;
+        AZStd::mutex m_clonePlansMutex;
+
         AZ::SerializeContext* m_defaultSerializeContext { nullptr };
         //! The threshold used to determine if a request goes in the regular (if bigger than the value) or high priority queue (if smaller
         //! or equal to this value). The starting value of 64 is chosen as it's between default values SpawnablePriority_High and
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
 {
@@ -91,6 +92,86 @@ namespace AzFramework
             //!                  otherwise *terrainExistsPtr will be set to true.
             virtual AZ::Vector3 GetNormal(AZ::Vector3 position, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const = 0;
             virtual AZ::Vector3 GetNormalFromFloats(float x, float y, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const = 0;
+
+            //! Batched version of GetHeight, which replaces the Z value of every position with the terrain height at its XY location.
+            //! Terrain systems should override this to avoid paying the per-query overhead for every single position.
+            //! @terrainExistsList: Can be nullptr. If != nullptr then it gets resized to the number of positions, and every entry will be set
+            //!                  to false if there's no terrain or a terrain HOLE at that position, otherwise it will be set to true.
+            virtual void GetHeights(
+                AZStd::vector<AZ::Vector3>& inOutPositions, Sampler sampler = Sampler::BILINEAR, AZStd::vector<bool>* terrainExistsList = nullptr) const
+            {
+                if (terrainExistsList)
+                {
+                    terrainExistsList->resize(inOutPositions.size());
+                }
+
+                for (size_t index = 0; index < inOutPositions.size(); ++index)
+                {
+                    bool terrainExists = false;
+                    inOutPositions[index].SetZ(GetHeight(inOutPositions[index], sampler, &terrainExists));
+                    if (terrainExistsList)
+                    {
+                        (*terrainExistsList)[index] = terrainExists;
+                    }
+                }
+            }
+
+            //! Batched version of GetNormal, outNormals gets resized to the number of positions.
+            //! @terrainExistsList: Can be nullptr. Follows the same rules as the terrainExistsList of GetHeights.
+            virtual void GetNormals(
+                const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<AZ::Vector3>& outNormals, Sampler sampler = Sampler::BILINEAR,
+                AZStd::vector<bool>* terrainExistsList = nullptr) const
+            {
+                outNormals.resize(positions.size());
+                if (terrainExistsList)
+                {
+                    terrainExistsList->resize(positions.size());
+                }
+
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    bool terrainExists = false;
+                    outNormals[index] = GetNormal(positions[index], sampler, &terrainExists);
+                    if (terrainExistsList)
+                    {
+                        (*terrainExistsList)[index] = terrainExists;
+                    }
+                }
+            }
+
+            //! Get the terrain heights on a grid of stepSize spacing across the XY area of inRegion, including the min edges but excluding
+            //! the max edges. The positions are output row by row, starting at the min corner of the region.
+            //! @terrainExistsList: Can be nullptr. Follows the same rules as the terrainExistsList of GetHeights.
+            virtual void GetHeightsFromRegion(
+                const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, AZStd::vector<AZ::Vector3>& outPositions,
+                Sampler sampler = Sampler::BILINEAR, AZStd::vector<bool>* terrainExistsList = nullptr) const
+            {
+                outPositions.clear();
+                if (!inRegion.IsValid() || stepSize.GetX() <= 0.0f || stepSize.GetY() <= 0.0f)
+                {
+                    if (terrainExistsList)
+                    {
+                        terrainExistsList->clear();
+                    }
+                    return;
+                }
+
+                const size_t numSamplesX = static_cast<size_t>(ceilf((inRegion.GetMax().GetX() - inRegion.GetMin().GetX()) / stepSize.GetX()));
+                const size_t numSamplesY = static_cast<size_t>(ceilf((inRegion.GetMax().GetY() - inRegion.GetMin().GetY()) / stepSize.GetY()));
+
+                outPositions.reserve(numSamplesX * numSamplesY);
+                for (size_t y = 0; y < numSamplesY; ++y)
+                {
+                    for (size_t x = 0; x < numSamplesX; ++x)
+                    {
+                        outPositions.emplace_back(
+                            inRegion.GetMin().GetX() + (x * stepSize.GetX()), inRegion.GetMin().GetY() + (y * stepSize.GetY()),
+                            inRegion.GetMin().GetZ());
+                    }
+                }
+
+                GetHeights(outPositions, sampler, terrainExistsList);
+            }
         };
         using TerrainDataRequestBus = AZ::EBus<TerrainDataRequests>;
 
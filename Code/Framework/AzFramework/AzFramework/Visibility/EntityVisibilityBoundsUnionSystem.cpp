@@ -84,6 +84,15 @@ namespace AzFramework
     }
 
     void EntityVisibilityBoundsUnionSystem::UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
+    {
+        IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
+        if (visibilitySystem && UpdateWorldBoundsUnion(entity, instance))
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(instance.m_visibilityEntry);
+        }
+    }
+
+    bool EntityVisibilityBoundsUnionSystem::UpdateWorldBoundsUnion(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
     {
         if (const auto& localEntityBoundsUnions = instance.m_localEntityBoundsUnion; localEntityBoundsUnions.IsValid())
         {
@@ -91,13 +100,13 @@ namespace AzFramework
             // there will be some wasted space but it should be sufficient for the visibility system
             AZ::TransformInterface* transformInterface = entity->GetTransform();
             const AZ::Aabb worldEntityBoundsUnion = localEntityBoundsUnions.GetTransformedAabb(transformInterface->GetWorldTM());
-            IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
-            if (visibilitySystem && !worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
+            if (!worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
             {
                 instance.m_visibilityEntry.m_boundingVolume = worldEntityBoundsUnion;
-                visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(instance.m_visibilityEntry);
+                return true;
             }
         }
+        return false;
     }
 
     void EntityVisibilityBoundsUnionSystem::RefreshEntityLocalBoundsUnion(const AZ::EntityId entityId)
@@ -132,6 +141,8 @@ namespace AzFramework
     {
         AZ_PROFILE_FUNCTION(AzFramework);
 
+        IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
+
         // iterate over all entities whose bounds changed and recalculate them
         for (const auto& entity : m_entityBoundsDirty)
         {
@@ -139,10 +150,20 @@ namespace AzFramework
                 instance_it != m_entityVisibilityBoundsUnionInstanceMapping.end())
             {
                 instance_it->second.m_localEntityBoundsUnion = CalculateEntityLocalBoundsUnion(entity);
-                UpdateVisibilitySystem(entity, instance_it->second);
+                if (visibilitySystem && UpdateWorldBoundsUnion(entity, instance_it->second))
+                {
+                    m_pendingVisibilityEntries.push_back(&instance_it->second.m_visibilityEntry);
+                }
             }
         }
 
+        // submit all changed entries to the visibility system as a single batch
+        if (!m_pendingVisibilityEntries.empty())
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntries(m_pendingVisibilityEntries);
+            m_pendingVisibilityEntries.clear();
+        }
+
         // clear dirty entities once the visibility system has been updated
         m_entityBoundsDirty.clear();
     }
@@ -72,6 +72,17 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being added/updated
         virtual void InsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Insert or update a batch of entries within the visibility system.
+        //! Implementations can override this to amortize locking and tree updates across the whole batch.
+        //! @param visibilityEntries data for the objects being added/updated
+        virtual void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& visibilityEntries)
+        {
+            for (VisibilityEntry* visibilityEntry : visibilityEntries)
+            {
+                InsertOrUpdateEntry(*visibilityEntry);
+            }
+        }
+
         //! Removes an entry from the visibility system.
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
@@ -94,6 +105,24 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a sphere against the visibility system, potentially splitting the work across task graph workers.
+        //! The callback may be invoked concurrently from multiple threads, so it must be thread safe.
+        //! @param sphere the sphere to test against
+        //! @param callback the callback to invoke when a node is visible
+        virtual void EnumerateParallel(const AZ::Sphere& sphere, const EnumerateCallback& callback) const
+        {
+            Enumerate(sphere, callback);
+        }
+
+        //! Intersects a frustum against the visibility system, potentially splitting the work across task graph workers.
+        //! The callback may be invoked concurrently from multiple threads, so it must be thread safe.
+        //! @param frustum the frustum to test against
+        //! @param callback the callback to invoke when a node is visible
+        virtual void EnumerateParallel(const AZ::Frustum& frustum, const EnumerateCallback& callback) const
+        {
+            Enumerate(frustum, callback);
+        }
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
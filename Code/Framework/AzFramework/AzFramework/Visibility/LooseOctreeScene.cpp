@@ -0,0 +1,640 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Visibility/LooseOctreeScene.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
+namespace AzFramework
+{
+    AZ_CVAR_EXTERNED(float, bg_octreeMaxWorldExtents);
+
+    AZ_CVAR(uint32_t, bg_looseOctreeNodeMaxEntries,       64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any loose octree leaf node before forcing a split");
+    AZ_CVAR(uint32_t, bg_looseOctreeNodeMinEntries,       32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a loose octree node resulting from a merge operation");
+    AZ_CVAR(uint32_t, bg_looseOctreeMaxDepth,             12, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum depth of loose octree nodes, applied to visibility scenes created after it is changed");
+    AZ_CVAR(uint32_t, bg_looseOctreeParallelSplitDepth,    2, nullptr, AZ::ConsoleFunctorFlags::Null, "Depth at which parallel loose octree queries hand subtrees out to task graph workers");
+
+    namespace LooseOctreeInternal
+    {
+        // Center and half extent of an entry, using the largest axis extent so the entry is treated as a cube.
+        struct EntryPlacement
+        {
+            AZ::Vector3 m_center;
+            float m_halfExtent;
+        };
+
+        static EntryPlacement GetEntryPlacement(const VisibilityEntry& entry)
+        {
+            // Scale before adding or subtracting, so entries with extremely large bounds don't overflow.
+            const AZ::Vector3 min = entry.m_boundingVolume.GetMin() * 0.5f;
+            const AZ::Vector3 max = entry.m_boundingVolume.GetMax() * 0.5f;
+            return EntryPlacement{ max + min, (max - min).GetMaxElement() };
+        }
+
+        static bool IsInCell(const AZ::Vector3& center, float halfExtent, const AZ::Vector3& point)
+        {
+            return (point - center).GetAbs().IsLessEqualThan(AZ::Vector3(halfExtent));
+        }
+    }
+
+    const AZStd::vector<VisibilityEntry*>& LooseOctreeNode::GetEntries() const
+    {
+        return m_entries;
+    }
+
+
+    bool LooseOctreeNode::IsLeaf() const
+    {
+        return m_firstChild == InvalidNodeIndex;
+    }
+
+
+    LooseOctreeScene::LooseOctreeScene(const AZ::Name& sceneName)
+        : m_sceneName(sceneName)
+        , m_maxDepth(bg_looseOctreeMaxDepth)
+    {
+        AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+
+        // The root node occupies the first block of nodes on its own, to keep child blocks aligned to ChildNodeCount
+        m_nodePages.push_back(new LooseOctreeNodePage);
+        m_allocatedNodeCount = ChildNodeCount;
+        ResizeNodeBounds();
+
+        LooseOctreeNode& root = GetNode(RootNodeIndex);
+        root.m_index = RootNodeIndex;
+        root.m_halfExtent = bg_octreeMaxWorldExtents;
+        SetNodeBounds(root);
+    }
+
+
+    LooseOctreeScene::~LooseOctreeScene()
+    {
+        for (LooseOctreeNodePage* page : m_nodePages)
+        {
+            delete page;
+        }
+    }
+
+
+    const AZ::Name& LooseOctreeScene::GetName() const
+    {
+        return m_sceneName;
+    }
+
+
+    void LooseOctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        {
+            // Entries that remain bound to their current node don't modify the tree, so only shared access is needed
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+            if (entry.m_internalNode != nullptr && IsEntryInPlace(entry))
+            {
+                return;
+            }
+        }
+
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryLocked(entry);
+    }
+
+
+    void LooseOctreeScene::InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries)
+    {
+        AZStd::vector<VisibilityEntry*> movedEntries;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+            for (VisibilityEntry* entry : entries)
+            {
+                if (entry->m_internalNode == nullptr || !IsEntryInPlace(*entry))
+                {
+                    movedEntries.push_back(entry);
+                }
+            }
+        }
+
+        if (!movedEntries.empty())
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+            for (VisibilityEntry* entry : movedEntries)
+            {
+                InsertOrUpdateEntryLocked(*entry);
+            }
+        }
+    }
+
+
+    void LooseOctreeScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode)
+        {
+            LooseOctreeNode& node = *static_cast<LooseOctreeNode*>(entry.m_internalNode);
+            const uint32_t parentIndex = node.m_parent;
+            Detach(node, entry);
+            --m_entryCount;
+
+            if (parentIndex != LooseOctreeNode::InvalidNodeIndex)
+            {
+                TryMerge(GetNode(parentIndex));
+            }
+        }
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(GetNode(RootNodeIndex), aabb, callback);
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(GetNode(RootNodeIndex), sphere, callback);
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(GetNode(RootNodeIndex), frustum, callback);
+    }
+
+
+    void LooseOctreeScene::EnumerateParallel(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateParallelHelper(sphere, callback);
+    }
+
+
+    void LooseOctreeScene::EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateParallelHelper(frustum, callback);
+    }
+
+
+    void LooseOctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateNoCullHelper(GetNode(RootNodeIndex), callback);
+    }
+
+
+    uint32_t LooseOctreeScene::GetEntryCount() const
+    {
+        return m_entryCount;
+    }
+
+
+    uint32_t LooseOctreeScene::GetNodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+
+    uint32_t LooseOctreeScene::GetFreeNodeCount() const
+    {
+        // Each entry represents ChildNodeCount nodes
+        return aznumeric_cast<uint32_t>(m_freeChildNodes.size() * ChildNodeCount);
+    }
+
+
+    uint32_t LooseOctreeScene::GetPageCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_nodePages.size());
+    }
+
+
+    void LooseOctreeScene::DumpStats()
+    {
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::NodeCount = %u", GetName().GetCStr(), GetNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::PageCount = %u", GetName().GetCStr(), GetPageCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::MaxDepth = %u", GetName().GetCStr(), m_maxDepth);
+    }
+
+
+    template <typename T>
+    uint32_t LooseOctreeScene::CullChildren(uint32_t firstChild, const T& boundingVolume) const
+    {
+        const AZ::ShapeIntersection::AabbBatch childBounds{
+            &m_boundsMinX[firstChild], &m_boundsMinY[firstChild], &m_boundsMinZ[firstChild],
+            &m_boundsMaxX[firstChild], &m_boundsMaxY[firstChild], &m_boundsMaxZ[firstChild], ChildNodeCount };
+
+        uint32_t overlapMask = 0;
+        AZ::ShapeIntersection::OverlapsBatch(boundingVolume, childBounds, &overlapMask);
+        return overlapMask;
+    }
+
+
+    template <typename T>
+    void LooseOctreeScene::EnumerateHelper(const LooseOctreeNode& node, const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Invoke the callback for the current node
+        if (!node.m_entries.empty())
+        {
+            const AZ::Aabb looseBounds = AZ::Aabb::CreateCenterHalfExtents(node.m_center, AZ::Vector3(2.0f * node.m_halfExtent));
+            callback({ looseBounds, node.m_entries });
+        }
+
+        if (!node.IsLeaf())
+        {
+            // If this is not a leaf node, recurse into the overlapping children
+            const uint32_t overlappingChildren = CullChildren(node.m_firstChild, boundingVolume);
+            for (uint32_t child = 0; child < ChildNodeCount; ++child)
+            {
+                if (overlappingChildren & (1u << child))
+                {
+                    EnumerateHelper(GetNode(node.m_firstChild + child), boundingVolume, callback);
+                }
+            }
+        }
+    }
+
+
+    template <typename T>
+    void LooseOctreeScene::EnumerateParallelHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+
+        // Waiting on a task graph from within a task would stall the worker, so queries issued by tasks run serially
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (!taskGraphActiveInterface || !taskGraphActiveInterface->IsTaskGraphActive() ||
+            AZ::TaskExecutor::Instance().GetWorkerIndex() != AZ::TaskExecutor::InvalidWorkerIndex)
+        {
+            EnumerateHelper(GetNode(RootNodeIndex), boundingVolume, callback);
+            return;
+        }
+
+        // Visit the top of the tree on the calling thread, gathering the overlapping subtrees at the split depth
+        const uint32_t splitDepth = AZStd::max<uint32_t>(bg_looseOctreeParallelSplitDepth, 1);
+        AZStd::vector<const LooseOctreeNode*> subtrees;
+        AZStd::vector<const LooseOctreeNode*> pendingNodes = { &GetNode(RootNodeIndex) };
+        while (!pendingNodes.empty())
+        {
+            const LooseOctreeNode& node = *pendingNodes.back();
+            pendingNodes.pop_back();
+
+            if (node.m_depth >= splitDepth)
+            {
+                subtrees.push_back(&node);
+                continue;
+            }
+
+            if (!node.m_entries.empty())
+            {
+                const AZ::Aabb looseBounds = AZ::Aabb::CreateCenterHalfExtents(node.m_center, AZ::Vector3(2.0f * node.m_halfExtent));
+                callback({ looseBounds, node.m_entries });
+            }
+
+            if (!node.IsLeaf())
+            {
+                const uint32_t overlappingChildren = CullChildren(node.m_firstChild, boundingVolume);
+                for (uint32_t child = 0; child < ChildNodeCount; ++child)
+                {
+                    if (overlappingChildren & (1u << child))
+                    {
+                        pendingNodes.push_back(&GetNode(node.m_firstChild + child));
+                    }
+                }
+            }
+        }
+
+        if (subtrees.size() <= 1)
+        {
+            for (const LooseOctreeNode* subtree : subtrees)
+            {
+                EnumerateHelper(*subtree, boundingVolume, callback);
+            }
+            return;
+        }
+
+        // The calling thread keeps holding shared access to the scene until all subtrees have been visited
+        static const AZ::TaskDescriptor enumerateTaskDescriptor{ "LooseOctreeScene::EnumerateParallel", "AzFramework" };
+        AZ::TaskGraph taskGraph;
+        for (const LooseOctreeNode* subtree : subtrees)
+        {
+            taskGraph.AddTask(enumerateTaskDescriptor, [this, subtree, &boundingVolume, &callback]()
+            {
+                EnumerateHelper(*subtree, boundingVolume, callback);
+            });
+        }
+
+        AZ::TaskGraphEvent finishedEvent;
+        taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+
+
+    void LooseOctreeScene::EnumerateNoCullHelper(const LooseOctreeNode& node, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Invoke the callback for the current node
+        if (!node.m_entries.empty())
+        {
+            const AZ::Aabb looseBounds = AZ::Aabb::CreateCenterHalfExtents(node.m_center, AZ::Vector3(2.0f * node.m_halfExtent));
+            callback({ looseBounds, node.m_entries });
+        }
+
+        if (!node.IsLeaf())
+        {
+            // If this is not a leaf node, recurse into the children
+            for (uint32_t child = 0; child < ChildNodeCount; ++child)
+            {
+                EnumerateNoCullHelper(GetNode(node.m_firstChild + child), callback);
+            }
+        }
+    }
+
+
+    // Returns the index of the child of the node that the entry belongs in, or InvalidNodeIndex if it belongs in the node itself.
+    static uint32_t GetChildIndexForEntry(const LooseOctreeNode& node, const AZ::Vector3& nodeCenter, float nodeHalfExtent,
+        const LooseOctreeInternal::EntryPlacement& placement)
+    {
+        // Entries can only move down if they fit in the loose bounds of a child, which are as large as the cell of this node
+        if (node.IsLeaf() || placement.m_halfExtent > (0.5f * nodeHalfExtent) ||
+            !LooseOctreeInternal::IsInCell(nodeCenter, nodeHalfExtent, placement.m_center))
+        {
+            return LooseOctreeNode::InvalidNodeIndex;
+        }
+
+        // Note that the ordering of these bits matches the child ordering used by the OctreeScene
+        uint32_t child = 0;
+        child |= (placement.m_center.GetX() >= nodeCenter.GetX()) ? 0x01 : 0;
+        child |= (placement.m_center.GetY() >= nodeCenter.GetY()) ? 0x02 : 0;
+        child |= (placement.m_center.GetZ() >= nodeCenter.GetZ()) ? 0x04 : 0;
+        return child;
+    }
+
+
+    bool LooseOctreeScene::IsEntryInPlace(const VisibilityEntry& entry) const
+    {
+        const LooseOctreeNode& node = *static_cast<const LooseOctreeNode*>(entry.m_internalNode);
+        const LooseOctreeInternal::EntryPlacement placement = LooseOctreeInternal::GetEntryPlacement(entry);
+
+        // The root node accepts any entry, all other nodes require the entry to fit within their loose bounds
+        const bool fitsNode = (node.m_index == RootNodeIndex) ||
+            ((placement.m_halfExtent <= node.m_halfExtent) && LooseOctreeInternal::IsInCell(node.m_center, node.m_halfExtent, placement.m_center));
+
+        // Entries must also not fit in a child node, otherwise they would get stuck in non-leaf nodes
+        return fitsNode && (GetChildIndexForEntry(node, node.m_center, node.m_halfExtent, placement) == LooseOctreeNode::InvalidNodeIndex);
+    }
+
+
+    void LooseOctreeScene::InsertOrUpdateEntryLocked(VisibilityEntry& entry)
+    {
+        if (entry.m_internalNode == nullptr)
+        {
+            Insert(GetNode(RootNodeIndex), entry);
+            ++m_entryCount;
+            return;
+        }
+
+        // Another thread may have moved the entry while this one was waiting for exclusive access
+        if (IsEntryInPlace(entry))
+        {
+            return;
+        }
+
+        LooseOctreeNode& currentNode = *static_cast<LooseOctreeNode*>(entry.m_internalNode);
+        const LooseOctreeInternal::EntryPlacement placement = LooseOctreeInternal::GetEntryPlacement(entry);
+
+        // Traverse up our ancestor nodes to find the first node that can hold the entry
+        // This strategy assumes an entry will typically move a small distance relative to the total world
+        LooseOctreeNode* insertNode = &currentNode;
+        while (insertNode->m_index != RootNodeIndex)
+        {
+            if ((placement.m_halfExtent <= insertNode->m_halfExtent) &&
+                LooseOctreeInternal::IsInCell(insertNode->m_center, insertNode->m_halfExtent, placement.m_center))
+            {
+                break;
+            }
+            insertNode = &GetNode(insertNode->m_parent);
+        }
+
+        const uint32_t parentIndex = currentNode.m_parent;
+        Detach(currentNode, entry);
+        Insert(*insertNode, entry);
+
+        if (parentIndex != LooseOctreeNode::InvalidNodeIndex)
+        {
+            TryMerge(GetNode(parentIndex));
+        }
+    }
+
+
+    void LooseOctreeScene::Insert(LooseOctreeNode& node, VisibilityEntry& entry)
+    {
+        AZ_Assert(entry.m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the LooseOctreeScene");
+
+        const LooseOctreeInternal::EntryPlacement placement = LooseOctreeInternal::GetEntryPlacement(entry);
+
+        // Descend as far as the entry fits, there is only ever a single candidate child node
+        LooseOctreeNode* insertNode = &node;
+        while (true)
+        {
+            const uint32_t child = GetChildIndexForEntry(*insertNode, insertNode->m_center, insertNode->m_halfExtent, placement);
+            if (child != LooseOctreeNode::InvalidNodeIndex)
+            {
+                insertNode = &GetNode(insertNode->m_firstChild + child);
+                continue;
+            }
+
+            // If we're not already split, and our entry list gets too large, split this node and try again
+            if (insertNode->IsLeaf() && (insertNode->m_entries.size() >= bg_looseOctreeNodeMaxEntries) && (insertNode->m_depth < m_maxDepth))
+            {
+                Split(*insertNode);
+                continue;
+            }
+            break;
+        }
+
+        insertNode->m_entries.push_back(&entry);
+        entry.m_internalNode = insertNode;
+        entry.m_internalNodeIndex = aznumeric_cast<uint32_t>(insertNode->m_entries.size() - 1);
+    }
+
+
+    void LooseOctreeScene::Detach(LooseOctreeNode& node, VisibilityEntry& entry)
+    {
+        AZ_Assert(entry.m_internalNode == &node, "Detach invoked for an entry bound to a different LooseOctreeNode");
+        AZ_Assert(node.m_entries[entry.m_internalNodeIndex] == &entry, "Visibility entry data is corrupt");
+
+        // Swap and pop the removed entry
+        const uint32_t removeIndex = entry.m_internalNodeIndex;
+        entry.m_internalNode = nullptr;
+        entry.m_internalNodeIndex = 0;
+        if (removeIndex < (node.m_entries.size() - 1))
+        {
+            AZStd::swap(node.m_entries[removeIndex], node.m_entries.back());
+            node.m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
+        }
+        node.m_entries.pop_back();
+    }
+
+
+    void LooseOctreeScene::Split(LooseOctreeNode& node)
+    {
+        AZ_Assert(node.IsLeaf(), "Split invoked on a LooseOctreeScene node that has already been split");
+        node.m_firstChild = AllocateChildNodes();
+
+        const float childHalfExtent = 0.5f * node.m_halfExtent;
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            const AZ::Vector3 childOffset(
+                (child & 0x01) ? childHalfExtent : -childHalfExtent,
+                (child & 0x02) ? childHalfExtent : -childHalfExtent,
+                (child & 0x04) ? childHalfExtent : -childHalfExtent);
+
+            LooseOctreeNode& childNode = GetNode(node.m_firstChild + child);
+            childNode.m_center = node.m_center + childOffset;
+            childNode.m_halfExtent = childHalfExtent;
+            childNode.m_depth = node.m_depth + 1;
+            childNode.m_parent = node.m_index;
+            SetNodeBounds(childNode);
+        }
+
+        // Re-partition our entry set across ourself and our child nodes
+        AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(node.m_entries));
+        node.m_entries.clear();
+        for (VisibilityEntry* entry : entrySet)
+        {
+            entry->m_internalNode = nullptr;
+            entry->m_internalNodeIndex = 0;
+            Insert(node, *entry);
+        }
+    }
+
+
+    void LooseOctreeScene::TryMerge(LooseOctreeNode& node)
+    {
+        if (node.IsLeaf())
+        {
+            return;
+        }
+
+        size_t potentialEntryCount = node.m_entries.size();
+
+        // Check ourselves and all our children for mergeability
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            LooseOctreeNode& childNode = GetNode(node.m_firstChild + child);
+            TryMerge(childNode);
+            if (!childNode.IsLeaf())
+            {
+                return;
+            }
+            potentialEntryCount += childNode.m_entries.size();
+        }
+
+        if (potentialEntryCount <= bg_looseOctreeNodeMinEntries)
+        {
+            Merge(node);
+        }
+    }
+
+
+    void LooseOctreeScene::Merge(LooseOctreeNode& node)
+    {
+        AZ_Assert(!node.IsLeaf(), "Merge invoked on a LooseOctreeScene node that does not have children");
+
+        // Move all child entries to our own entry set, they are guaranteed to fit since our cell contains the child cells
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            LooseOctreeNode& childNode = GetNode(node.m_firstChild + child);
+            for (VisibilityEntry* childEntry : childNode.m_entries)
+            {
+                childEntry->m_internalNode = &node;
+                childEntry->m_internalNodeIndex = aznumeric_cast<uint32_t>(node.m_entries.size());
+                node.m_entries.push_back(childEntry);
+            }
+            childNode.m_entries.clear();
+        }
+
+        ReleaseChildNodes(node.m_firstChild);
+        node.m_firstChild = LooseOctreeNode::InvalidNodeIndex;
+    }
+
+
+    uint32_t LooseOctreeScene::AllocateChildNodes()
+    {
+        m_nodeCount += ChildNodeCount;
+
+        uint32_t firstChild = 0;
+        if (!m_freeChildNodes.empty())
+        {
+            // Take a free block of child nodes from our free list
+            firstChild = m_freeChildNodes.top();
+            m_freeChildNodes.pop();
+        }
+        else
+        {
+            if (m_allocatedNodeCount >= m_nodePages.size() * PageSize)
+            {
+                // Our last page is already full, so we need to allocate a new page
+                m_nodePages.push_back(new LooseOctreeNodePage);
+            }
+
+            firstChild = m_allocatedNodeCount;
+            m_allocatedNodeCount += ChildNodeCount;
+            ResizeNodeBounds();
+        }
+
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            LooseOctreeNode& childNode = GetNode(firstChild + child);
+            childNode.m_index = firstChild + child;
+            childNode.m_firstChild = LooseOctreeNode::InvalidNodeIndex;
+            AZ_Assert(childNode.m_entries.empty(), "Allocated LooseOctreeScene node still has entries bound to it");
+        }
+
+        return firstChild;
+    }
+
+
+    void LooseOctreeScene::ReleaseChildNodes(uint32_t firstChild)
+    {
+        m_nodeCount -= ChildNodeCount;
+        m_freeChildNodes.push(firstChild);
+    }
+
+
+    LooseOctreeNode& LooseOctreeScene::GetNode(uint32_t nodeIndex) const
+    {
+        return (*m_nodePages[nodeIndex / PageSize])[nodeIndex % PageSize];
+    }
+
+
+    void LooseOctreeScene::SetNodeBounds(const LooseOctreeNode& node)
+    {
+        const AZ::Vector3 looseHalfExtents(2.0f * node.m_halfExtent);
+        const AZ::Vector3 looseMin = node.m_center - looseHalfExtents;
+        const AZ::Vector3 looseMax = node.m_center + looseHalfExtents;
+        m_boundsMinX[node.m_index] = looseMin.GetX();
+        m_boundsMinY[node.m_index] = looseMin.GetY();
+        m_boundsMinZ[node.m_index] = looseMin.GetZ();
+        m_boundsMaxX[node.m_index] = looseMax.GetX();
+        m_boundsMaxY[node.m_index] = looseMax.GetY();
+        m_boundsMaxZ[node.m_index] = looseMax.GetZ();
+    }
+
+
+    void LooseOctreeScene::ResizeNodeBounds()
+    {
+        m_boundsMinX.resize(m_allocatedNodeCount);
+        m_boundsMinY.resize(m_allocatedNodeCount);
+        m_boundsMinZ.resize(m_allocatedNodeCount);
+        m_boundsMaxX.resize(m_allocatedNodeCount);
+        m_boundsMaxY.resize(m_allocatedNodeCount);
+        m_boundsMaxZ.resize(m_allocatedNodeCount);
+    }
+}
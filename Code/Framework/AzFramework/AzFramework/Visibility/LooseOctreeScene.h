@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/stack.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AzFramework
+{
+    class LooseOctreeScene;
+
+    //! A node within a LooseOctreeScene.
+    //! Each node owns a cubic cell of the world, but accepts any entry whose center lies in the cell and whose
+    //! half extent is no larger than the cell's half extent. The node's loose bounds are therefore twice the size of
+    //! its cell, which lets entries move around within their cell without ever having to be re-inserted.
+    class LooseOctreeNode
+        : public VisibilityNode
+    {
+    public:
+        static constexpr uint32_t InvalidNodeIndex = 0xFFFFFFFF;
+
+        //! Returns the set of entries bound to this node.
+        const AZStd::vector<VisibilityEntry*>& GetEntries() const;
+
+        //! Returns true if this is a leaf node.
+        bool IsLeaf() const;
+
+    private:
+        friend class LooseOctreeScene;
+
+        AZ::Vector3 m_center = AZ::Vector3::CreateZero(); //< Center of the node cell.
+        float m_halfExtent = 0.0f; //< Half the width of the node cell, the loose bounds extend twice as far.
+        uint32_t m_index = InvalidNodeIndex; //< Index of this node within the scene node storage.
+        uint32_t m_depth = 0;
+        uint32_t m_parent = InvalidNodeIndex;
+        uint32_t m_firstChild = InvalidNodeIndex; //< Index of the first of LooseOctreeScene::ChildNodeCount contiguous child nodes.
+        AZStd::vector<VisibilityEntry*> m_entries;
+    };
+
+    //! Implementation of the visibility scene interface using a loose octree.
+    //! Compared to OctreeScene, entries never straddle child nodes, so inserts are a single descent of the tree and moving
+    //! entries usually stay bound to the same node. Those updates only need shared access to the scene, so many threads
+    //! can update moving entries concurrently without contending on an exclusive lock.
+    //! Node bounds are stored as separate arrays so all children of a node can be culled together, and sphere and frustum
+    //! queries can be split across task graph workers.
+    class LooseOctreeScene
+        : public IVisibilityScene
+    {
+    public:
+        AZ_RTTI(LooseOctreeScene, "{4F0C8E57-3B6A-4C8B-9E5D-1C2B7A9F6D31}", IVisibilityScene);
+        AZ_CLASS_ALLOCATOR(LooseOctreeScene, AZ::SystemAllocator, 0);
+        AZ_DISABLE_COPY_MOVE(LooseOctreeScene);
+
+        static constexpr uint32_t ChildNodeCount = 8;
+        static constexpr uint32_t RootNodeIndex = 0;
+
+        explicit LooseOctreeScene(const AZ::Name& sceneName);
+        ~LooseOctreeScene() override;
+
+        //! IVisibilityScene overrides.
+        //! @{
+        const AZ::Name& GetName() const override;
+        void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries) override;
+        void RemoveEntry(VisibilityEntry& entry) override;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateParallel(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        uint32_t GetEntryCount() const override;
+        //! @}
+
+        //! Stats
+        //! @{
+        uint32_t GetNodeCount() const;
+        uint32_t GetFreeNodeCount() const;
+        uint32_t GetPageCount() const;
+        void DumpStats();
+        //! @}
+
+    private:
+        // Culls the separately stored loose bounds of a block of child nodes against the bounding volume.
+        // Returns a bitmask with bit N set if child N overlaps the bounding volume.
+        template <typename T>
+        uint32_t CullChildren(uint32_t firstChild, const T& boundingVolume) const;
+
+        template <typename T>
+        void EnumerateHelper(const LooseOctreeNode& node, const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        template <typename T>
+        void EnumerateParallelHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        void EnumerateNoCullHelper(const LooseOctreeNode& node, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        // Returns true if the entry can stay bound to its current node, in which case updating it doesn't modify the tree.
+        bool IsEntryInPlace(const VisibilityEntry& entry) const;
+
+        // The following functions require exclusive access to the scene.
+        void InsertOrUpdateEntryLocked(VisibilityEntry& entry);
+        void Insert(LooseOctreeNode& node, VisibilityEntry& entry);
+        void Detach(LooseOctreeNode& node, VisibilityEntry& entry);
+        void Split(LooseOctreeNode& node);
+        void TryMerge(LooseOctreeNode& node);
+        void Merge(LooseOctreeNode& node);
+
+        uint32_t AllocateChildNodes();
+        void ReleaseChildNodes(uint32_t firstChild);
+        LooseOctreeNode& GetNode(uint32_t nodeIndex) const;
+        void SetNodeBounds(const LooseOctreeNode& node);
+        void ResizeNodeBounds();
+
+        mutable AZStd::shared_mutex m_sharedMutex;
+
+        AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+        uint32_t m_maxDepth = 0; //< Depth beyond which nodes are never split.
+
+        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the scene.
+        uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes allocated by the scene, at least one for the root node.
+
+        static constexpr uint32_t PageSize = 8192; //< The number of nodes that can be stored in each page
+        static_assert(PageSize % ChildNodeCount == 0, "PageSize must be a multiple of ChildNodeCount");
+
+        using LooseOctreeNodePage = AZStd::array<LooseOctreeNode, PageSize>;
+        AZStd::vector<LooseOctreeNodePage*> m_nodePages; //< Node storage, pages are never reallocated so nodes have stable addresses.
+        uint32_t m_allocatedNodeCount = 0; //< Number of nodes handed out from m_nodePages, including ones on the free list.
+                                           //< The root node is stored at RootNodeIndex, in an otherwise unused first block.
+        AZStd::stack<uint32_t> m_freeChildNodes; //< Indices of free blocks of ChildNodeCount nodes.
+
+        // Loose bounds of every allocated node, indexed by node index.
+        // These are laid out for AZ::ShapeIntersection::OverlapsBatch, so each block of child nodes is culled with a single call.
+        //! @{
+        AZStd::vector<float> m_boundsMinX;
+        AZStd::vector<float> m_boundsMinY;
+        AZStd::vector<float> m_boundsMinZ;
+        AZStd::vector<float> m_boundsMaxX;
+        AZStd::vector<float> m_boundsMaxY;
+        AZStd::vector<float> m_boundsMaxZ;
+        //! @}
+    };
+}
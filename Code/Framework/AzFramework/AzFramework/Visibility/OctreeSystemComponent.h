@@ -92,7 +92,7 @@ namespace AzFramework
         : public IVisibilityScene
     {
     public:
-        AZ_RTTI(OctreeScene, "{A88E4D86-11F1-4E3F-A91A-66DE99502B93}");
+        AZ_RTTI(OctreeScene, "{A88E4D86-11F1-4E3F-A91A-66DE99502B93}", IVisibilityScene);
         AZ_CLASS_ALLOCATOR(OctreeScene, AZ::SystemAllocator, 0);
         AZ_DISABLE_COPY_MOVE(OctreeScene);
 
@@ -103,6 +103,7 @@ namespace AzFramework
         //! @{
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries) override;
         void RemoveEntry(VisibilityEntry& entry) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
@@ -178,11 +179,14 @@ namespace AzFramework
         //! @}
 
     private:
+        //! Creates a new scene using the spatial index selected by bg_visibilityUseLooseOctree.
+        static IVisibilityScene* CreateScene(const AZ::Name& sceneName);
+
         //! The default scene used for most entities (e.g. gameplay, networking)
-        OctreeScene* m_defaultScene = nullptr;
+        IVisibilityScene* m_defaultScene = nullptr;
 
         //! Other scenes (e.g. each rendering scene) are stored here and looked up by name.
-        AZStd::vector<OctreeScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
+        AZStd::vector<IVisibilityScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
         
     };
 }
@@ -50,6 +50,8 @@ set(FILES
     Asset/AssetCatalog.cpp
     Asset/AssetCatalogComponent.h
     Asset/AssetCatalogComponent.cpp
+    Asset/AssetCatalogImage.h
+    Asset/AssetCatalogImage.cpp
     Asset/AssetProcessorMessages.cpp
     Asset/AssetProcessorMessages.h
     Asset/AssetRegistry.h
@@ -402,6 +404,8 @@ set(FILES
     Visibility/IVisibilitySystem.h
     Visibility/OctreeSystemComponent.h
     Visibility/OctreeSystemComponent.cpp
+    Visibility/LooseOctreeScene.h
+    Visibility/LooseOctreeScene.cpp
     Visibility/BoundsBus.h
     Visibility/BoundsBus.cpp
     Visibility/VisibilityDebug.h
@@ -24,6 +24,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Asset/AssetCatalog.h>
+#include <AzFramework/Asset/AssetCatalogImage.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
 #include <AzFramework/Asset/GenericAssetHandler.h>
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
@@ -835,6 +836,153 @@ namespace UnitTest
         CheckNoDependencies(asset1);
     }
 
+    TEST_F(AssetCatalogDeltaTest, CatalogImage_LoadedAsBaseCatalog_DeltaCatalogsLayeredOnTop)
+    {
+        AZStd::string assetPath;
+
+        // sourcecatalog2 - asset1 path3 (depends on asset 2), asset2 path2, asset4 path4, asset5 path5 (depends on asset 2)
+        AZStd::shared_ptr<AzFramework::AssetRegistry> sourceCatalog = AzFramework::AssetCatalog::LoadCatalogFromFile(sourceCatalogPath2);
+        ASSERT_TRUE(sourceCatalog);
+        AZStd::string imagePath = GetTestFolderPath() + "AssetCatalogImage.bin";
+        ASSERT_TRUE(AzFramework::AssetCatalogImage::SaveToFile(imagePath.c_str(), *sourceCatalog));
+
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::ClearCatalog);
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::LoadCatalog, imagePath.c_str());
+
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path3);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset2);
+        EXPECT_EQ(assetPath, path2);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset4);
+        EXPECT_EQ(assetPath, path4);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset5);
+        EXPECT_EQ(assetPath, path5);
+        CheckDirectDependencies(asset1, { asset2 });
+        CheckDirectDependencies(asset5, { asset2 });
+        CheckNoDependencies(asset4);
+
+        AssetId assetId;
+        AssetCatalogRequestBus::BroadcastResult(assetId, &AssetCatalogRequestBus::Events::GetAssetIdByPath, path4, AZ::Data::s_invalidAssetType, false);
+        EXPECT_EQ(assetId, asset4);
+
+        // deltacatalog3 - asset1 path6 asset5 path4 (depends on asset 2)
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::AddDeltaCatalog, deltaCatalog3);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path6);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset2);
+        EXPECT_EQ(assetPath, path2);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset5);
+        EXPECT_EQ(assetPath, path4);
+        CheckNoDependencies(asset1);
+        CheckDirectDependencies(asset5, { asset2 });
+
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::RemoveDeltaCatalog, deltaCatalog3);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path3);
+        CheckDirectDependencies(asset1, { asset2 });
+
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::UnregisterAsset, asset4);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset4);
+        EXPECT_EQ(assetPath, "");
+        AssetCatalogRequestBus::BroadcastResult(assetId, &AssetCatalogRequestBus::Events::GetAssetIdByPath, path4, AZ::Data::s_invalidAssetType, false);
+        EXPECT_FALSE(assetId.IsValid());
+    }
+
+    TEST_F(AssetCatalogDeltaTest, CatalogImage_LoadedAsDeltaCatalog_MatchesSourceCatalog)
+    {
+        AZStd::string imagePath = GetTestFolderPath() + "AssetCatalogDeltaImage.bin";
+        ASSERT_TRUE(AzFramework::AssetCatalogImage::SaveToFile(imagePath.c_str(), *deltaCatalog3));
+
+        AZStd::shared_ptr<AzFramework::AssetRegistry> imageCatalog = AzFramework::AssetCatalog::LoadCatalogFromFile(imagePath.c_str());
+        ASSERT_TRUE(imageCatalog);
+        EXPECT_EQ(imageCatalog->m_assetIdToInfo.size(), deltaCatalog3->m_assetIdToInfo.size());
+        EXPECT_EQ(imageCatalog->m_assetIdToInfo[asset1].m_relativePath, path6);
+        EXPECT_EQ(imageCatalog->GetAssetIdByPath(path4), asset5);
+        EXPECT_TRUE(Search(imageCatalog->GetAssetDependencies(asset5), asset2));
+    }
+
+    class AssetCatalogImageTest
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(AssetCatalogImageTest, Build_ManyAssets_EveryLookupFindsItsAsset)
+    {
+        constexpr int AssetCount = 2000;
+
+        AzFramework::AssetRegistry registry;
+        AZStd::vector<AssetId> assetIds;
+        for (int i = 0; i < AssetCount; ++i)
+        {
+            AssetInfo assetInfo;
+            assetInfo.m_assetId = AssetId(AZ::Uuid::CreateRandom(), i % 3);
+            assetInfo.m_assetType = AZ::Uuid::CreateRandom();
+            assetInfo.m_relativePath = AZStd::string::format("folder/asset%d.txt", i);
+            assetInfo.m_sizeBytes = i;
+            registry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+            if (i > 0)
+            {
+                registry.RegisterAssetDependency(assetInfo.m_assetId, ProductDependency(assetIds.back(), 0));
+            }
+            assetIds.push_back(assetInfo.m_assetId);
+        }
+        const AssetId legacyAssetId(AZ::Uuid::CreateRandom(), 0);
+        registry.RegisterLegacyAssetMapping(legacyAssetId, assetIds[10]);
+
+        AZStd::vector<AZ::u8> imageData;
+        ASSERT_TRUE(AzFramework::AssetCatalogImage::Build(registry, imageData));
+        AZStd::unique_ptr<AzFramework::AssetCatalogImage> image = AzFramework::AssetCatalogImage::Create(AZStd::vector<char>(imageData.begin(), imageData.end()));
+        ASSERT_TRUE(image);
+        EXPECT_EQ(image->GetAssetCount(), static_cast<size_t>(AssetCount));
+
+        AssetInfo assetInfo;
+        AZStd::vector<ProductDependency> dependencies;
+        for (int i = 0; i < AssetCount; ++i)
+        {
+            const AssetInfo& expectedInfo = registry.m_assetIdToInfo[assetIds[i]];
+            ASSERT_TRUE(image->GetAssetInfo(assetIds[i], assetInfo));
+            EXPECT_EQ(assetInfo.m_assetId, expectedInfo.m_assetId);
+            EXPECT_EQ(assetInfo.m_assetType, expectedInfo.m_assetType);
+            EXPECT_EQ(assetInfo.m_relativePath, expectedInfo.m_relativePath);
+            EXPECT_EQ(assetInfo.m_sizeBytes, expectedInfo.m_sizeBytes);
+            EXPECT_EQ(image->GetAssetIdByPath(expectedInfo.m_relativePath.c_str()), assetIds[i]);
+
+            if (i > 0)
+            {
+                ASSERT_TRUE(image->GetAssetDependencies(assetIds[i], dependencies));
+                ASSERT_EQ(dependencies.size(), 1u);
+                EXPECT_EQ(dependencies[0].m_assetId, assetIds[i - 1]);
+            }
+            else
+            {
+                EXPECT_FALSE(image->GetAssetDependencies(assetIds[i], dependencies));
+            }
+        }
+
+        EXPECT_EQ(image->GetAssetIdByLegacyAssetId(legacyAssetId), assetIds[10]);
+        EXPECT_FALSE(image->GetAssetIdByLegacyAssetId(assetIds[10]).IsValid());
+        EXPECT_FALSE(image->GetAssetInfo(AssetId(AZ::Uuid::CreateRandom(), 0), assetInfo));
+        EXPECT_FALSE(image->GetAssetIdByPath("folder/missing.txt").IsValid());
+    }
+
+    TEST_F(AssetCatalogImageTest, Create_TruncatedData_ReturnsNull)
+    {
+        AzFramework::AssetRegistry registry;
+        AssetInfo assetInfo;
+        assetInfo.m_assetId = AssetId(AZ::Uuid::CreateRandom(), 0);
+        assetInfo.m_relativePath = "asset.txt";
+        registry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+
+        AZStd::vector<AZ::u8> imageData;
+        ASSERT_TRUE(AzFramework::AssetCatalogImage::Build(registry, imageData));
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZStd::unique_ptr<AzFramework::AssetCatalogImage> image =
+            AzFramework::AssetCatalogImage::Create(AZStd::vector<char>(imageData.begin(), imageData.end() - 4));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(image);
+    }
+
     class AssetCatalogAPITest
         : public AllocatorsFixture
     {
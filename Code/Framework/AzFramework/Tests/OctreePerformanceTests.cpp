@@ -8,6 +8,10 @@
 
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -34,7 +38,14 @@ namespace Benchmark
                 AZ::NameDictionary::Create();
             }
             m_octreeSystemComponent = new AzFramework::OctreeSystemComponent;
-            m_visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeBenchmarkVisibilityScene"));
+            if (m_useLooseOctree)
+            {
+                m_visScene = aznew AzFramework::LooseOctreeScene(AZ::Name("LooseOctreeBenchmarkVisibilityScene"));
+            }
+            else
+            {
+                m_visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeBenchmarkVisibilityScene"));
+            }
             m_dataArray.resize(1000000);
             m_queryDataArray.resize(1000);
 
@@ -73,7 +84,14 @@ namespace Benchmark
 
         void internalTearDown()
         {
-            m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+            if (m_useLooseOctree)
+            {
+                delete m_visScene;
+            }
+            else
+            {
+                m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+            }
             delete m_octreeSystemComponent;
             AZ::NameDictionary::Destroy();
 
@@ -125,6 +143,18 @@ namespace Benchmark
             }
         }
 
+        // Moves every entry a small distance and updates the scene with a single batch, similar to a frame of moving entities
+        void MoveEntries(uint32_t entryCount, const AZ::Vector3& offset)
+        {
+            m_movedEntries.clear();
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                m_dataArray[i].m_boundingVolume.Translate(offset);
+                m_movedEntries.push_back(&m_dataArray[i]);
+            }
+            m_visScene->InsertOrUpdateEntries(m_movedEntries);
+        }
+
         struct QueryData
         {
             AZ::Aabb aabb;
@@ -133,7 +163,9 @@ namespace Benchmark
         };
 
         bool m_ownsSystemAllocator = false;
+        bool m_useLooseOctree = false;
         AZStd::vector<AzFramework::VisibilityEntry> m_dataArray;
+        AZStd::vector<AzFramework::VisibilityEntry*> m_movedEntries;
         AZStd::vector<QueryData> m_queryDataArray;
         AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
         AzFramework::IVisibilityScene* m_visScene = nullptr;
@@ -346,6 +378,137 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, MoveEntries100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        float direction = 1.0f;
+        for (auto _ : state)
+        {
+            MoveEntries(EntryCount, AZ::Vector3(direction));
+            direction = -direction;
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    class BM_LooseOctree
+        : public BM_Octree
+        , public AZ::TaskGraphActiveInterface
+    {
+    public:
+        BM_LooseOctree()
+        {
+            m_useLooseOctree = true;
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+
+        void SetUpTaskExecutor()
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+            m_executor = aznew AZ::TaskExecutor();
+            AZ::TaskExecutor::SetInstance(m_executor);
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+        }
+
+        void TearDownTaskExecutor()
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+            AZ::TaskExecutor::SetInstance(nullptr);
+            azdestroy(m_executor);
+            m_executor = nullptr;
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        AZ::TaskExecutor* m_executor = nullptr;
+    };
+
+    BENCHMARK_F(BM_LooseOctree, InsertDelete100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        for (auto _ : state)
+        {
+            InsertEntries(EntryCount);
+            RemoveEntries(EntryCount);
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctree, MoveEntries100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        float direction = 1.0f;
+        for (auto _ : state)
+        {
+            MoveEntries(EntryCount, AZ::Vector3(direction));
+            direction = -direction;
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateAabb100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateSphere100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateFrustum100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateParallelFrustum100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        SetUpTaskExecutor();
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateParallel(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+        TearDownTaskExecutor();
+    }
 }
 
 #endif
@@ -11,6 +11,13 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -420,4 +427,334 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, static_cast<uint32_t>(visEntries.size()));
     }
+
+    class LooseOctreeTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            // Create the SystemAllocator if not available
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
+            m_console = aznew AZ::Console();
+            AZ::Interface<AZ::IConsole>::Register(m_console);
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            m_console->GetCvarValue("bg_looseOctreeNodeMaxEntries", m_savedMaxEntries);
+            m_console->GetCvarValue("bg_looseOctreeNodeMinEntries", m_savedMinEntries);
+            m_console->GetCvarValue("bg_octreeMaxWorldExtents", m_savedBounds);
+
+            // To ease unit testing, configure the loose octree to only allow one entry per node
+            m_console->PerformCommand("bg_looseOctreeNodeMaxEntries 1");
+            m_console->PerformCommand("bg_looseOctreeNodeMinEntries 1");
+            m_console->PerformCommand("bg_octreeMaxWorldExtents 1"); // Create a -1,-1,-1 to 1,1,1 world volume
+
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+            }
+            m_looseOctreeScene = aznew LooseOctreeScene(AZ::Name("LooseOctreeUnitTestScene"));
+        }
+
+        void TearDown() override
+        {
+            // Restore cvars for any future tests or benchmarks that might get executed
+            AZStd::string commandString;
+            commandString.format("bg_looseOctreeNodeMaxEntries %u", m_savedMaxEntries);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_looseOctreeNodeMinEntries %u", m_savedMinEntries);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_octreeMaxWorldExtents %f", m_savedBounds);
+            m_console->PerformCommand(commandString.c_str());
+
+            delete m_looseOctreeScene;
+            m_looseOctreeScene = nullptr;
+
+            AZ::NameDictionary::Destroy();
+
+            AZ::Interface<AZ::IConsole>::Unregister(m_console);
+            delete m_console;
+            m_console = nullptr;
+
+            // Destroy system allocator only if it was created by this environment
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+                m_ownsSystemAllocator = false;
+            }
+        }
+
+        bool m_ownsSystemAllocator = false;
+        LooseOctreeScene* m_looseOctreeScene = nullptr;
+        uint32_t m_savedMaxEntries = 0;
+        uint32_t m_savedMinEntries = 0;
+        float m_savedBounds = 0.0f;
+        AZ::Console* m_console;
+    };
+
+    TEST_F(LooseOctreeTests, InsertDeleteSingleEntry)
+    {
+        AzFramework::VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode != nullptr);
+        EXPECT_TRUE(visEntry.m_internalNodeIndex == 0);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 1);
+
+        m_looseOctreeScene->RemoveEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+    }
+
+    TEST_F(LooseOctreeTests, InsertDeleteSplitMerge)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[0]);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 1);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1);
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]); // This should force a split of the root node
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 2);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1 + LooseOctreeScene::ChildNodeCount);
+        EXPECT_NE(visEntry[0].m_internalNode, visEntry[1].m_internalNode);
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[2]); // This should force a split of the roots +/+/+ child node
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 3);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1 + (2 * LooseOctreeScene::ChildNodeCount));
+        EXPECT_NE(visEntry[1].m_internalNode, visEntry[2].m_internalNode);
+
+        m_looseOctreeScene->RemoveEntry(visEntry[2]);
+        EXPECT_TRUE(visEntry[2].m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 2);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1 + LooseOctreeScene::ChildNodeCount);
+
+        m_looseOctreeScene->RemoveEntry(visEntry[1]);
+        EXPECT_TRUE(visEntry[1].m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 1);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1);
+        EXPECT_EQ(m_looseOctreeScene->GetFreeNodeCount(), 2 * LooseOctreeScene::ChildNodeCount);
+
+        m_looseOctreeScene->RemoveEntry(visEntry[0]);
+        EXPECT_TRUE(visEntry[0].m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+    }
+
+    TEST_F(LooseOctreeTests, UpdateEntryWithinLooseBounds_EntryStaysInNode)
+    {
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[0]);
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]);
+        const VisibilityNode* originalNode = visEntry[1].m_internalNode;
+
+        // Straddles the center of the +/+/+ child cell, which would push the entry up the tree in a regular octree
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.4f), AZ::Vector3(0.7f));
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(visEntry[1].m_internalNode, originalNode);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 2);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1 + LooseOctreeScene::ChildNodeCount);
+
+        // Moving the entry center to a different cell requires it to move to a different node
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.4f, 0.6f, 0.6f), AZ::Vector3(-0.1f, 0.9f, 0.9f));
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_NE(visEntry[1].m_internalNode, originalNode);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 2);
+
+        m_looseOctreeScene->RemoveEntry(visEntry[0]);
+        m_looseOctreeScene->RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1);
+    }
+
+    TEST_F(LooseOctreeTests, InsertOrUpdateEntries_BatchMatchesSingleUpdates)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        AZStd::vector<VisibilityEntry*> entries = { &visEntry[0], &visEntry[1], &visEntry[2] };
+
+        m_looseOctreeScene->InsertOrUpdateEntries(entries);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 3);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1 + (2 * LooseOctreeScene::ChildNodeCount));
+
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        m_looseOctreeScene->InsertOrUpdateEntries(entries);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 3);
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.8f), AZ::Vector3(0.9f));
+        m_looseOctreeScene->Enumerate(bounds, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        EXPECT_EQ(gatheredEntries.size(), 1);
+        EXPECT_EQ(gatheredEntries[0], &visEntry[0]);
+
+        m_looseOctreeScene->RemoveEntry(visEntry[0]);
+        m_looseOctreeScene->RemoveEntry(visEntry[1]);
+        m_looseOctreeScene->RemoveEntry(visEntry[2]);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateSphereSingleEntry)
+    {
+        AZ::Sphere bounds = AZ::Sphere::CreateUnitSphere();
+        EnumerateSingleEntryHelper(m_looseOctreeScene, bounds);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateAabbSingleEntry)
+    {
+        AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(1.0f));
+        EnumerateSingleEntryHelper(m_looseOctreeScene, bounds);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateFrustumSingleEntry)
+    {
+        AZ::Vector3 frustumOrigin = AZ::Vector3(0.0f, -2.0f, 0.0f);
+        AZ::Quaternion frustumDirection = AZ::Quaternion::CreateIdentity();
+        AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, frustumOrigin);
+        AZ::Frustum bounds = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 3.0f));
+        EnumerateSingleEntryHelper(m_looseOctreeScene, bounds);
+    }
+
+    // Node bounds are loose, so the partial bounds need to stay clear of the neighboring nodes loose bounds
+    TEST_F(LooseOctreeTests, EnumerateSphereMultipleEntries)
+    {
+        AZ::Sphere bound1 = AZ::Sphere::CreateUnitSphere();
+        AZ::Sphere bound2 = AZ::Sphere(AZ::Vector3(-0.9f), 0.3f);
+        AZ::Sphere bound3 = AZ::Sphere(AZ::Vector3(0.85f), 0.05f);
+        EnumerateMultipleEntriesHelper(m_looseOctreeScene, bound1, bound2, bound3);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateAabbMultipleEntries)
+    {
+        AZ::Aabb bound1 = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3( 1.0f));
+        AZ::Aabb bound2 = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(-0.6f));
+        AZ::Aabb bound3 = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.8f), AZ::Vector3( 0.9f));
+        EnumerateMultipleEntriesHelper(m_looseOctreeScene, bound1, bound2, bound3);
+    }
+
+    TEST_F(LooseOctreeTests, InsertOrUpdateEntry_OverFillRootNodeWithLargeEntries_EntriesAreNotLost)
+    {
+        AzFramework::VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-2.0f), AZ::Vector3(2.0f));
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(4, visEntry);
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_looseOctreeScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, static_cast<uint32_t>(visEntries.size()));
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_looseOctreeScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, static_cast<uint32_t>(visEntries.size()));
+    }
+
+    class LooseOctreeParallelTests
+        : public LooseOctreeTests
+        , public AZ::TaskGraphActiveInterface
+    {
+    public:
+        void SetUp() override
+        {
+            LooseOctreeTests::SetUp();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_executor = aznew AZ::TaskExecutor();
+            AZ::TaskExecutor::SetInstance(m_executor);
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+
+            m_console->GetCvarValue("bg_looseOctreeParallelSplitDepth", m_savedSplitDepth);
+            m_console->PerformCommand("bg_looseOctreeParallelSplitDepth 1");
+        }
+
+        void TearDown() override
+        {
+            AZStd::string commandString;
+            commandString.format("bg_looseOctreeParallelSplitDepth %u", m_savedSplitDepth);
+            m_console->PerformCommand(commandString.c_str());
+
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+            AZ::TaskExecutor::SetInstance(nullptr);
+            azdestroy(m_executor);
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            LooseOctreeTests::TearDown();
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+
+        AZ::TaskExecutor* m_executor = nullptr;
+        uint32_t m_savedSplitDepth = 0;
+    };
+
+    template <typename BoundType>
+    void EnumerateParallelMatchesSerialHelper(IVisibilityScene* visScene, const BoundType& bounds)
+    {
+        AZStd::vector<VisibilityEntry*> serialEntries;
+        visScene->Enumerate(bounds, [&serialEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(serialEntries, nodeData); });
+
+        AZStd::mutex gatherMutex;
+        AZStd::vector<VisibilityEntry*> parallelEntries;
+        visScene->EnumerateParallel(bounds, [&gatherMutex, &parallelEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(gatherMutex);
+            AppendEntries(parallelEntries, nodeData);
+        });
+
+        EXPECT_FALSE(serialEntries.empty());
+        AZStd::sort(serialEntries.begin(), serialEntries.end());
+        AZStd::sort(parallelEntries.begin(), parallelEntries.end());
+        EXPECT_EQ(serialEntries, parallelEntries);
+    }
+
+    TEST_F(LooseOctreeParallelTests, EnumerateParallel_ManyEntries_MatchesSerialEnumerate)
+    {
+        constexpr uint32_t EntryCount = 256;
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+
+        std::default_random_engine generator;
+        std::uniform_real_distribution<float> distribution(-0.95f, 0.95f);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            const AZ::Vector3 center(distribution(generator), distribution(generator), distribution(generator));
+            entry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(0.01f));
+            m_looseOctreeScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, EntryCount);
+
+        EnumerateParallelMatchesSerialHelper(m_looseOctreeScene, AZ::Sphere::CreateUnitSphere());
+        EnumerateParallelMatchesSerialHelper(m_looseOctreeScene, AZ::Sphere(AZ::Vector3(0.5f), 0.25f));
+
+        AZ::Vector3 frustumOrigin = AZ::Vector3(0.0f, -2.0f, 0.0f);
+        AZ::Quaternion frustumDirection = AZ::Quaternion::CreateIdentity();
+        AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, frustumOrigin);
+        EnumerateParallelMatchesSerialHelper(m_looseOctreeScene, AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 3.0f)));
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_looseOctreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1);
+    }
 }
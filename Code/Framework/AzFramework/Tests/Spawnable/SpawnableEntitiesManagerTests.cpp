@@ -393,6 +393,82 @@ namespace UnitTest
         m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_MultipleTicketsShareSpawnable_EntityIdsAreUniqueAndMappedPerTicket)
+    {
+        // Tickets spawning from the same spawnable share the same clone plan. This tests that entities without references only
+        // get new ids, and that entities with references still get their references mapped within their own ticket.
+        static constexpr size_t NumEntities = 4;
+        for (bool withReferences : { false, true })
+        {
+            FillSpawnable(NumEntities);
+            if (withReferences)
+            {
+                CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+            }
+
+            AZStd::unordered_set<AZ::EntityId> entityIds;
+            for (const auto& entity : m_spawnable->GetEntities())
+            {
+                entityIds.emplace(entity->GetId());
+            }
+
+            auto callback = [this, &entityIds, withReferences]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                EXPECT_EQ(NumEntities, entities.size());
+                for (const AZ::Entity* entity : entities)
+                {
+                    EXPECT_TRUE(entityIds.emplace(entity->GetId()).second);
+                }
+                if (withReferences)
+                {
+                    ValidateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular, NumEntities, entities);
+                }
+            };
+
+            AzFramework::EntitySpawnTicket secondTicket(*m_spawnableAsset);
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = callback;
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            AzFramework::SpawnAllEntitiesOptionalArgs secondOptionalArgs;
+            secondOptionalArgs.m_completionCallback = callback;
+            m_manager->SpawnAllEntities(secondTicket, AZStd::move(secondOptionalArgs));
+            m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+            // Two tickets with their own copy of the entities, plus the template entities themselves.
+            EXPECT_EQ(NumEntities * 3, entityIds.size());
+        }
+    }
+
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ReferencesAddedWithoutChangingIds_EntityIdsAreMappedCorrectly)
+    {
+        // The clone plan of a spawnable without references only gives the clones new ids. This tests that adding references to
+        // the spawnable in place, while keeping the same entity ids, rebuilds the plan so the new references get mapped as well.
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        m_manager->SpawnAllEntities(*m_ticket);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceFirst);
+
+        size_t spawnedEntityCount = 0;
+        auto callback = [this, &spawnedEntityCount]
+            (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntityCount = entities.size();
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceFirst, NumEntities, entities);
+        };
+        delete m_ticket;
+        m_ticket = new AzFramework::EntitySpawnTicket(*m_spawnableAsset);
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        EXPECT_EQ(NumEntities, spawnedEntityCount);
+    }
+
 
     //
     // SpawnEntities
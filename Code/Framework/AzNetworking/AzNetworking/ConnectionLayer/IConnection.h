@@ -95,6 +95,23 @@ namespace AzNetworking
         //! @return the max transmission unit for this connection
         virtual uint32_t GetConnectionMtu() const = 0;
 
+        //! Returns the number of bytes that can be sent right now without congesting the connection.
+        //! Higher layers can use this to decide how much optional traffic to send, it is not enforced by the connection.
+        //! Currently unsupported on TcpConnections
+        //! @return the number of bytes that can be sent right now, the max uint32_t value if the connection doesn't limit sends
+        virtual uint32_t GetSendBudget() const = 0;
+
+        //! Returns the rate this connection can currently sustain without congestion.
+        //! Currently unsupported on TcpConnections
+        //! @return the send rate in bytes per second, 0 if the connection doesn't limit its send rate
+        virtual uint32_t GetSendRateBytesPerSecond() const = 0;
+
+        //! Returns whether packets sent on this connection are bit packed.
+        //! Higher layers can use this to bit pack payloads they serialize ahead of time, like entity updates.
+        //! Currently unsupported on TcpConnections
+        //! @return boolean true if packets sent on this connection are bit packed
+        virtual bool IsBitPackingEnabled() const = 0;
+
         //! Returns the connection identifier for this connection instance.
         //! @return the connection identifier for this connection instance
         ConnectionId GetConnectionId() const;
@@ -97,7 +97,7 @@ namespace AzNetworking
         SizeType size = static_cast<SizeType>(GetSize());
         uint32_t outSize = size;
 
-        return serializer.Serialize(size, "Size")
+        return serializer.Serialize(size, "Size", 0, static_cast<SizeType>(SIZE))
             && Resize(size)
             && serializer.SerializeBytes(m_buffer.data(), static_cast<uint32_t>(GetCapacity()), false, outSize, "Buffer")
             && (outSize == size);
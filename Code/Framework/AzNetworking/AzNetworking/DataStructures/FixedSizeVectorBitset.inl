@@ -33,6 +33,37 @@ namespace AzNetworking
         return *this;
     }
 
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator ==(const SelfType& rhs) const
+    {
+        if (m_count != rhs.m_count)
+        {
+            return false;
+        }
+        const uint32_t fullElementSize = GetSize() / BitsetType::ElementTypeBits;
+        for (uint32_t i = 0; i < fullElementSize; ++i)
+        {
+            if (m_bitset.GetContainer()[i] != rhs.m_bitset.GetContainer()[i])
+            {
+                return false;
+            }
+        }
+        // Bits beyond the current size of the last element are not guaranteed to be cleared, so mask them off
+        const uint32_t remainingBits = GetSize() % BitsetType::ElementTypeBits;
+        if (remainingBits > 0)
+        {
+            const ElementType mask = static_cast<ElementType>((static_cast<ElementType>(0x01) << remainingBits) - 1);
+            return (m_bitset.GetContainer()[fullElementSize] & mask) == (rhs.m_bitset.GetContainer()[fullElementSize] & mask);
+        }
+        return true;
+    }
+
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator !=(const SelfType& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
     template <AZStd::size_t CAPACITY, typename ElementType>
     inline void FixedSizeVectorBitset<CAPACITY, ElementType>::SetBit(uint32_t index, bool value)
     {
@@ -164,23 +195,37 @@ namespace AzNetworking
         static constexpr uint32_t NumBytesRequiredForSize = AZ::RequiredBytesForValue<CAPACITY>();
         using SizeType = typename AZ::SizeType<NumBytesRequiredForSize, false>::Type;
 
-        // m_count is always less than CAPACITY, so should fit safely in SizeType
+        // m_count is never more than CAPACITY, so should fit safely in SizeType
+        // The bounds don't change what byte aligned serializers write, but let bit packing serializers skip the unused bits
         SizeType count = static_cast<SizeType>(m_count);
-        if (!serializer.Serialize(count, "Count"))
+        if (!serializer.Serialize(count, "Count", 0, static_cast<SizeType>(CAPACITY)))
         {
             return false;
         }
         m_count = count;
 
-        const uint32_t numBytesToSerialize = (m_count + 7) / 8; // Round up nearest byte
+        const uint32_t numFullBytes = m_count / 8;
         uint8_t* bitsetContainer = reinterpret_cast<uint8_t*>(m_bitset.GetContainer().data());
-        for (uint32_t i = 0; i < numBytesToSerialize; ++i)
+        for (uint32_t i = 0; i < numFullBytes; ++i)
         {
             if (!serializer.Serialize(bitsetContainer[i], "Byte"))
             {
                 return false;
             }
         }
+
+        // Bits beyond the current size of the last byte are not guaranteed to be cleared, so mask them off
+        const uint32_t remainingBits = m_count % 8;
+        if (remainingBits > 0)
+        {
+            const uint8_t mask = static_cast<uint8_t>((1 << remainingBits) - 1);
+            uint8_t lastByte = bitsetContainer[numFullBytes] & mask;
+            if (!serializer.Serialize(lastByte, "Byte", 0, mask))
+            {
+                return false;
+            }
+            bitsetContainer[numFullBytes] = lastByte;
+        }
         ClearUnusedBits();
         return true;
     }
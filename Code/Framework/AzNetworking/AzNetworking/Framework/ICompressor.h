@@ -48,6 +48,10 @@ namespace AzNetworking
         //! Unique identifier of a given compressor.
         virtual CompressorType GetType() const = 0;
 
+        //! Returns true if packets have to be decompressed in the order they were compressed, for example because compression
+        //! history is kept across packets.  Such compressors can't be used by protocols that may drop or reorder packets, like UDP.
+        virtual bool RequiresOrderedDelivery() const { return false; }
+
         //! Returns max possible size of uncompressed data chunk needed to fit compressed data in maxCompSize bytes.
         virtual AZStd::size_t GetMaxChunkSize(AZStd::size_t maxCompSize) const = 0;
 
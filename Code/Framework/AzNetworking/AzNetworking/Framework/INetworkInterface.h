@@ -87,6 +87,13 @@ namespace AzNetworking
         //! @return the unreliable packet identifier of the transmitted packet
         virtual PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) = 0;
 
+        //! Starts coalescing outgoing packets so the transport can hand them to the socket layer with fewer system calls, calls may be nested.
+        //! Packets sent while a batch is open are only guaranteed to be transmitted once the outermost batch ends.
+        virtual void BeginSendBatch() = 0;
+
+        //! Ends a batch started by BeginSendBatch, transmitting any coalesced packets if it was the outermost batch.
+        virtual void EndSendBatch() = 0;
+
         //! Returns true if the given packet id was confirmed acknowledged by the remote endpoint, false otherwise.
         //! @param connectionId identifier of the connection to send to
         //! @param packetId   the packet id of the packet to confirm acknowledgment of
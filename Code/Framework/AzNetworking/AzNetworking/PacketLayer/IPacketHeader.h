@@ -23,6 +23,7 @@ namespace AzNetworking
 
     AZ_ENUM_CLASS(PacketFlag
         , Compressed
+        , BitPacked
         , MAX
     );
     using PacketFlagBitset = FixedSizeBitset<1, uint8_t>;
@@ -37,8 +38,8 @@ namespace AzNetworking
     //! 
     //! The PacketFlags portion of the header represents the first byte of the header.  While it can be encrypted it is
     //! otherwise not exposed to additional processing (such as an AzNetworking::ICompressor).  PacketFlags are a bitfield use to provide up
-    //! front information about the state of the packet. Currently there is only one flag to indicate if the Packet is
-    //! compressed or not.
+    //! front information about the state of the packet, such as whether the Packet is compressed, or whether the remainder
+    //! of the header and the payload were written by a NetworkBitInputSerializer rather than a NetworkInputSerializer.
     //! 
     //! The remainder of the header contains the PacketType and the PacketId. While the PacketFlags byte is exempt from most
     //! additional forms of processing, the remainder of the header is not.
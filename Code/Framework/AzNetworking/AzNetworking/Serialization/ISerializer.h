@@ -189,6 +189,22 @@ namespace AzNetworking
         //! @return size of the data contained in the serialization buffer in bytes
         virtual uint32_t GetSize() const = 0;
 
+        //! Returns true if the serializer packs values into bits instead of aligning them to bytes.
+        //! Serialized data can only be shared between serializers that agree on this.
+        //! @return boolean true if the serializer packs values into bits
+        virtual bool IsBitPacked() const;
+
+        //! Returns the size of the data contained in the serialization buffer in bits.
+        //! @return size of the data contained in the serialization buffer in bits
+        virtual uint32_t GetSizeInBits() const;
+
+        //! Appends bits previously written by a serializer that packs values the same way, so serialized data can be shared.
+        //! Serializers that don't support this invalidate themselves.
+        //! @param data     pointer to the bits to copy, starting at the least significant bit of the first byte
+        //! @param bitCount number of bits to copy
+        //! @return boolean true on success, false if the bits could not be copied
+        virtual bool CopyBitsToBuffer(const uint8_t* data, uint32_t bitCount);
+
         //! This is a helper for network serialization.
         //! It clears the track changes flag internal to some serializers
         virtual void ClearTrackedChangesFlag() = 0;
@@ -102,6 +102,22 @@ namespace AzNetworking
         m_serializerValid = false;
     }
 
+    inline bool ISerializer::IsBitPacked() const
+    {
+        return false;
+    }
+
+    inline uint32_t ISerializer::GetSizeInBits() const
+    {
+        return GetSize() * 8;
+    }
+
+    inline bool ISerializer::CopyBitsToBuffer([[maybe_unused]] const uint8_t* data, [[maybe_unused]] uint32_t bitCount)
+    {
+        m_serializerValid = false;
+        return false;
+    }
+
     template <typename TYPE>
     inline bool ISerializer::Serialize(TYPE& value, const char* name)
     {
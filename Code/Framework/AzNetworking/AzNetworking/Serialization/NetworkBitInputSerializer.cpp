@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/algorithm.h>
+#include <memory>
+
+namespace AzNetworking
+{
+    NetworkBitInputSerializer::NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    SerializerMode NetworkBitInputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::ReadFromObject;
+    }
+
+    bool NetworkBitInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        return WriteBits(value ? 1 : 0, 1);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(float));
+        return WriteBits(bits, 32);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(double));
+        return WriteBits(bits, 64);
+    }
+
+    bool NetworkBitInputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        return SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize) && WriteBytes(buffer, outSize);
+    }
+
+    bool NetworkBitInputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitInputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetSize() const
+    {
+        // A partially written trailing byte still has to be transmitted
+        return (m_bitPosition + 7) / 8;
+    }
+
+    bool NetworkBitInputSerializer::IsBitPacked() const
+    {
+        return true;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetSizeInBits() const
+    {
+        return m_bitPosition;
+    }
+
+    bool NetworkBitInputSerializer::CopyBitsToBuffer(const uint8_t* data, uint32_t bitCount)
+    {
+        const uint32_t byteCount = bitCount / 8;
+        const uint32_t remainingBits = bitCount & 7;
+        return WriteBytes(data, byteCount) && ((remainingBits == 0) || WriteBits(data[byteCount], remainingBits));
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitInputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue)
+    {
+        m_serializerValid &= (inputValue >= minValue);
+        m_serializerValid &= (inputValue <= maxValue);
+
+        // Offsets are computed in unsigned 64-bit space so ranges spanning a whole signed type don't overflow
+        const uint64_t valueRange = static_cast<uint64_t>(maxValue) - static_cast<uint64_t>(minValue);
+        const uint64_t valueOffset = static_cast<uint64_t>(inputValue) - static_cast<uint64_t>(minValue);
+        return WriteBits(valueOffset, GetBitCountForRange(valueRange));
+    }
+
+    bool NetworkBitInputSerializer::WriteBits(uint64_t value, uint32_t bitCount)
+    {
+        if (!m_serializerValid || (static_cast<uint64_t>(m_bitPosition) + bitCount > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        while (bitCount > 0)
+        {
+            const uint32_t byteIndex = m_bitPosition >> 3;
+            const uint32_t bitOffset = m_bitPosition & 7;
+            const uint32_t bitsToWrite = AZStd::min(8 - bitOffset, bitCount);
+            const uint8_t bits = static_cast<uint8_t>((value & ((1u << bitsToWrite) - 1)) << bitOffset);
+
+            // The buffer may hold stale data, so a byte is overwritten the first time it's touched and merged into afterwards
+            m_buffer[byteIndex] = (bitOffset == 0) ? bits : static_cast<uint8_t>(m_buffer[byteIndex] | bits);
+
+            value >>= bitsToWrite;
+            bitCount -= bitsToWrite;
+            m_bitPosition += bitsToWrite;
+        }
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::WriteBytes(const uint8_t* data, uint32_t count)
+    {
+        if ((m_bitPosition & 7) != 0)
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                if (!WriteBits(data[i], 8))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        const uint32_t currSize = m_bitPosition / 8;
+        const uint64_t nextSize = static_cast<uint64_t>(currSize) + count;
+        if (!m_serializerValid || (nextSize > m_bufferCapacity))
+        {
+            m_serializerValid = false;
+            return false;
+        }
+
+        memcpy(m_buffer + currSize, data, count);
+        m_bitPosition += count * 8;
+        return true;
+    }
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/algorithm.h>
+#include <memory>
+
+namespace AzNetworking
+{
+    NetworkBitOutputSerializer::NetworkBitOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetReadSizeInBits() const
+    {
+        return m_bitPosition;
+    }
+
+    SerializerMode NetworkBitOutputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::WriteToObject;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        uint64_t bits = 0;
+        if (ReadBits(bits, 1))
+        {
+            value = (bits != 0);
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        uint64_t bits = 0;
+        if (ReadBits(bits, 32))
+        {
+            const uint32_t floatBits = static_cast<uint32_t>(bits);
+            memcpy(&value, &floatBits, sizeof(float));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        if (ReadBits(bits, 64))
+        {
+            memcpy(&value, &bits, sizeof(double));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        return SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize) && ReadBytes(buffer, outSize);
+    }
+
+    bool NetworkBitOutputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitOutputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetSize() const
+    {
+        return (m_bitPosition + 7) / 8;
+    }
+
+    bool NetworkBitOutputSerializer::IsBitPacked() const
+    {
+        return true;
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitOutputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE& outValue)
+    {
+        const uint64_t valueRange = static_cast<uint64_t>(maxValue) - static_cast<uint64_t>(minValue);
+        uint64_t valueOffset = 0;
+        if (ReadBits(valueOffset, GetBitCountForRange(valueRange)))
+        {
+            // Ranges that aren't a power of two leave bit patterns that a valid writer never produces
+            m_serializerValid &= (valueOffset <= valueRange);
+            if (m_serializerValid)
+            {
+                outValue = static_cast<ORIGINAL_TYPE>(static_cast<uint64_t>(minValue) + valueOffset);
+            }
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::ReadBits(uint64_t& outValue, uint32_t bitCount)
+    {
+        outValue = 0;
+        if (!m_serializerValid || (static_cast<uint64_t>(m_bitPosition) + bitCount > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        uint32_t bitsRead = 0;
+        while (bitsRead < bitCount)
+        {
+            const uint32_t byteIndex = m_bitPosition >> 3;
+            const uint32_t bitOffset = m_bitPosition & 7;
+            const uint32_t bitsToRead = AZStd::min(8 - bitOffset, bitCount - bitsRead);
+            const uint64_t bits = (m_buffer[byteIndex] >> bitOffset) & ((1u << bitsToRead) - 1);
+
+            outValue |= bits << bitsRead;
+            bitsRead += bitsToRead;
+            m_bitPosition += bitsToRead;
+        }
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::ReadBytes(uint8_t* data, uint32_t count)
+    {
+        if ((m_bitPosition & 7) != 0)
+        {
+            uint64_t bits = 0;
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                if (!ReadBits(bits, 8))
+                {
+                    return false;
+                }
+                data[i] = static_cast<uint8_t>(bits);
+            }
+            return true;
+        }
+
+        const uint32_t currSize = m_bitPosition / 8;
+        const uint64_t nextSize = static_cast<uint64_t>(currSize) + count;
+        if (!m_serializerValid || (nextSize > m_bufferCapacity))
+        {
+            m_serializerValid = false;
+            return false;
+        }
+
+        memcpy(data, m_buffer + currSize, count);
+        m_bitPosition += count * 8;
+        return true;
+    }
+}
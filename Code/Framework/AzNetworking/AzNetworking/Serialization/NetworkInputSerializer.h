@@ -51,6 +51,7 @@ namespace AzNetworking
         const uint8_t* GetBuffer() const override;
         uint32_t GetCapacity() const override;
         uint32_t GetSize() const override;
+        bool CopyBitsToBuffer(const uint8_t* data, uint32_t bitCount) override;
         void ClearTrackedChangesFlag() override {}
         bool GetTrackedChangesFlag() const override { return false; }
         // ISerializer interfaces
@@ -14,4 +14,15 @@ namespace AzNetworking
     {
         return SerializeBytes(data, dataSize);
     }
+
+    inline bool NetworkInputSerializer::CopyBitsToBuffer(const uint8_t* data, uint32_t bitCount)
+    {
+        // Everything this serializer writes is byte aligned, so partial bytes can't have come from a matching serializer
+        if ((bitCount & 7) != 0)
+        {
+            m_serializerValid = false;
+            return false;
+        }
+        return CopyToBuffer(data, bitCount / 8);
+    }
 }
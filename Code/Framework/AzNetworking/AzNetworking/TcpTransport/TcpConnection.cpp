@@ -261,6 +261,21 @@ namespace AzNetworking
         return 0; // do nothing, unsupported on TCP connections
     }
 
+    uint32_t TcpConnection::GetSendBudget() const
+    {
+        return AZStd::numeric_limits<uint32_t>::max(); // unsupported on TCP connections, the TCP stack does its own congestion control
+    }
+
+    uint32_t TcpConnection::GetSendRateBytesPerSecond() const
+    {
+        return 0; // unsupported on TCP connections, the TCP stack does its own congestion control
+    }
+
+    bool TcpConnection::IsBitPackingEnabled() const
+    {
+        return false; // unsupported on TCP connections
+    }
+
     bool TcpConnection::SendPacketInternal(PacketType packetType, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs)
     {
         AZ_Assert(payloadBuffer.GetCapacity() < AZStd::numeric_limits<uint16_t>::max(), "Buffer capacity should be representable using 2 bytes or less");
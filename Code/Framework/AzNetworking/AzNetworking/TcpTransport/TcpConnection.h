@@ -102,6 +102,9 @@ namespace AzNetworking
         bool Disconnect(DisconnectReason reason, TerminationEndpoint endpoint) override;
         void SetConnectionMtu(uint32_t connectionMtu) override;
         uint32_t GetConnectionMtu() const override;
+        uint32_t GetSendBudget() const override;
+        uint32_t GetSendRateBytesPerSecond() const override;
+        bool IsBitPackingEnabled() const override;
         // @}
 
         //! Sets the registered socket file descriptor for this TcpConnection in the associated ConnectionSet instance.
@@ -148,6 +148,16 @@ namespace AzNetworking
         return connection->SendUnreliablePacket(packet);
     }
 
+    void TcpNetworkInterface::BeginSendBatch()
+    {
+        // No-op, TCP sends are written straight to the connection stream
+    }
+
+    void TcpNetworkInterface::EndSendBatch()
+    {
+        ;
+    }
+
     bool TcpNetworkInterface::WasPacketAcked(ConnectionId connectionId, PacketId packetId)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
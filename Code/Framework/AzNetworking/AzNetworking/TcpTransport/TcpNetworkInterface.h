@@ -96,6 +96,8 @@ namespace AzNetworking
         void Update(AZ::TimeMs deltaTimeMs) override;
         bool SendReliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) override;
+        void BeginSendBatch() override;
+        void EndSendBatch() override;
         bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) override;
         bool StopListening() override;
         bool Disconnect(ConnectionId connectionId, DisconnectReason reason) override;
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR(float, net_UdpPacingGain, 1.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scalar applied to the congestion window over the round trip time to get the pacing rate once slow start has ended");
+    AZ_CVAR(float, net_UdpSlowStartPacingGain, 2.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scalar applied to the congestion window over the round trip time to get the pacing rate during slow start");
+    AZ_CVAR(float, net_UdpCongestionBackoff, 0.5f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scalar applied to the congestion window when packet loss is detected");
+    AZ_CVAR(AZ::TimeMs, net_UdpPacingMaxBurstMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "The max amount of unused pacing budget, in milliseconds, a connection may bank for a burst of sends");
+
+    // Weights used to smooth round trip time samples, these are the values recommended by RFC 6298
+    static constexpr float RttAlpha = 0.125f;
+    static constexpr float RttBeta = 0.25f;
+
+    // Weight of a single ack or loss in the smoothed loss rate
+    static constexpr float LossRateAlpha = 1.0f / 32.0f;
+
+    UdpCongestionController::UdpCongestionController(uint32_t maxSegmentSize)
+        : m_maxSegmentSize(AZStd::max<uint32_t>(maxSegmentSize, 1))
+    {
+        Reset();
+    }
+
+    void UdpCongestionController::Reset()
+    {
+        m_sentPackets.fill(SentPacket());
+        m_congestionWindow = InitialWindowSegments * m_maxSegmentSize;
+        m_slowStartThreshold = AZStd::numeric_limits<uint32_t>::max();
+        m_bytesInFlight = 0;
+        m_bytesAckedInAvoidance = 0;
+        m_recoveryStartMs = AZ::TimeMs{ -1 };
+        m_lastWindowLimitedMs = AZ::TimeMs{ -1 };
+        m_hasRttSample = false;
+        m_smoothedRttMs = InitialRttMs;
+        m_rttVariationMs = InitialRttMs * 0.5f;
+        m_lossRate = 0.0f;
+
+        // The initial window can go out immediately
+        m_pacingBudget = static_cast<float>(m_congestionWindow);
+        m_lastPacingUpdateMs = AZ::TimeMs{ 0 };
+    }
+
+    void UdpCongestionController::SetMaxSegmentSize(uint32_t maxSegmentSize)
+    {
+        m_maxSegmentSize = AZStd::max<uint32_t>(maxSegmentSize, 1);
+        m_congestionWindow = AZStd::max(m_congestionWindow, GetMinCongestionWindow());
+    }
+
+    void UdpCongestionController::OnPacketSent(PacketId packetId, uint32_t packetSize, AZ::TimeMs currentTimeMs)
+    {
+        SentPacket& sentPacket = m_sentPackets[static_cast<uint32_t>(packetId) % MaxTrackedPackets];
+        if (sentPacket.m_packetId != InvalidPacketId)
+        {
+            // Too many packets in flight to track them all, forget the oldest without treating it as lost
+            m_bytesInFlight -= sentPacket.m_packetSize;
+        }
+
+        sentPacket.m_packetId = packetId;
+        sentPacket.m_sendTimeMs = currentTimeMs;
+        sentPacket.m_packetSize = packetSize;
+        m_bytesInFlight += packetSize;
+        if (static_cast<uint64_t>(m_bytesInFlight) * 2 >= m_congestionWindow)
+        {
+            m_lastWindowLimitedMs = currentTimeMs;
+        }
+
+        RefillPacingBudget(currentTimeMs);
+        m_pacingBudget -= static_cast<float>(packetSize);
+    }
+
+    void UdpCongestionController::OnPacketAcked(PacketId packetId, AZ::TimeMs currentTimeMs)
+    {
+        SentPacket ackedPacket;
+        if (!RemoveSentPacket(packetId, ackedPacket))
+        {
+            return;
+        }
+
+        UpdateRtt(static_cast<float>(currentTimeMs - ackedPacket.m_sendTimeMs));
+        UpdateLossRate(false);
+
+        // Don't grow the window if the sender hasn't been using it since this packet was sent,
+        // otherwise a quiet connection could build up a window far beyond what the link handles
+        const bool windowLimited = (m_lastWindowLimitedMs >= ackedPacket.m_sendTimeMs);
+        if (!windowLimited || (ackedPacket.m_sendTimeMs <= m_recoveryStartMs))
+        {
+            return;
+        }
+
+        if (IsInSlowStart())
+        {
+            m_congestionWindow += ackedPacket.m_packetSize;
+        }
+        else
+        {
+            // Grow by one segment for each full window of acked bytes, roughly one segment per round trip
+            m_bytesAckedInAvoidance += ackedPacket.m_packetSize;
+            if (m_bytesAckedInAvoidance >= m_congestionWindow)
+            {
+                m_bytesAckedInAvoidance -= m_congestionWindow;
+                m_congestionWindow += m_maxSegmentSize;
+            }
+        }
+        m_congestionWindow = AZStd::min(m_congestionWindow, MaxCongestionWindow);
+    }
+
+    void UdpCongestionController::OnPacketLost(PacketId packetId, AZ::TimeMs currentTimeMs)
+    {
+        SentPacket lostPacket;
+        if (!RemoveSentPacket(packetId, lostPacket))
+        {
+            return;
+        }
+
+        UpdateLossRate(true);
+
+        // Packets sent before the last reduction were sent with the old window, losing them shouldn't reduce it again
+        if (lostPacket.m_sendTimeMs <= m_recoveryStartMs)
+        {
+            return;
+        }
+
+        const float backoff = AZStd::clamp(static_cast<float>(net_UdpCongestionBackoff), 0.1f, 1.0f);
+        m_congestionWindow = AZStd::max(static_cast<uint32_t>(static_cast<float>(m_congestionWindow) * backoff), GetMinCongestionWindow());
+        m_slowStartThreshold = m_congestionWindow;
+        m_bytesAckedInAvoidance = 0;
+        m_recoveryStartMs = currentTimeMs;
+        AZLOG(NET_Congestion, "Packet id %u lost, congestion window reduced to %u bytes", static_cast<uint32_t>(packetId), m_congestionWindow);
+    }
+
+    uint32_t UdpCongestionController::GetSendBudget(AZ::TimeMs currentTimeMs) const
+    {
+        const uint32_t windowBudget = (m_congestionWindow > m_bytesInFlight) ? (m_congestionWindow - m_bytesInFlight) : 0;
+        const float pacingBudget = AZStd::max(GetPacingBudget(currentTimeMs), 0.0f);
+        return AZStd::min(windowBudget, static_cast<uint32_t>(pacingBudget));
+    }
+
+    uint32_t UdpCongestionController::GetSendRateBytesPerSecond() const
+    {
+        return static_cast<uint32_t>(AZStd::min(GetPacingRateBytesPerMs() * 1000.0f, static_cast<float>(AZStd::numeric_limits<uint32_t>::max())));
+    }
+
+    AZ::TimeMs UdpCongestionController::GetRetransmitTimeoutMs() const
+    {
+        const float timeoutMs = m_smoothedRttMs + AZStd::max(4.0f * m_rttVariationMs, 1.0f);
+        return AZ::TimeMs{ static_cast<int64_t>(timeoutMs) };
+    }
+
+    bool UdpCongestionController::RemoveSentPacket(PacketId packetId, SentPacket& outPacket)
+    {
+        SentPacket& sentPacket = m_sentPackets[static_cast<uint32_t>(packetId) % MaxTrackedPackets];
+        if ((packetId == InvalidPacketId) || (sentPacket.m_packetId != packetId))
+        {
+            return false;
+        }
+
+        outPacket = sentPacket;
+        m_bytesInFlight -= sentPacket.m_packetSize;
+        sentPacket = SentPacket();
+        return true;
+    }
+
+    void UdpCongestionController::UpdateRtt(float sampleRttMs)
+    {
+        sampleRttMs = AZStd::max(sampleRttMs, 0.0f);
+        if (!m_hasRttSample)
+        {
+            m_smoothedRttMs = sampleRttMs;
+            m_rttVariationMs = sampleRttMs * 0.5f;
+            m_hasRttSample = true;
+            return;
+        }
+
+        m_rttVariationMs = (1.0f - RttBeta) * m_rttVariationMs + RttBeta * AZ::GetAbs(m_smoothedRttMs - sampleRttMs);
+        m_smoothedRttMs = (1.0f - RttAlpha) * m_smoothedRttMs + RttAlpha * sampleRttMs;
+    }
+
+    void UdpCongestionController::UpdateLossRate(bool lost)
+    {
+        m_lossRate = (1.0f - LossRateAlpha) * m_lossRate + (lost ? LossRateAlpha : 0.0f);
+    }
+
+    void UdpCongestionController::RefillPacingBudget(AZ::TimeMs currentTimeMs)
+    {
+        m_pacingBudget = GetPacingBudget(currentTimeMs);
+        m_lastPacingUpdateMs = AZStd::max(m_lastPacingUpdateMs, currentTimeMs);
+    }
+
+    float UdpCongestionController::GetPacingBudget(AZ::TimeMs currentTimeMs) const
+    {
+        const float pacingRate = GetPacingRateBytesPerMs();
+        const float elapsedMs = static_cast<float>(AZStd::max(currentTimeMs - m_lastPacingUpdateMs, AZ::TimeMs{ 0 }));
+
+        // Banking budget is capped so an idle connection can't release a burst larger than the link absorbs
+        const float maxBudget = AZStd::max(pacingRate * static_cast<float>(static_cast<AZ::TimeMs>(net_UdpPacingMaxBurstMs)), static_cast<float>(GetMinCongestionWindow()));
+        if (m_pacingBudget >= maxBudget)
+        {
+            return m_pacingBudget;
+        }
+        return AZStd::min(m_pacingBudget + pacingRate * elapsedMs, maxBudget);
+    }
+
+    float UdpCongestionController::GetPacingRateBytesPerMs() const
+    {
+        const float pacingGain = IsInSlowStart() ? net_UdpSlowStartPacingGain : net_UdpPacingGain;
+        return pacingGain * static_cast<float>(m_congestionWindow) / AZStd::max(m_smoothedRttMs, 1.0f);
+    }
+}
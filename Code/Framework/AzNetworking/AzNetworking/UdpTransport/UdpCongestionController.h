@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/Time/ITime.h>
+
+namespace AzNetworking
+{
+    //! @class UdpCongestionController
+    //! @brief Window based congestion control and send pacing for a single Udp connection.
+    //!
+    //! Round trip time and loss are estimated from the ack and timeout results of the packets a connection sends. The
+    //! congestion window grows like TCP Reno, doubling every round trip during slow start and by one segment per round
+    //! trip afterwards, and is cut back at most once per round trip when packets are lost. Sends are paced at a rate
+    //! derived from the window and the smoothed round trip time.
+    //!
+    //! The controller never holds back packets itself, reliable resends must always go out. Instead it reports a send
+    //! budget and a send rate that higher layers use to decide how much optional traffic to generate.
+    class UdpCongestionController
+    {
+    public:
+
+        //! Constructor.
+        //! @param maxSegmentSize the maximum size of a single packet in bytes, generally the connection MTU
+        explicit UdpCongestionController(uint32_t maxSegmentSize = MaxUdpTransmissionUnit);
+
+        //! Resets all estimates and the congestion window to their initial values.
+        void Reset();
+
+        //! Sets the maximum segment size, the window grows and shrinks in units of this size.
+        //! @param maxSegmentSize the maximum size of a single packet in bytes, generally the connection MTU
+        void SetMaxSegmentSize(uint32_t maxSegmentSize);
+
+        //! Invoked whenever a packet is sent.
+        //! @param packetId      identifier of the packet being sent
+        //! @param packetSize    size of the packet in bytes
+        //! @param currentTimeMs current process time in milliseconds
+        void OnPacketSent(PacketId packetId, uint32_t packetSize, AZ::TimeMs currentTimeMs);
+
+        //! Invoked whenever a sent packet is acknowledged by the remote endpoint.
+        //! @param packetId      identifier of the packet being acked
+        //! @param currentTimeMs current process time in milliseconds
+        void OnPacketAcked(PacketId packetId, AZ::TimeMs currentTimeMs);
+
+        //! Invoked whenever a sent packet is determined to be lost.
+        //! @param packetId      identifier of the lost packet
+        //! @param currentTimeMs current process time in milliseconds
+        void OnPacketLost(PacketId packetId, AZ::TimeMs currentTimeMs);
+
+        //! Returns the number of bytes that can be sent right now without exceeding the congestion window or the pacing rate.
+        //! @param currentTimeMs current process time in milliseconds
+        //! @return the number of bytes that can be sent right now
+        uint32_t GetSendBudget(AZ::TimeMs currentTimeMs) const;
+
+        //! Returns the rate sends are currently paced at.
+        //! @return the pacing rate in bytes per second
+        uint32_t GetSendRateBytesPerSecond() const;
+
+        //! Returns the current congestion window in bytes.
+        //! @return the current congestion window in bytes
+        uint32_t GetCongestionWindow() const;
+
+        //! Returns the number of bytes sent that have been neither acked nor lost yet.
+        //! @return the number of bytes in flight
+        uint32_t GetBytesInFlight() const;
+
+        //! Returns whether the window is still growing exponentially.
+        //! @return boolean true if the controller is in slow start
+        bool IsInSlowStart() const;
+
+        //! Returns the smoothed round trip time estimate.
+        //! @return the smoothed round trip time in milliseconds
+        float GetSmoothedRttMs() const;
+
+        //! Returns the round trip time variation estimate.
+        //! @return the round trip time variation in milliseconds
+        float GetRttVariationMs() const;
+
+        //! Returns the time after which an unacked packet is likely to be lost, based on the round trip time estimates.
+        //! @return the retransmission timeout in milliseconds
+        AZ::TimeMs GetRetransmitTimeoutMs() const;
+
+        //! Returns a smoothed estimate of the fraction of sent packets that are lost.
+        //! @return the estimated loss rate, between 0 and 1
+        float GetLossRate() const;
+
+    private:
+
+        struct SentPacket
+        {
+            PacketId   m_packetId = InvalidPacketId;
+            AZ::TimeMs m_sendTimeMs = AZ::TimeMs{ 0 };
+            uint32_t   m_packetSize = 0;
+        };
+
+        //! Removes a packet from the in flight set, returns false if the packet isn't tracked.
+        bool RemoveSentPacket(PacketId packetId, SentPacket& outPacket);
+        void UpdateRtt(float sampleRttMs);
+        void UpdateLossRate(bool lost);
+        void RefillPacingBudget(AZ::TimeMs currentTimeMs);
+        float GetPacingBudget(AZ::TimeMs currentTimeMs) const;
+        float GetPacingRateBytesPerMs() const;
+        uint32_t GetMinCongestionWindow() const;
+
+        static constexpr uint32_t MaxTrackedPackets = 256;
+        static constexpr uint32_t InitialWindowSegments = 10;
+        static constexpr uint32_t MinWindowSegments = 2;
+        static constexpr uint32_t MaxCongestionWindow = 4 * 1024 * 1024;
+        static constexpr float InitialRttMs = 100.0f; //< Start off with a 100 millisecond estimate for Rtt, same as ConnectionComputeRtt
+
+        AZStd::array<SentPacket, MaxTrackedPackets> m_sentPackets;
+        uint32_t   m_maxSegmentSize = MaxUdpTransmissionUnit;
+        uint32_t   m_congestionWindow = 0;
+        uint32_t   m_slowStartThreshold = 0;
+        uint32_t   m_bytesInFlight = 0;
+        uint32_t   m_bytesAckedInAvoidance = 0;
+        AZ::TimeMs m_recoveryStartMs = AZ::TimeMs{ 0 };
+        AZ::TimeMs m_lastWindowLimitedMs = AZ::TimeMs{ 0 };
+        bool       m_hasRttSample = false;
+        float      m_smoothedRttMs = InitialRttMs;
+        float      m_rttVariationMs = InitialRttMs * 0.5f;
+        float      m_lossRate = 0.0f;
+        float      m_pacingBudget = 0.0f;
+        AZ::TimeMs m_lastPacingUpdateMs = AZ::TimeMs{ 0 };
+    };
+}
+
+#include <AzNetworking/UdpTransport/UdpCongestionController.inl>
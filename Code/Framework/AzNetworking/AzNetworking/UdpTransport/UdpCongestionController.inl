@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    inline uint32_t UdpCongestionController::GetCongestionWindow() const
+    {
+        return m_congestionWindow;
+    }
+
+    inline uint32_t UdpCongestionController::GetBytesInFlight() const
+    {
+        return m_bytesInFlight;
+    }
+
+    inline bool UdpCongestionController::IsInSlowStart() const
+    {
+        return m_congestionWindow < m_slowStartThreshold;
+    }
+
+    inline float UdpCongestionController::GetSmoothedRttMs() const
+    {
+        return m_smoothedRttMs;
+    }
+
+    inline float UdpCongestionController::GetRttVariationMs() const
+    {
+        return m_rttVariationMs;
+    }
+
+    inline float UdpCongestionController::GetLossRate() const
+    {
+        return m_lossRate;
+    }
+
+    inline uint32_t UdpCongestionController::GetMinCongestionWindow() const
+    {
+        return MinWindowSegments * m_maxSegmentSize;
+    }
+}
@@ -16,10 +16,13 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/limits.h>
 
 namespace AzNetworking
 {
     AZ_CVAR(uint32_t, net_UdpMaxUnackedPacketCount, 10, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum packets to receive before forcing a heartbeat packet for acking");
+    AZ_CVAR(bool, net_UdpBitPackPackets, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, new Udp connections send bit packed packets, the remote endpoint must support reading them");
+    AZ_CVAR(bool, net_UdpCongestionControl, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, new Udp connections limit their send budget and send rate using congestion control");
 
     // Track every 8th packet to determine Rtt
     // Only reason we're doing every 8th packet instead of every packet is to reduce per-packet overhead
@@ -50,6 +53,8 @@ namespace AzNetworking
         , m_networkInterface(networkInterface)
         , m_lastSentPacketMs(AZ::GetElapsedTimeMs())
         , m_connectionRole(connectionRole)
+        , m_bitPackingEnabled(net_UdpBitPackPackets)
+        , m_congestionControlEnabled(net_UdpCongestionControl)
     {
         ;
     }
@@ -143,6 +148,7 @@ namespace AzNetworking
     void UdpConnection::SetConnectionMtu(uint32_t connectionMtu)
     {
         m_connectionMtu = connectionMtu;
+        m_congestionController.SetMaxSegmentSize(connectionMtu);
     }
 
     uint32_t UdpConnection::GetConnectionMtu() const
@@ -150,11 +156,39 @@ namespace AzNetworking
         return m_connectionMtu;
     }
 
+    uint32_t UdpConnection::GetSendBudget() const
+    {
+        if (!m_congestionControlEnabled)
+        {
+            return AZStd::numeric_limits<uint32_t>::max();
+        }
+        return m_congestionController.GetSendBudget(AZ::GetElapsedTimeMs());
+    }
+
+    uint32_t UdpConnection::GetSendRateBytesPerSecond() const
+    {
+        return m_congestionControlEnabled ? m_congestionController.GetSendRateBytesPerSecond() : 0;
+    }
+
+    void UdpConnection::SetCongestionControlEnabled(bool enabled)
+    {
+        if (enabled && !m_congestionControlEnabled)
+        {
+            m_congestionController.Reset();
+        }
+        m_congestionControlEnabled = enabled;
+    }
+
     void UdpConnection::ProcessAcked(PacketId packetId, AZ::TimeMs currentTimeMs)
     {
         GetMetrics().LogPacketAcked();
         m_reliableQueue.OnPacketAcked(m_networkInterface, *this, packetId);
 
+        if (m_congestionControlEnabled)
+        {
+            m_congestionController.OnPacketAcked(packetId, currentTimeMs);
+        }
+
         // Compute Rtt adjustments
         if (IncludePacketInRtt(packetId))
         {
@@ -172,6 +206,11 @@ namespace AzNetworking
             GetMetrics().m_connectionRtt.LogPacketSent(packetId, currentTimeMs);
         }
 
+        if (m_congestionControlEnabled)
+        {
+            m_congestionController.OnPacketSent(packetId, packetSize, currentTimeMs);
+        }
+
         GetMetrics().LogPacketSent(packetSize, currentTimeMs);
         m_lastSentPacketMs = currentTimeMs;
         m_unackedPacketCount = 0;
@@ -193,6 +232,10 @@ namespace AzNetworking
 
         case PacketAckState::Nacked:
             GetMetrics().LogPacketLost();
+            if (m_congestionControlEnabled)
+            {
+                m_congestionController.OnPacketLost(packetId, AZ::GetElapsedTimeMs());
+            }
             if (reliability == ReliabilityType::Reliable)
             {
                 m_reliableQueue.OnPacketLost(m_networkInterface, *this, packetId);
@@ -205,6 +248,10 @@ namespace AzNetworking
         case PacketAckState::Unknown_TooOld:
             // TODO: Disconnect?
             AZLOG_ERROR("PacketId %u timeout fell outside the ack history window", static_cast<uint32_t>(packetId));
+            if (m_congestionControlEnabled)
+            {
+                m_congestionController.OnPacketLost(packetId, AZ::GetElapsedTimeMs());
+            }
             break;
 
         default:
@@ -215,7 +262,7 @@ namespace AzNetworking
         return PacketTimeoutResult::Lost;
     }
 
-    bool UdpConnection::ProcessReceived(UdpPacketHeader& header, [[maybe_unused]] const NetworkOutputSerializer& serializer, 
+    bool UdpConnection::ProcessReceived(UdpPacketHeader& header, [[maybe_unused]] const ISerializer& serializer, 
         uint32_t packetSize, AZ::TimeMs currentTimeMs)
     {
         if (!m_packetTracker.ProcessReceived(this, header))
@@ -11,6 +11,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpReliableQueue.h>
 #include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
@@ -66,6 +67,9 @@ namespace AzNetworking
         bool Disconnect(DisconnectReason reason, TerminationEndpoint endpoint) override;
         void SetConnectionMtu(uint32_t connectionMtu) override;
         uint32_t GetConnectionMtu() const override;
+        uint32_t GetSendBudget() const override;
+        uint32_t GetSendRateBytesPerSecond() const override;
+        bool IsBitPackingEnabled() const override;
         // @}
 
         //! Returns a suitable encryption endpoint for this connection type.
@@ -97,6 +101,24 @@ namespace AzNetworking
         //! @return the timeout identifier for this connection instance
         TimeoutId GetTimeoutId() const;
 
+        //! Sets whether packets sent on this connection are bit packed.
+        //! Bit packed packets are flagged as such, so the remote endpoint doesn't need to use the same setting.
+        //! @param enabled if true, packets are written by a NetworkBitInputSerializer instead of a NetworkInputSerializer
+        void SetBitPackingEnabled(bool enabled);
+
+        //! Sets whether this connection runs congestion control on the packets it sends.
+        //! Enabling congestion control restarts the controller from its initial estimates.
+        //! @param enabled if true, the send budget and send rate reported by this connection are limited by its congestion controller
+        void SetCongestionControlEnabled(bool enabled);
+
+        //! Returns whether this connection runs congestion control on the packets it sends.
+        //! @return boolean true if congestion control is enabled
+        bool IsCongestionControlEnabled() const;
+
+        //! Const access to the congestion controller of this connection.
+        //! @return const reference to the congestion controller of this connection
+        const UdpCongestionController& GetCongestionController() const;
+
     protected:
 
         //! Prepare a reliable packet for transmission.
@@ -124,7 +146,7 @@ namespace AzNetworking
         //! @param packetSize    the size of the received packet in bytes
         //! @param currentTimeMs current wall clock time in milliseconds
         //! @return boolean true on successful handling of the received header
-        bool ProcessReceived(UdpPacketHeader& header, const NetworkOutputSerializer& serializer, uint32_t packetSize, AZ::TimeMs currentTimeMs);
+        bool ProcessReceived(UdpPacketHeader& header, const ISerializer& serializer, uint32_t packetSize, AZ::TimeMs currentTimeMs);
 
         //! Handle a core network packet.
         //! @param listener   a connection listener to receive connection related events
@@ -142,10 +164,13 @@ namespace AzNetworking
         ConnectionState   m_state = ConnectionState::Disconnected;
         ConnectionRole    m_connectionRole = ConnectionRole::Connector;
         DtlsEndpoint      m_dtlsEndpoint;
+        UdpCongestionController m_congestionController;
 
         AZ::TimeMs m_lastSentPacketMs;
         uint32_t   m_unackedPacketCount = 0;
         uint32_t   m_connectionMtu = MaxUdpTransmissionUnit;
+        bool       m_bitPackingEnabled = false;
+        bool       m_congestionControlEnabled = false;
 
         TimeoutId m_timeoutId;
         uint32_t  m_timeoutCounter = 0;
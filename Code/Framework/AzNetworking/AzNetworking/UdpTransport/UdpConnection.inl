@@ -40,6 +40,26 @@ namespace AzNetworking
         return m_timeoutId;
     }
 
+    inline void UdpConnection::SetBitPackingEnabled(bool enabled)
+    {
+        m_bitPackingEnabled = enabled;
+    }
+
+    inline bool UdpConnection::IsBitPackingEnabled() const
+    {
+        return m_bitPackingEnabled;
+    }
+
+    inline bool UdpConnection::IsCongestionControlEnabled() const
+    {
+        return m_congestionControlEnabled;
+    }
+
+    inline const UdpCongestionController& UdpConnection::GetCongestionController() const
+    {
+        return m_congestionController;
+    }
+
     inline bool UdpConnection::PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
     {
         return m_reliableQueue.PrepareForSend(packetId, reliableSequenceId, packet);
@@ -10,6 +10,7 @@
 #include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -133,22 +134,24 @@ namespace AzNetworking
         // We can erase all the chunks now, packet is completed
         m_packetFragments.erase(fragmentSequence);
 
-        NetworkOutputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+        // The flags are always byte aligned, and tell us which serializer wrote the rest of the packet
+        NetworkOutputSerializer flagSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+        if (!header.SerializePacketFlags(flagSerializer))
         {
-            ISerializer& networkISerializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+            AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed packet flags serialization");
+            return PacketDispatchResult::Failure;
+        }
 
-            // First, serialize out the header
-            if (!header.SerializePacketFlags(networkSerializer))
-            {
-                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed packet flags serialization");
-                return PacketDispatchResult::Failure;
-            }
+        NetworkOutputSerializer byteSerializer(flagSerializer.GetUnreadData(), flagSerializer.GetUnreadSize());
+        NetworkBitOutputSerializer bitSerializer(flagSerializer.GetUnreadData(), flagSerializer.GetUnreadSize());
+        ISerializer& networkSerializer = header.IsPacketFlagSet(PacketFlag::BitPacked)
+            ? static_cast<ISerializer&>(bitSerializer)
+            : static_cast<ISerializer&>(byteSerializer);
 
-            if (!networkISerializer.Serialize(header, "Header"))
-            {
-                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed header serialization");
-                return PacketDispatchResult::Failure;
-            }
+        if (!networkSerializer.Serialize(header, "Header"))
+        {
+            AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed header serialization");
+            return PacketDispatchResult::Failure;
         }
         connection->GetPacketTracker().ProcessReceived(connection, header);
         PacketDispatchResult handledPacket;
@@ -13,6 +13,8 @@
 #include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Framework/ICompressor.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
@@ -65,6 +67,12 @@ namespace AzNetworking
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         const AZ::Name compressorName = AZ::Name(compressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
+        if (m_compressor && m_compressor->RequiresOrderedDelivery())
+        {
+            // Unreliable packets may be dropped or arrive out of order, which would desync the decompressor of the remote endpoint
+            AZLOG_ERROR("Compressor %s requires ordered delivery and can't be used for UDP, disabling compression", compressor.c_str());
+            m_compressor = nullptr;
+        }
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
@@ -174,6 +182,9 @@ namespace AzNetworking
             return;
         }
 
+        // Acks, handshake replies, heartbeats and retransmits generated during the update all go out together at the end
+        m_socket->BeginSendBatch();
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -262,9 +273,12 @@ namespace AzNetworking
             else
             {
                 // Deserialize the packet header
-                NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
-                ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
-                if (!serializer.Serialize(header, "Header"))
+                NetworkOutputSerializer byteSerializer(decodedPacketData, decodedPacketSize);
+                NetworkBitOutputSerializer bitSerializer(decodedPacketData, decodedPacketSize);
+                ISerializer& packetSerializer = header.IsPacketFlagSet(PacketFlag::BitPacked)
+                    ? static_cast<ISerializer&>(bitSerializer)
+                    : static_cast<ISerializer&>(byteSerializer);
+                if (!packetSerializer.Serialize(header, "Header"))
                 {
                     continue;
                 }
@@ -337,6 +351,8 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        m_socket->EndSendBatch();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -369,6 +385,16 @@ namespace AzNetworking
         return connection->SendUnreliablePacket(packet);
     }
 
+    void UdpNetworkInterface::BeginSendBatch()
+    {
+        m_socket->BeginSendBatch();
+    }
+
+    void UdpNetworkInterface::EndSendBatch()
+    {
+        m_socket->EndSendBatch();
+    }
+
     bool UdpNetworkInterface::WasPacketAcked(ConnectionId connectionId, PacketId packetId)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
@@ -510,14 +536,19 @@ namespace AzNetworking
         {
             buffer.Resize(buffer.GetCapacity());
 
-            NetworkInputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
-            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
-
-            if (!header.SerializePacketFlags(serializer))
+            // The flags are always byte aligned, they tell the receiver how to read the rest of the packet
+            header.SetPacketFlag(PacketFlag::BitPacked, connection.IsBitPackingEnabled());
+            NetworkInputSerializer flagSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            if (!header.SerializePacketFlags(flagSerializer))
             {
                 AZLOG_ERROR("PacketId %u failed flag serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
                 return InvalidPacketId;
             }
+            const uint32_t flagSize = flagSerializer.GetSize();
+
+            NetworkInputSerializer byteSerializer(buffer.GetBuffer() + flagSize, static_cast<uint32_t>(buffer.GetCapacity()) - flagSize);
+            NetworkBitInputSerializer bitSerializer(buffer.GetBuffer() + flagSize, static_cast<uint32_t>(buffer.GetCapacity()) - flagSize);
+            ISerializer& serializer = connection.IsBitPackingEnabled() ? static_cast<ISerializer&>(bitSerializer) : byteSerializer;
 
             if (!serializer.Serialize(header, "Header"))
             {
@@ -531,7 +562,7 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
-            buffer.Resize(serializer.GetSize());
+            buffer.Resize(flagSize + serializer.GetSize());
         }
         uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
         uint8_t* packetData = buffer.GetBuffer();
@@ -637,16 +668,21 @@ namespace AzNetworking
 
         CorePackets::InitiateConnectionPacket packet;
         {
-            NetworkOutputSerializer networkSerializer(connectPacket.m_buffer, connectPacket.m_receivedBytes);
+            NetworkOutputSerializer flagSerializer(connectPacket.m_buffer, connectPacket.m_receivedBytes);
 
             // First, serialize out the header
             UdpPacketHeader header;
-            if (!header.SerializePacketFlags(networkSerializer))
+            if (!header.SerializePacketFlags(flagSerializer))
             {
                 return;
             }
 
-            if (!static_cast<ISerializer&>(networkSerializer).Serialize(header, "Header"))
+            const bool bitPacked = header.IsPacketFlagSet(PacketFlag::BitPacked);
+            NetworkOutputSerializer byteSerializer(flagSerializer.GetUnreadData(), flagSerializer.GetUnreadSize());
+            NetworkBitOutputSerializer bitSerializer(flagSerializer.GetUnreadData(), flagSerializer.GetUnreadSize());
+            ISerializer& networkSerializer = bitPacked ? static_cast<ISerializer&>(bitSerializer) : static_cast<ISerializer&>(byteSerializer);
+
+            if (!networkSerializer.Serialize(header, "Header"))
             {
                 return;
             }
@@ -657,10 +693,12 @@ namespace AzNetworking
                 return;
             }
 
-            // Next serialize the InitiateConnectionPacket itself
+            // Next serialize the InitiateConnectionPacket itself, leaving networkSerializer positioned right after the header
             {
-                NetworkOutputSerializer tempPacketSerializer(networkSerializer.GetUnreadData(), networkSerializer.GetUnreadSize());
-                if (!static_cast<ISerializer&>(tempPacketSerializer).Serialize(packet, "Packet"))
+                NetworkOutputSerializer tempByteSerializer(byteSerializer.GetUnreadData(), byteSerializer.GetUnreadSize());
+                NetworkBitOutputSerializer tempBitSerializer(bitSerializer);
+                ISerializer& tempPacketSerializer = bitPacked ? static_cast<ISerializer&>(tempBitSerializer) : static_cast<ISerializer&>(tempByteSerializer);
+                if (!tempPacketSerializer.Serialize(packet, "Packet"))
                 {
                     return;
                 }
@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -176,29 +177,40 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
+                // Each packet is received straight into its own MTU sized slot of the receive buffer,
+                // and the network interface reads it from there without any further copies
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
-                if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
+                const uint32_t freeSlots = AZStd::min<uint32_t>(
+                    static_cast<uint32_t>((receiveBuffer.GetCapacity() - bufferHead) / MaxUdpTransmissionUnit),
+                    static_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size()));
+                if (freeSlots == 0)
                 {
-                    AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
-                        aznumeric_cast<int32_t>(bufferHead + MaxUdpTransmissionUnit - receiveBuffer.GetCapacity()));
+                    AZLOG_INFO("Receive buffer full, leaving data on the socket");
                     break;
                 }
 
+                const uint32_t batchCount = AZStd::min(freeSlots, UdpSocket::MaxDatagramBatchCount);
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
-
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                UdpSocket::Datagram datagrams[UdpSocket::MaxDatagramBatchCount];
+                for (uint32_t i = 0; i < batchCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    datagrams[i].m_buffer = dstData + i * MaxUdpTransmissionUnit;
+                    datagrams[i].m_size = MaxUdpTransmissionUnit;
                 }
-                else
+                receiveBuffer.Resize(bufferHead + batchCount * MaxUdpTransmissionUnit);
+
+                const int32_t receivedCount = socket->ReceiveBatch(datagrams, batchCount);
+                if (receivedCount <= 0)
                 {
                     receiveBuffer.Resize(bufferHead);
                     break;
                 }
+
+                for (int32_t i = 0; i < receivedCount; ++i)
+                {
+                    receivedPackets.push_back(ReceivedPacket(datagrams[i].m_address, datagrams[i].m_buffer, aznumeric_cast<int32_t>(datagrams[i].m_size)));
+                }
+                receiveBuffer.Resize(bufferHead + receivedCount * MaxUdpTransmissionUnit);
             }
         }
         m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
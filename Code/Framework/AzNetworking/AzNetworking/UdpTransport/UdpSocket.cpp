@@ -20,9 +20,16 @@
 
 namespace AzNetworking
 {
+    namespace Platform
+    {
+        int32_t ReceiveDatagrams(SocketFd socketFd, UdpSocket::Datagram* inOutDatagrams, uint32_t maxCount);
+        int32_t SendDatagrams(SocketFd socketFd, const UdpSocket::Datagram* datagrams, uint32_t count);
+    }
+
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchSocketIo, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, UDP sockets read and write multiple datagrams per system call where the platform supports it");
 
     UdpSocket::~UdpSocket()
     {
@@ -98,6 +105,8 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        m_sendBatch.clear();
+        m_sendBatchBuffer.Resize(0);
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -226,9 +235,79 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    int32_t UdpSocket::ReceiveBatch(Datagram* inOutDatagrams, uint32_t maxCount) const
+    {
+        AZ_Assert(maxCount > 0 && maxCount <= MaxDatagramBatchCount, "Invalid datagram count for receive");
+        AZ_Assert(inOutDatagrams != nullptr, "NULL datagram pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        if (!net_UdpBatchSocketIo)
+        {
+            Datagram& datagram = inOutDatagrams[0];
+            const int32_t receivedBytes = Receive(datagram.m_address, datagram.m_buffer, datagram.m_size);
+            if (receivedBytes <= 0)
+            {
+                return receivedBytes;
+            }
+            datagram.m_size = static_cast<uint32_t>(receivedBytes);
+            return 1;
+        }
+
+        const int32_t receivedCount = Platform::ReceiveDatagrams(m_socketFd, inOutDatagrams, maxCount);
+
+        if (receivedCount < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+
+            if (ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                return 0;
+            }
+
+            bool ignoreForciblyClosedError = false;
+            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+            {
+                return ignoreForciblyClosedError ? 0 : SocketOpResultError;
+            }
+
+            AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return 0;
+        }
+
+        for (int32_t i = 0; i < receivedCount; ++i)
+        {
+            m_recvBytes += inOutDatagrams[i].m_size;
+        }
+        m_recvPackets += static_cast<uint32_t>(receivedCount);
+        return receivedCount;
+    }
+
+    void UdpSocket::BeginSendBatch()
+    {
+        ++m_sendBatchDepth;
+    }
+
+    void UdpSocket::EndSendBatch()
+    {
+        AZ_Assert(m_sendBatchDepth > 0, "EndSendBatch called without a matching BeginSendBatch");
+        if (m_sendBatchDepth > 0 && --m_sendBatchDepth == 0)
+        {
+            FlushSendBatch();
+        }
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+        if ((m_sendBatchDepth > 0) && net_UdpBatchSocketIo)
+        {
+            return QueueBatchedSend(address, data, size);
+        }
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -237,6 +316,51 @@ namespace AzNetworking
         return sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr));
     }
 
+    int32_t UdpSocket::QueueBatchedSend(const IpAddress& address, const uint8_t* data, uint32_t size) const
+    {
+        if (m_sendBatch.full() || (m_sendBatchBuffer.GetSize() + size > m_sendBatchBuffer.GetCapacity()))
+        {
+            FlushSendBatch();
+        }
+
+        // Encryption has already been applied by this point, so the queued payload is exactly what goes on the wire
+        const size_t bufferHead = m_sendBatchBuffer.GetSize();
+        uint8_t* queuedData = m_sendBatchBuffer.GetBufferEnd();
+        m_sendBatchBuffer.Resize(bufferHead + size);
+        memcpy(queuedData, data, size);
+        m_sendBatch.push_back(Datagram{ address, queuedData, size });
+        return static_cast<int32_t>(size);
+    }
+
+    void UdpSocket::FlushSendBatch() const
+    {
+        const uint32_t queuedCount = static_cast<uint32_t>(m_sendBatch.size());
+        uint32_t sentCount = 0;
+        while (sentCount < queuedCount && IsOpen())
+        {
+            const int32_t result = Platform::SendDatagrams(m_socketFd, &m_sendBatch[sentCount], queuedCount - sentCount);
+            if (result > 0)
+            {
+                sentCount += static_cast<uint32_t>(result);
+                continue;
+            }
+
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error))
+            {
+                // The socket send buffer is full, drop the remaining datagrams the same way an unbatched send would
+                break;
+            }
+
+            // The error belongs to the first unsent datagram, skip it and keep going with the rest
+            AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            ++sentCount;
+        }
+
+        m_sendBatch.clear();
+        m_sendBatchBuffer.Resize(0);
+    }
+
 #ifdef ENABLE_LATENCY_DEBUG
     int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
     {
@@ -12,6 +12,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
 
@@ -42,6 +43,17 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! A single payload for the batched socket operations.
+        struct Datagram
+        {
+            IpAddress m_address;
+            uint8_t* m_buffer = nullptr;
+            uint32_t m_size = 0;
+        };
+
+        //! Maximum number of payloads handed to the socket layer in a single batched operation.
+        static constexpr uint32_t MaxDatagramBatchCount = 64;
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -93,6 +105,22 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call on platforms that support it.
+        //! May return fewer payloads than requested even if more data is pending on the socket.
+        //! @param inOutDatagrams on input, the buffer and size of each entry describe where to write a payload,
+        //!                       on success the address and size of each received entry are updated
+        //! @param maxCount       maximum number of payloads to receive, no more than MaxDatagramBatchCount
+        //! @return number of payloads received, < 0 on error
+        int32_t ReceiveBatch(Datagram* inOutDatagrams, uint32_t maxCount) const;
+
+        //! Starts coalescing sends on this socket, calls may be nested.
+        //! While a batch is open, payloads are queued and transmitted together once the outermost batch ends or the queue fills up.
+        //! Batches must be opened and closed on the thread that sends on this socket.
+        void BeginSendBatch();
+
+        //! Ends a batch started by BeginSendBatch, transmitting any queued payloads if it was the outermost batch.
+        void EndSendBatch();
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -130,12 +158,19 @@ namespace AzNetworking
 
     private:
 
+        int32_t QueueBatchedSend(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+        void FlushSendBatch() const;
+
         SocketFd m_socketFd = InvalidSocketFd;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
 
+        uint32_t m_sendBatchDepth = 0;
+        mutable AZStd::fixed_vector<Datagram, MaxDatagramBatchCount> m_sendBatch;
+        mutable ByteBuffer<MaxDatagramBatchCount * MaxUdpTransmissionUnit> m_sendBatchBuffer;
+
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
         {
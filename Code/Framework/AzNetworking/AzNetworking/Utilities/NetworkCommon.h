@@ -10,6 +10,7 @@
 
 #include <AzCore/Time/ITime.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/fixed_string.h>
@@ -109,6 +110,11 @@ namespace AzNetworking
     //! @return string label for the provided index
     template <AZStd::size_t MAX_VALUE>
     constexpr auto GenerateIndexLabel(AZStd::size_t value);
+
+    //! Returns the number of bits needed to store any offset within a value range.
+    //! @param valueRange the difference between the largest and smallest value of the range
+    //! @return number of bits needed to store any offset within the range, 0 if the range holds a single value
+    uint32_t GetBitCountForRange(uint64_t valueRange);
 }
 
 AZ_TYPE_SAFE_INTEGRAL_SERIALIZEBINDING(AzNetworking::SequenceRolloverCount);
@@ -41,4 +41,9 @@ namespace AzNetworking
         result[NumHexDigits] = '\0'; // Guarantee null termination
         return result;
     }
+
+    inline uint32_t GetBitCountForRange(uint64_t valueRange)
+    {
+        return (valueRange != 0) ? 64 - static_cast<uint32_t>(az_clz_u64(valueRange)) : 0;
+    }
 }
@@ -56,6 +56,10 @@ set(FILES
     Serialization/HashSerializer.h
     Serialization/ISerializer.h
     Serialization/ISerializer.inl
+    Serialization/NetworkBitInputSerializer.cpp
+    Serialization/NetworkBitInputSerializer.h
+    Serialization/NetworkBitOutputSerializer.cpp
+    Serialization/NetworkBitOutputSerializer.h
     Serialization/NetworkInputSerializer.cpp
     Serialization/NetworkInputSerializer.h
     Serialization/NetworkInputSerializer.inl
@@ -96,6 +100,9 @@ set(FILES
     UdpTransport/DtlsEndpoint.h
     UdpTransport/DtlsSocket.cpp
     UdpTransport/DtlsSocket.h
+    UdpTransport/UdpCongestionController.cpp
+    UdpTransport/UdpCongestionController.h
+    UdpTransport/UdpCongestionController.inl
     UdpTransport/UdpConnection.cpp
     UdpTransport/UdpConnection.h
     UdpTransport/UdpConnection.inl
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
+
+namespace AzNetworking
+{
+    namespace Platform
+    {
+        // Platforms without batched socket calls fall back to one system call per datagram
+        int32_t ReceiveDatagrams(SocketFd socketFd, UdpSocket::Datagram* inOutDatagrams, uint32_t maxCount)
+        {
+            uint32_t receivedCount = 0;
+            for (; receivedCount < maxCount; ++receivedCount)
+            {
+                UdpSocket::Datagram& datagram = inOutDatagrams[receivedCount];
+
+                sockaddr_in from;
+                socklen_t   fromLen = sizeof(from);
+
+                const int32_t receivedBytes = recvfrom(static_cast<int32_t>(socketFd), reinterpret_cast<char*>(datagram.m_buffer),
+                    static_cast<int32_t>(datagram.m_size), 0, (sockaddr*)&from, &fromLen);
+                if (receivedBytes < 0)
+                {
+                    // Only report the error if nothing was received, the next call will hit it again
+                    return (receivedCount > 0) ? static_cast<int32_t>(receivedCount) : receivedBytes;
+                }
+
+                datagram.m_address = IpAddress(ByteOrder::Network, from.sin_addr.s_addr, from.sin_port);
+                datagram.m_size = static_cast<uint32_t>(receivedBytes);
+            }
+            return static_cast<int32_t>(receivedCount);
+        }
+
+        int32_t SendDatagrams(SocketFd socketFd, const UdpSocket::Datagram* datagrams, uint32_t count)
+        {
+            uint32_t sentCount = 0;
+            for (; sentCount < count; ++sentCount)
+            {
+                const UdpSocket::Datagram& datagram = datagrams[sentCount];
+
+                sockaddr_in destAddr;
+                memset(&destAddr, 0, sizeof(destAddr));
+                destAddr.sin_family = AF_INET;
+                destAddr.sin_addr.s_addr = datagram.m_address.GetAddress(ByteOrder::Network);
+                destAddr.sin_port = datagram.m_address.GetPort(ByteOrder::Network);
+
+                const int32_t sentBytes = sendto(static_cast<int32_t>(socketFd), reinterpret_cast<const char*>(datagram.m_buffer),
+                    datagram.m_size, 0, (sockaddr*)&destAddr, sizeof(destAddr));
+                if (sentBytes < 0)
+                {
+                    return (sentCount > 0) ? static_cast<int32_t>(sentCount) : sentBytes;
+                }
+            }
+            return static_cast<int32_t>(sentCount);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
+#include <AzCore/std/algorithm.h>
+
+#include <sys/socket.h>
+#include <string.h>
+
+namespace AzNetworking
+{
+    namespace Platform
+    {
+        // recvmmsg and sendmmsg move a whole batch of datagrams between the socket and user space in one system call
+        int32_t ReceiveDatagrams(SocketFd socketFd, UdpSocket::Datagram* inOutDatagrams, uint32_t maxCount)
+        {
+            mmsghdr messages[UdpSocket::MaxDatagramBatchCount];
+            iovec buffers[UdpSocket::MaxDatagramBatchCount];
+            sockaddr_in addresses[UdpSocket::MaxDatagramBatchCount];
+
+            const uint32_t count = AZStd::min(maxCount, UdpSocket::MaxDatagramBatchCount);
+            memset(messages, 0, sizeof(mmsghdr) * count);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                buffers[i].iov_base = inOutDatagrams[i].m_buffer;
+                buffers[i].iov_len = inOutDatagrams[i].m_size;
+                messages[i].msg_hdr.msg_name = &addresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int32_t receivedCount = recvmmsg(static_cast<int32_t>(socketFd), messages, count, MSG_DONTWAIT, nullptr);
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                inOutDatagrams[i].m_address = IpAddress(ByteOrder::Network, addresses[i].sin_addr.s_addr, addresses[i].sin_port);
+                inOutDatagrams[i].m_size = messages[i].msg_len;
+            }
+            return receivedCount;
+        }
+
+        int32_t SendDatagrams(SocketFd socketFd, const UdpSocket::Datagram* datagrams, uint32_t count)
+        {
+            mmsghdr messages[UdpSocket::MaxDatagramBatchCount];
+            iovec buffers[UdpSocket::MaxDatagramBatchCount];
+            sockaddr_in addresses[UdpSocket::MaxDatagramBatchCount];
+
+            count = AZStd::min(count, UdpSocket::MaxDatagramBatchCount);
+            memset(messages, 0, sizeof(mmsghdr) * count);
+            memset(addresses, 0, sizeof(sockaddr_in) * count);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                addresses[i].sin_family = AF_INET;
+                addresses[i].sin_addr.s_addr = datagrams[i].m_address.GetAddress(ByteOrder::Network);
+                addresses[i].sin_port = datagrams[i].m_address.GetPort(ByteOrder::Network);
+                buffers[i].iov_base = datagrams[i].m_buffer;
+                buffers[i].iov_len = datagrams[i].m_size;
+                messages[i].msg_hdr.msg_name = &addresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            return sendmmsg(static_cast<int32_t>(socketFd), messages, count, MSG_DONTWAIT);
+        }
+    }
+}
@@ -7,6 +7,7 @@
 #
 
 set(FILES
+    ../Common/Default/AzNetworking/UdpTransport/UdpSocket_Default.cpp
     ../Common/Default/AzNetworking/Utilities/IpAddress_Default.cpp
     ../Common/WinAPI/AzNetworking/Utilities/Endian_WinAPI.h
     ../Common/WinAPI/AzNetworking/Utilities/NetworkCommon_WinAPI.cpp
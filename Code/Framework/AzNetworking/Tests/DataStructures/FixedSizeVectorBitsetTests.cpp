@@ -11,4 +11,36 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<32> lhs;
+        AzNetworking::FixedSizeVectorBitset<32> rhs;
+        lhs.Resize(20);
+        rhs.Resize(20);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(3, true);
+        lhs.SetBit(17, true);
+        EXPECT_TRUE(lhs != rhs);
+
+        rhs.SetBit(3, true);
+        rhs.SetBit(17, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        rhs.Resize(21);
+        EXPECT_FALSE(lhs == rhs);
+    }
+
+    TEST(FixedSizeVectorBitset, TestEqualityIgnoresBitsBeyondSize)
+    {
+        AzNetworking::FixedSizeVectorBitset<32> lhs;
+        AzNetworking::FixedSizeVectorBitset<32> rhs;
+        lhs.Resize(8);
+        lhs.SetBit(1, true);
+        lhs.SetBit(7, true);
+        lhs.Resize(6);
+        rhs.Resize(6);
+        rhs.SetBit(1, true);
+        EXPECT_TRUE(lhs == rhs);
+    }
 }
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzNetworking/Utilities/QuantizedValues.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    TEST(NetworkBitSerializerTests, GetBitCountForRange)
+    {
+        EXPECT_EQ(GetBitCountForRange(0), 0u);
+        EXPECT_EQ(GetBitCountForRange(1), 1u);
+        EXPECT_EQ(GetBitCountForRange(2), 2u);
+        EXPECT_EQ(GetBitCountForRange(3), 2u);
+        EXPECT_EQ(GetBitCountForRange(255), 8u);
+        EXPECT_EQ(GetBitCountForRange(256), 9u);
+        EXPECT_EQ(GetBitCountForRange(AZStd::numeric_limits<uint64_t>::max()), 64u);
+    }
+
+    TEST(NetworkBitSerializerTests, BoundedValuesUseMinimalBits)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        bool inBool = true;
+        uint8_t inSmall = 5;     // 0..7, 3 bits
+        int16_t inSigned = -100; // -128..127, 8 bits
+        uint32_t inConstant = 42; // 42..42, 0 bits
+        EXPECT_TRUE(inputSerializer.Serialize(inBool, "Bool"));
+        EXPECT_TRUE(inputSerializer.Serialize(inSmall, "Small", 0, 7));
+        EXPECT_TRUE(inputSerializer.Serialize(inSigned, "Signed", -128, 127));
+        EXPECT_TRUE(inputSerializer.Serialize(inConstant, "Constant", 42, 42));
+        EXPECT_EQ(inputSerializer.GetSizeInBits(), 12u);
+        EXPECT_EQ(inputSerializer.GetSize(), 2u);
+
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        bool outBool = false;
+        uint8_t outSmall = 0;
+        int16_t outSigned = 0;
+        uint32_t outConstant = 0;
+        EXPECT_TRUE(outputSerializer.Serialize(outBool, "Bool"));
+        EXPECT_TRUE(outputSerializer.Serialize(outSmall, "Small", 0, 7));
+        EXPECT_TRUE(outputSerializer.Serialize(outSigned, "Signed", -128, 127));
+        EXPECT_TRUE(outputSerializer.Serialize(outConstant, "Constant", 42, 42));
+        EXPECT_EQ(outputSerializer.GetReadSizeInBits(), 12u);
+
+        EXPECT_EQ(inBool, outBool);
+        EXPECT_EQ(inSmall, outSmall);
+        EXPECT_EQ(inSigned, outSigned);
+        EXPECT_EQ(inConstant, outConstant);
+    }
+
+    TEST(NetworkBitSerializerTests, FullRangeValuesRoundTrip)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        bool inBool = true; // Misaligns everything that follows
+        char inChar = 'z';
+        int64_t inInt64 = AZStd::numeric_limits<int64_t>::min();
+        uint64_t inUint64 = AZStd::numeric_limits<uint64_t>::max();
+        float inFloat = -3.5f;
+        double inDouble = 1.0e100;
+        EXPECT_TRUE(inputSerializer.Serialize(inBool, "Bool"));
+        EXPECT_TRUE(inputSerializer.Serialize(inChar, "Char"));
+        EXPECT_TRUE(inputSerializer.Serialize(inInt64, "Int64"));
+        EXPECT_TRUE(inputSerializer.Serialize(inUint64, "Uint64"));
+        EXPECT_TRUE(inputSerializer.Serialize(inFloat, "Float"));
+        EXPECT_TRUE(inputSerializer.Serialize(inDouble, "Double"));
+        EXPECT_EQ(inputSerializer.GetSizeInBits(), 1u + 8u + 64u + 64u + 32u + 64u);
+
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        bool outBool = false;
+        char outChar = 0;
+        int64_t outInt64 = 0;
+        uint64_t outUint64 = 0;
+        float outFloat = 0.0f;
+        double outDouble = 0.0;
+        EXPECT_TRUE(outputSerializer.Serialize(outBool, "Bool"));
+        EXPECT_TRUE(outputSerializer.Serialize(outChar, "Char"));
+        EXPECT_TRUE(outputSerializer.Serialize(outInt64, "Int64"));
+        EXPECT_TRUE(outputSerializer.Serialize(outUint64, "Uint64"));
+        EXPECT_TRUE(outputSerializer.Serialize(outFloat, "Float"));
+        EXPECT_TRUE(outputSerializer.Serialize(outDouble, "Double"));
+
+        EXPECT_EQ(inBool, outBool);
+        EXPECT_EQ(inChar, outChar);
+        EXPECT_EQ(inInt64, outInt64);
+        EXPECT_EQ(inUint64, outUint64);
+        EXPECT_EQ(inFloat, outFloat);
+        EXPECT_EQ(inDouble, outDouble);
+    }
+
+    TEST(NetworkBitSerializerTests, UnalignedBytesRoundTrip)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        bool inBool = true;
+        uint8_t inBytes[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x01 };
+        uint32_t inSize = sizeof(inBytes);
+        EXPECT_TRUE(inputSerializer.Serialize(inBool, "Bool"));
+        EXPECT_TRUE(inputSerializer.SerializeBytes(inBytes, sizeof(inBytes), false, inSize, "Bytes"));
+
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        bool outBool = false;
+        uint8_t outBytes[sizeof(inBytes)] = {};
+        uint32_t outSize = 0;
+        EXPECT_TRUE(outputSerializer.Serialize(outBool, "Bool"));
+        EXPECT_TRUE(outputSerializer.SerializeBytes(outBytes, sizeof(outBytes), false, outSize, "Bytes"));
+
+        EXPECT_EQ(inSize, outSize);
+        EXPECT_EQ(memcmp(inBytes, outBytes, sizeof(inBytes)), 0);
+    }
+
+    TEST(NetworkBitSerializerTests, OutOfRangeValueInvalidatesSerializer)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        uint8_t value = 9;
+        EXPECT_FALSE(inputSerializer.Serialize(value, "Value", 0, 8));
+        EXPECT_FALSE(inputSerializer.IsValid());
+
+        // Range 0..8 takes 4 bits, so a stream can hold offsets the writer would never produce
+        buffer[0] = 0x0F;
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), 1);
+        value = 0;
+        EXPECT_FALSE(outputSerializer.Serialize(value, "Value", 0, 8));
+        EXPECT_FALSE(outputSerializer.IsValid());
+        EXPECT_EQ(value, 0);
+    }
+
+    TEST(NetworkBitSerializerTests, OverflowInvalidatesSerializer)
+    {
+        AZStd::array<uint8_t, 2> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        uint16_t inValue = 1000; // 10 bits
+        EXPECT_TRUE(inputSerializer.Serialize(inValue, "Value", 0, 1023));
+        EXPECT_FALSE(inputSerializer.Serialize(inValue, "Value", 0, 1023));
+        EXPECT_FALSE(inputSerializer.IsValid());
+        EXPECT_EQ(inputSerializer.GetSizeInBits(), 10u);
+
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        uint16_t outValue = 0;
+        EXPECT_TRUE(outputSerializer.Serialize(outValue, "Value", 0, 1023));
+        EXPECT_EQ(inValue, outValue);
+        EXPECT_FALSE(outputSerializer.Serialize(outValue, "Value", 0, 1023));
+        EXPECT_FALSE(outputSerializer.IsValid());
+    }
+
+    TEST(NetworkBitSerializerTests, CopiedBitsRoundTripAtUnalignedOffsets)
+    {
+        // Serialize a payload on its own, then append it to a stream that isn't byte aligned
+        AZStd::array<uint8_t, 16> payloadBuffer;
+        NetworkBitInputSerializer payloadSerializer(payloadBuffer.data(), static_cast<uint32_t>(payloadBuffer.size()));
+        uint16_t inFirst = 1000; // 10 bits
+        uint8_t inSecond = 5;    // 3 bits
+        EXPECT_TRUE(payloadSerializer.Serialize(inFirst, "First", 0, 1023));
+        EXPECT_TRUE(payloadSerializer.Serialize(inSecond, "Second", 0, 7));
+        EXPECT_EQ(payloadSerializer.GetSizeInBits(), 13u);
+
+        AZStd::array<uint8_t, 16> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        bool inBool = true;
+        EXPECT_TRUE(inputSerializer.Serialize(inBool, "Bool"));
+        EXPECT_TRUE(inputSerializer.CopyBitsToBuffer(payloadBuffer.data(), payloadSerializer.GetSizeInBits()));
+        EXPECT_EQ(inputSerializer.GetSizeInBits(), 14u);
+
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        bool outBool = false;
+        uint16_t outFirst = 0;
+        uint8_t outSecond = 0;
+        EXPECT_TRUE(outputSerializer.Serialize(outBool, "Bool"));
+        EXPECT_TRUE(outputSerializer.Serialize(outFirst, "First", 0, 1023));
+        EXPECT_TRUE(outputSerializer.Serialize(outSecond, "Second", 0, 7));
+        EXPECT_EQ(inBool, outBool);
+        EXPECT_EQ(inFirst, outFirst);
+        EXPECT_EQ(inSecond, outSecond);
+    }
+
+    TEST(NetworkBitSerializerTests, QuantizedValuesRoundTrip)
+    {
+        QuantizedValues<3, 2, -1, 1> testIn(AZ::Vector3(-0.5f, 0.25f, 1.0f)), testOut;
+
+        AZStd::array<uint8_t, 64> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(testIn.Serialize(inputSerializer));
+
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(testOut.Serialize(outputSerializer));
+        EXPECT_EQ(testIn, testOut);
+    }
+}
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    static constexpr uint32_t TestPacketSize = 1200;
+
+    //! Deterministic model of a bottleneck link, used to drive a congestion controller without any sockets.
+    //! Packets are serialized at a fixed bandwidth through a drop tail queue, then delayed by a fixed one way latency,
+    //! and dropped at random at the requested rate. Acks come back after the same latency and are never lost.
+    //! Losses are reported a little after the ack would have arrived, like the packet timeout queue does.
+    class LossyLinkSimulator
+    {
+    public:
+
+        LossyLinkSimulator(uint32_t bytesPerMs, AZ::TimeMs oneWayLatencyMs, uint32_t queueCapacity, float lossRate)
+            : m_bytesPerMs(static_cast<float>(bytesPerMs))
+            , m_oneWayLatencyMs(oneWayLatencyMs)
+            , m_queueCapacity(static_cast<float>(queueCapacity))
+            , m_lossRate(lossRate)
+        {
+            ;
+        }
+
+        void Send(PacketId packetId, uint32_t packetSize, AZ::TimeMs currentTimeMs)
+        {
+            const float nowMs = static_cast<float>(currentTimeMs);
+            const AZ::TimeMs lossReportTimeMs = currentTimeMs + m_oneWayLatencyMs + m_oneWayLatencyMs + LossDetectionDelayMs;
+
+            const float queuedBytes = AZStd::max(m_linkFreeAtMs - nowMs, 0.0f) * m_bytesPerMs;
+            if (queuedBytes + static_cast<float>(packetSize) > m_queueCapacity)
+            {
+                m_events.push_back({ lossReportTimeMs, packetId, false });
+                return;
+            }
+
+            m_linkFreeAtMs = AZStd::max(m_linkFreeAtMs, nowMs) + static_cast<float>(packetSize) / m_bytesPerMs;
+            if (m_random.GetRandomFloat() < m_lossRate)
+            {
+                m_events.push_back({ lossReportTimeMs, packetId, false });
+                return;
+            }
+
+            const AZ::TimeMs ackTimeMs = AZ::TimeMs{ static_cast<int64_t>(AZStd::ceil(m_linkFreeAtMs)) } + m_oneWayLatencyMs + m_oneWayLatencyMs;
+            m_events.push_back({ ackTimeMs, packetId, true });
+        }
+
+        //! Reports every ack and loss due by the current time to the controller.
+        void Update(UdpCongestionController& controller, AZ::TimeMs currentTimeMs)
+        {
+            AZStd::vector<Event> dueEvents;
+            for (auto iter = m_events.begin(); iter != m_events.end();)
+            {
+                if (iter->m_timeMs <= currentTimeMs)
+                {
+                    dueEvents.push_back(*iter);
+                    iter = m_events.erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+
+            AZStd::sort(dueEvents.begin(), dueEvents.end(), [](const Event& lhs, const Event& rhs)
+            {
+                return lhs.m_timeMs < rhs.m_timeMs;
+            });
+
+            for (const Event& event : dueEvents)
+            {
+                if (event.m_acked)
+                {
+                    controller.OnPacketAcked(event.m_packetId, currentTimeMs);
+                    ++m_ackedCount;
+                }
+                else
+                {
+                    controller.OnPacketLost(event.m_packetId, currentTimeMs);
+                    ++m_lostCount;
+                }
+            }
+        }
+
+        uint32_t m_ackedCount = 0;
+        uint32_t m_lostCount = 0;
+
+    private:
+
+        struct Event
+        {
+            AZ::TimeMs m_timeMs;
+            PacketId m_packetId;
+            bool m_acked;
+        };
+
+        static constexpr AZ::TimeMs LossDetectionDelayMs = AZ::TimeMs{ 20 };
+
+        float m_bytesPerMs;
+        AZ::TimeMs m_oneWayLatencyMs;
+        float m_queueCapacity;
+        float m_lossRate;
+        float m_linkFreeAtMs = 0.0f;
+        AZ::SimpleLcgRandom m_random;
+        AZStd::vector<Event> m_events;
+    };
+
+    class UdpCongestionControllerTests
+        : public AllocatorsFixture
+    {
+    public:
+
+        struct LinkResult
+        {
+            uint32_t m_sentCount = 0;
+            uint32_t m_ackedCount = 0;
+            uint32_t m_lostCount = 0;
+        };
+
+        //! Runs a sender that always has data to send, either limited by the congestion controller or at a fixed rate.
+        LinkResult RunGreedySender(LossyLinkSimulator& link, UdpCongestionController& controller, AZ::TimeMs durationMs, uint32_t fixedBytesPerMs = 0)
+        {
+            LinkResult result;
+            uint32_t nextPacketId = 0;
+            for (AZ::TimeMs currentTimeMs = AZ::TimeMs{ 0 }; currentTimeMs < durationMs; currentTimeMs += AZ::TimeMs{ 1 })
+            {
+                link.Update(controller, currentTimeMs);
+
+                for (;;)
+                {
+                    const bool canSend = (fixedBytesPerMs > 0)
+                        ? (static_cast<uint64_t>(result.m_sentCount) * TestPacketSize < static_cast<uint64_t>(currentTimeMs + AZ::TimeMs{ 1 }) * fixedBytesPerMs)
+                        : (controller.GetSendBudget(currentTimeMs) >= TestPacketSize);
+                    if (!canSend)
+                    {
+                        break;
+                    }
+
+                    const PacketId packetId = PacketId{ nextPacketId++ };
+                    controller.OnPacketSent(packetId, TestPacketSize, currentTimeMs);
+                    link.Send(packetId, TestPacketSize, currentTimeMs);
+                    ++result.m_sentCount;
+                }
+            }
+
+            result.m_ackedCount = link.m_ackedCount;
+            result.m_lostCount = link.m_lostCount;
+            return result;
+        }
+    };
+
+    TEST_F(UdpCongestionControllerTests, SlowStart_FullWindowAcked_WindowDoubles)
+    {
+        UdpCongestionController controller(TestPacketSize);
+        const uint32_t initialWindow = controller.GetCongestionWindow();
+        const uint32_t packetCount = initialWindow / TestPacketSize;
+
+        for (uint32_t i = 0; i < packetCount; ++i)
+        {
+            controller.OnPacketSent(PacketId{ i }, TestPacketSize, AZ::TimeMs{ 0 });
+        }
+        EXPECT_EQ(controller.GetBytesInFlight(), packetCount * TestPacketSize);
+        EXPECT_EQ(controller.GetSendBudget(AZ::TimeMs{ 0 }), 0u);
+
+        for (uint32_t i = 0; i < packetCount; ++i)
+        {
+            controller.OnPacketAcked(PacketId{ i }, AZ::TimeMs{ 100 });
+        }
+        EXPECT_EQ(controller.GetBytesInFlight(), 0u);
+        EXPECT_EQ(controller.GetCongestionWindow(), initialWindow * 2);
+        EXPECT_TRUE(controller.IsInSlowStart());
+        EXPECT_FLOAT_EQ(controller.GetSmoothedRttMs(), 100.0f);
+    }
+
+    TEST_F(UdpCongestionControllerTests, Loss_SameFlight_WindowReducedOnce)
+    {
+        UdpCongestionController controller(TestPacketSize);
+        const uint32_t initialWindow = controller.GetCongestionWindow();
+
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            controller.OnPacketSent(PacketId{ i }, TestPacketSize, AZ::TimeMs{ 0 });
+        }
+
+        controller.OnPacketLost(PacketId{ 0 }, AZ::TimeMs{ 120 });
+        EXPECT_EQ(controller.GetCongestionWindow(), initialWindow / 2);
+        EXPECT_FALSE(controller.IsInSlowStart());
+
+        // The rest of the flight was sent before the reduction, losing it too doesn't reduce the window again
+        controller.OnPacketLost(PacketId{ 1 }, AZ::TimeMs{ 121 });
+        controller.OnPacketLost(PacketId{ 2 }, AZ::TimeMs{ 122 });
+        EXPECT_EQ(controller.GetCongestionWindow(), initialWindow / 2);
+        EXPECT_GT(controller.GetLossRate(), 0.0f);
+
+        // Unknown and duplicate reports are ignored
+        controller.OnPacketLost(PacketId{ 2 }, AZ::TimeMs{ 123 });
+        controller.OnPacketAcked(PacketId{ 100 }, AZ::TimeMs{ 123 });
+        EXPECT_EQ(controller.GetBytesInFlight(), 5 * TestPacketSize);
+
+        // A packet sent after the reduction does reduce the window when lost
+        controller.OnPacketSent(PacketId{ 8 }, TestPacketSize, AZ::TimeMs{ 130 });
+        controller.OnPacketLost(PacketId{ 8 }, AZ::TimeMs{ 250 });
+        EXPECT_EQ(controller.GetCongestionWindow(), initialWindow / 4);
+    }
+
+    TEST_F(UdpCongestionControllerTests, AppLimitedSender_WindowDoesNotGrow)
+    {
+        UdpCongestionController controller(TestPacketSize);
+        const uint32_t initialWindow = controller.GetCongestionWindow();
+
+        // One packet every 20ms never uses more than a fraction of the window
+        for (uint32_t i = 0; i < 50; ++i)
+        {
+            const AZ::TimeMs sendTimeMs = AZ::TimeMs{ 20 * i };
+            controller.OnPacketSent(PacketId{ i }, TestPacketSize, sendTimeMs);
+            controller.OnPacketAcked(PacketId{ i }, sendTimeMs + AZ::TimeMs{ 10 });
+        }
+        EXPECT_EQ(controller.GetCongestionWindow(), initialWindow);
+    }
+
+    TEST_F(UdpCongestionControllerTests, LightlyLoadedLink_RttEstimateMatchesLink)
+    {
+        LossyLinkSimulator link(1000, AZ::TimeMs{ 40 }, 100 * TestPacketSize, 0.0f);
+        UdpCongestionController controller(TestPacketSize);
+
+        uint32_t nextPacketId = 0;
+        for (AZ::TimeMs currentTimeMs = AZ::TimeMs{ 0 }; currentTimeMs < AZ::TimeMs{ 2000 }; currentTimeMs += AZ::TimeMs{ 1 })
+        {
+            link.Update(controller, currentTimeMs);
+            if ((static_cast<int64_t>(currentTimeMs) % 10) == 0)
+            {
+                const PacketId packetId = PacketId{ nextPacketId++ };
+                controller.OnPacketSent(packetId, TestPacketSize, currentTimeMs);
+                link.Send(packetId, TestPacketSize, currentTimeMs);
+            }
+        }
+
+        // Two one way latencies plus the time to put the packet on the link
+        EXPECT_NEAR(controller.GetSmoothedRttMs(), 82.0f, 1.0f);
+        EXPECT_LT(controller.GetRttVariationMs(), 1.0f);
+        EXPECT_GE(controller.GetRetransmitTimeoutMs(), AZ::TimeMs{ 82 });
+        EXPECT_EQ(link.m_lostCount, 0u);
+    }
+
+    TEST_F(UdpCongestionControllerTests, Bottleneck_ControlledSender_UsesLinkWithoutLossStorm)
+    {
+        static constexpr uint32_t LinkBytesPerMs = 100;
+        static constexpr AZ::TimeMs DurationMs = AZ::TimeMs{ 10000 };
+
+        LossyLinkSimulator controlledLink(LinkBytesPerMs, AZ::TimeMs{ 30 }, 20 * TestPacketSize, 0.0f);
+        UdpCongestionController controller(TestPacketSize);
+        const LinkResult controlled = RunGreedySender(controlledLink, controller, DurationMs);
+
+        // The same link driven at twice its capacity, which is what a burst of updates does without congestion control
+        LossyLinkSimulator uncontrolledLink(LinkBytesPerMs, AZ::TimeMs{ 30 }, 20 * TestPacketSize, 0.0f);
+        UdpCongestionController unusedController(TestPacketSize);
+        const LinkResult uncontrolled = RunGreedySender(uncontrolledLink, unusedController, DurationMs, LinkBytesPerMs * 2);
+
+        const float linkCapacityPackets = static_cast<float>(LinkBytesPerMs * static_cast<int64_t>(DurationMs)) / static_cast<float>(TestPacketSize);
+        EXPECT_GT(static_cast<float>(controlled.m_ackedCount), linkCapacityPackets * 0.8f);
+        EXPECT_LT(static_cast<float>(controlled.m_lostCount), static_cast<float>(controlled.m_sentCount) * 0.05f);
+        EXPECT_GT(static_cast<float>(uncontrolled.m_lostCount), static_cast<float>(uncontrolled.m_sentCount) * 0.3f);
+    }
+
+    TEST_F(UdpCongestionControllerTests, RandomLoss_SendRateBacksOff)
+    {
+        static constexpr AZ::TimeMs DurationMs = AZ::TimeMs{ 10000 };
+
+        LossyLinkSimulator cleanLink(100, AZ::TimeMs{ 30 }, 20 * TestPacketSize, 0.0f);
+        UdpCongestionController cleanController(TestPacketSize);
+        const LinkResult clean = RunGreedySender(cleanLink, cleanController, DurationMs);
+
+        LossyLinkSimulator lossyLink(100, AZ::TimeMs{ 30 }, 20 * TestPacketSize, 0.05f);
+        UdpCongestionController lossyController(TestPacketSize);
+        const LinkResult lossy = RunGreedySender(lossyLink, lossyController, DurationMs);
+
+        EXPECT_GT(lossy.m_lostCount, 0u);
+        EXPECT_GT(lossyController.GetLossRate(), 0.0f);
+        EXPECT_LT(lossy.m_sentCount, clean.m_sentCount);
+    }
+}
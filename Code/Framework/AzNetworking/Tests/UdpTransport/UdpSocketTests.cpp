@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    class UdpSocketTests
+        : public AllocatorsFixture
+    {
+    public:
+
+        void SetUp() override
+        {
+            SetupAllocator();
+            SocketLayerInit();
+
+            m_sender.Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+        }
+
+        void TearDown() override
+        {
+            m_receiver.Close();
+            m_sender.Close();
+
+            SocketLayerShutdown();
+            TeardownAllocator();
+        }
+
+        //! Receives until the expected number of datagrams arrived or the socket stays empty for a while.
+        uint32_t ReceiveAll(UdpSocket::Datagram* datagrams, uint8_t* buffer, uint32_t expectedCount)
+        {
+            uint32_t receivedCount = 0;
+            for (uint32_t attempt = 0; (receivedCount < expectedCount) && (attempt < 100);)
+            {
+                const uint32_t batchCount = AZStd::min(expectedCount - receivedCount, UdpSocket::MaxDatagramBatchCount);
+                for (uint32_t i = 0; i < batchCount; ++i)
+                {
+                    datagrams[receivedCount + i].m_buffer = buffer + (receivedCount + i) * MaxUdpTransmissionUnit;
+                    datagrams[receivedCount + i].m_size = MaxUdpTransmissionUnit;
+                }
+
+                const int32_t result = m_receiver.ReceiveBatch(&datagrams[receivedCount], batchCount);
+                if (result > 0)
+                {
+                    receivedCount += static_cast<uint32_t>(result);
+                }
+                else
+                {
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                    ++attempt;
+                }
+            }
+            return receivedCount;
+        }
+
+        static constexpr uint16_t SenderPort = 12360;
+        static constexpr uint16_t ReceiverPort = 12361;
+
+        UdpSocket m_sender;
+        UdpSocket m_receiver;
+        DtlsEndpoint m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+    };
+
+    TEST_F(UdpSocketTests, SendBatch_ManyDatagrams_ReceivedInOrderAfterBatchEnds)
+    {
+        static constexpr uint32_t DatagramCount = 150;
+        static constexpr uint32_t DatagramSize = 200;
+
+        ASSERT_TRUE(m_sender.IsOpen());
+        ASSERT_TRUE(m_receiver.IsOpen());
+
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        uint8_t payload[DatagramSize];
+
+        m_sender.BeginSendBatch();
+        m_sender.BeginSendBatch();
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            memset(payload, static_cast<int>(i & 0xFF), sizeof(payload));
+            EXPECT_EQ(m_sender.Send(receiverAddress, payload, DatagramSize - (i % 8), false, m_dtlsEndpoint, m_connectionQuality),
+                static_cast<int32_t>(DatagramSize - (i % 8)));
+        }
+        m_sender.EndSendBatch();
+        m_sender.EndSendBatch();
+
+        // Sends are counted when they're queued, the queue flushes on its own whenever it fills up
+        EXPECT_EQ(m_sender.GetSentPackets(), DatagramCount);
+
+        AZStd::vector<UdpSocket::Datagram> datagrams(DatagramCount);
+        AZStd::vector<uint8_t> buffer(DatagramCount * MaxUdpTransmissionUnit);
+        ASSERT_EQ(ReceiveAll(datagrams.data(), buffer.data(), DatagramCount), DatagramCount);
+
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            const UdpSocket::Datagram& datagram = datagrams[i];
+            EXPECT_EQ(datagram.m_address.GetPort(ByteOrder::Host), SenderPort);
+            ASSERT_EQ(datagram.m_size, DatagramSize - (i % 8));
+            EXPECT_EQ(datagram.m_buffer[0], static_cast<uint8_t>(i & 0xFF));
+            EXPECT_EQ(datagram.m_buffer[datagram.m_size - 1], static_cast<uint8_t>(i & 0xFF));
+        }
+        EXPECT_EQ(m_receiver.GetRecvPackets(), DatagramCount);
+    }
+
+    TEST_F(UdpSocketTests, SendBatch_BatchStillOpen_NothingReceived)
+    {
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        uint8_t payload[64] = {};
+
+        m_sender.BeginSendBatch();
+        m_sender.Send(receiverAddress, payload, sizeof(payload), false, m_dtlsEndpoint, m_connectionQuality);
+
+        UdpSocket::Datagram datagram;
+        uint8_t buffer[MaxUdpTransmissionUnit];
+        EXPECT_EQ(ReceiveAll(&datagram, buffer, 1), 0u);
+
+        m_sender.EndSendBatch();
+        EXPECT_EQ(ReceiveAll(&datagram, buffer, 1), 1u);
+        EXPECT_EQ(datagram.m_size, sizeof(payload));
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Measures loopback throughput of one socket sending to another, with and without batched socket calls.
+    class BM_UdpSocketLoopback
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+
+        static constexpr uint32_t DatagramsPerIteration = 128;
+        static constexpr uint32_t DatagramSize = 512;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SocketLayerInit();
+            m_sender.Open(12370, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_receiver.Open(12371, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_receiver.Close();
+            m_sender.Close();
+            SocketLayerShutdown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunLoopback(benchmark::State& state, bool batched)
+        {
+            const IpAddress receiverAddress(127, 0, 0, 1, 12371);
+            uint8_t payload[DatagramSize] = {};
+            UdpSocket::Datagram datagrams[UdpSocket::MaxDatagramBatchCount];
+            AZStd::vector<uint8_t> buffer(UdpSocket::MaxDatagramBatchCount * MaxUdpTransmissionUnit);
+
+            uint32_t totalReceived = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                if (batched)
+                {
+                    m_sender.BeginSendBatch();
+                }
+                for (uint32_t i = 0; i < DatagramsPerIteration; ++i)
+                {
+                    m_sender.Send(receiverAddress, payload, DatagramSize, false, m_dtlsEndpoint, m_connectionQuality);
+                }
+                if (batched)
+                {
+                    m_sender.EndSendBatch();
+                }
+
+                // Loopback delivery is synchronous, so an empty read means everything sent has been drained
+                for (;;)
+                {
+                    int32_t receivedCount = 0;
+                    if (batched)
+                    {
+                        for (uint32_t i = 0; i < UdpSocket::MaxDatagramBatchCount; ++i)
+                        {
+                            datagrams[i].m_buffer = buffer.data() + i * MaxUdpTransmissionUnit;
+                            datagrams[i].m_size = MaxUdpTransmissionUnit;
+                        }
+                        receivedCount = m_receiver.ReceiveBatch(datagrams, UdpSocket::MaxDatagramBatchCount);
+                    }
+                    else
+                    {
+                        IpAddress address;
+                        receivedCount = (m_receiver.Receive(address, buffer.data(), MaxUdpTransmissionUnit) > 0) ? 1 : 0;
+                    }
+
+                    if (receivedCount <= 0)
+                    {
+                        break;
+                    }
+                    totalReceived += static_cast<uint32_t>(receivedCount);
+                }
+            }
+
+            state.SetItemsProcessed(totalReceived);
+            state.SetBytesProcessed(static_cast<int64_t>(totalReceived) * DatagramSize);
+        }
+
+        UdpSocket m_sender;
+        UdpSocket m_receiver;
+        DtlsEndpoint m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+    };
+
+    BENCHMARK_F(BM_UdpSocketLoopback, SendReceivePerDatagram)(benchmark::State& state)
+    {
+        RunLoopback(state, false);
+    }
+
+    BENCHMARK_F(BM_UdpSocketLoopback, SendReceiveBatched)(benchmark::State& state)
+    {
+        RunLoopback(state, true);
+    }
+}
+#endif
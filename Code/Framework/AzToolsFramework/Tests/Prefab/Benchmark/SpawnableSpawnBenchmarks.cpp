@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#if defined(HAVE_BENCHMARK)
+
+#include <Prefab/Benchmark/PrefabBenchmarkFixture.h>
+
+#include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
+#include <AzToolsFramework/Prefab/Spawnable/SpawnableUtils.h>
+
+namespace Benchmark
+{
+    using namespace AzToolsFramework::Prefab;
+
+    class BM_SpawnableSpawn
+        : public BM_Prefab
+    {
+    protected:
+        void SpawnInstances(::benchmark::State& state, const AZStd::vector<AZ::Entity*>& entities)
+        {
+            const unsigned int numInstances = static_cast<unsigned int>(state.range());
+
+            AZStd::unique_ptr<Instance> instance(m_prefabSystemComponent->CreatePrefab(entities, {}, m_pathString));
+            auto& prefabDom = m_prefabSystemComponent->FindTemplateDom(instance->GetTemplateId());
+
+            auto spawnable = aznew AzFramework::Spawnable(
+                AZ::Data::AssetId::CreateString("{2B8D7B2C-1C4E-4E8F-9A6E-3F2D5C8B1A47}:0"), AZ::Data::AssetData::AssetStatus::Ready);
+            AzToolsFramework::Prefab::SpawnableUtils::CreateSpawnable(*spawnable, prefabDom);
+            AZ::Data::Asset<AzFramework::Spawnable> spawnableAsset(spawnable, AZ::Data::AssetLoadBehavior::Default);
+
+            auto manager = azrtti_cast<AzFramework::SpawnableEntitiesManager*>(AzFramework::SpawnableEntitiesInterface::Get());
+            ASSERT_TRUE(manager != nullptr);
+            constexpr auto allQueues = AzFramework::SpawnableEntitiesManager::CommandQueuePriority::High |
+                AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular;
+
+            for (auto _ : state)
+            {
+                state.PauseTiming();
+
+                AZStd::vector<AZStd::unique_ptr<AzFramework::EntitySpawnTicket>> tickets;
+                tickets.reserve(numInstances);
+                for (unsigned int instanceCounter = 0; instanceCounter < numInstances; ++instanceCounter)
+                {
+                    tickets.push_back(AZStd::make_unique<AzFramework::EntitySpawnTicket>(spawnableAsset));
+                }
+
+                state.ResumeTiming();
+
+                for (auto& ticket : tickets)
+                {
+                    manager->SpawnAllEntities(*ticket);
+                }
+                while (manager->ProcessQueue(allQueues) != AzFramework::SpawnableEntitiesManager::CommandQueueStatus::NoCommandsLeft)
+                {
+                }
+
+                state.PauseTiming();
+
+                // Destroying the tickets despawns their entities the next time the queue is processed.
+                tickets.clear();
+                while (manager->ProcessQueue(allQueues) != AzFramework::SpawnableEntitiesManager::CommandQueueStatus::NoCommandsLeft)
+                {
+                }
+
+                state.ResumeTiming();
+            }
+
+            state.SetComplexityN(numInstances);
+        }
+    };
+
+    BENCHMARK_DEFINE_F(BM_SpawnableSpawn, SpawnAllEntities_SingleEntityInstance)(::benchmark::State& state)
+    {
+        SpawnInstances(state, { CreateEntity("Entity1") });
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableSpawn, SpawnAllEntities_SingleEntityInstance)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_SpawnableSpawn, SpawnAllEntities_EntityHierarchyInstance)(::benchmark::State& state)
+    {
+        // Children reference their parent, so their entity ids need to be fixed up for every instance.
+        constexpr unsigned int numChildren = 9;
+
+        AZ::Entity* parent = CreateEntity("Parent");
+        AZStd::vector<AZ::Entity*> entities = { parent };
+        for (unsigned int childCounter = 0; childCounter < numChildren; ++childCounter)
+        {
+            AZStd::string entityName = "Child";
+            entityName = entityName + AZStd::to_string(childCounter);
+            entities.emplace_back(CreateEntity(entityName.c_str(), parent->GetId()));
+        }
+
+        SpawnInstances(state, entities);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableSpawn, SpawnAllEntities_EntityHierarchyInstance)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/Asset/AssetCatalogImage.h>
 #include <AzFramework/FileTag/FileTagBus.h>
 #include <AzFramework/FileTag/FileTag.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
@@ -309,6 +310,13 @@ namespace AssetProcessor
                 AzFramework::AssetRegistry::ReflectSerialize(serializeContext);
             }
 
+            bool writeCatalogImage = false;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+            {
+                settingsRegistry->Get(writeCatalogImage,
+                    AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/AssetCatalog/writeCatalogImage");
+            }
+
             // save out a catalog for each platform
             for (const QString& platform : m_platforms)
             {
@@ -322,9 +330,15 @@ namespace AssetProcessor
 
                 // these 3 lines are what writes the entire registry to the memory stream
                 AZ::ObjectStream* objStream = AZ::ObjectStream::Create(&catalogFileStream, *serializeContext, AZ::ObjectStream::ST_BINARY);
+                AZStd::vector<AZ::u8> imageData;
                 {
                     QMutexLocker locker(&m_registriesMutex);
                     objStream->WriteClass(&m_registries[platform]);
+                    if (writeCatalogImage && !AzFramework::AssetCatalogImage::Build(m_registries[platform], imageData))
+                    {
+                        AZ_Warning(AssetProcessor::ConsoleChannel, false, "Failed to build the %s catalog image", platform.toUtf8().constData());
+                        imageData.clear();
+                    }
                 }
                 objStream->Finalize();
 
@@ -371,6 +385,26 @@ namespace AssetProcessor
                         {
                             AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Saved %s catalog containing %u assets in %fs\n", platform.toUtf8().constData(), m_registries[platform].m_assetIdToInfo.size(), timer.elapsed() / 1000.0f);
                         }
+
+                        // The runtime prefers the image over the xml catalog, so an image that can't be updated is removed
+                        // rather than left behind with stale data.
+                        QString actualImageFile = QString("%1/%2").arg(platformCacheDir).arg("assetcatalog.image");
+                        bool imageSaved = false;
+                        if (moved && !imageData.empty())
+                        {
+                            QString tempImageFile = QString("%1/%2").arg(workSpace).arg("assetcatalog.image.tmp");
+                            if (AZ::IO::FileIOBase::GetInstance()->Open(tempImageFile.toUtf8().data(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle))
+                            {
+                                AZ::IO::FileIOBase::GetInstance()->Write(fileHandle, imageData.data(), imageData.size());
+                                AZ::IO::FileIOBase::GetInstance()->Close(fileHandle);
+                                imageSaved = AssetUtilities::MoveFileWithTimeout(tempImageFile, actualImageFile, 3);
+                            }
+                            AZ_Warning(AssetProcessor::ConsoleChannel, imageSaved, "Failed to save catalog image %s", actualImageFile.toUtf8().constData());
+                        }
+                        if (!imageSaved && AZ::IO::SystemFile::Exists(actualImageFile.toUtf8().constData()))
+                        {
+                            AZ::IO::SystemFile::Delete(actualImageFile.toUtf8().constData());
+                        }
                     }
                     else
                     {
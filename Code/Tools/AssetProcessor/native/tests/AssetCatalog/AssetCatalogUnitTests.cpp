@@ -9,9 +9,11 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzFramework/Asset/AssetCatalogImage.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 
 #include <QCoreApplication>
+#include <QFile>
 
 #include <native/unittests/UnitTestRunner.h> // for UnitTestUtils like CreateDummyFile / AssertAbsorber.
 #include <native/resourcecompiler/RCBuilder.h> // for defines like BUILDER_ID_RC
@@ -536,6 +538,37 @@ namespace AssetProcessor
         ASSERT_TRUE(TestGetRelativeProductPath(fileToCheck, true, { "aaa/basefile.txt" }));
     }
 
+    TEST_F(AssetCatalogTestWithProducts, SaveRegistry_WriteCatalogImageEnabled_WritesImageNextToCatalog)
+    {
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        const auto writeCatalogImageKey =
+            AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/AssetCatalog/writeCatalogImage";
+        settingsRegistry->Set(writeCatalogImageKey, true);
+
+        m_data->m_assetCatalog->BuildRegistry();
+        m_data->m_assetCatalog->SaveRegistry_Impl();
+
+        QDir platformCacheDir(m_data->m_cacheRootDir.absoluteFilePath("pc"));
+        EXPECT_TRUE(QFileInfo::exists(platformCacheDir.absoluteFilePath("assetcatalog.xml")));
+
+        QFile imageFile(platformCacheDir.absoluteFilePath("assetcatalog.image"));
+        ASSERT_TRUE(imageFile.open(QIODevice::ReadOnly));
+        QByteArray imageBytes = imageFile.readAll();
+        imageFile.close();
+
+        AZStd::vector<char> imageData(imageBytes.begin(), imageBytes.end());
+        AZStd::unique_ptr<AzFramework::AssetCatalogImage> image = AzFramework::AssetCatalogImage::Create(AZStd::move(imageData));
+        ASSERT_NE(image, nullptr);
+        EXPECT_EQ(image->GetAssetCount(), m_data->m_assetCatalog->GetRegistry("pc").m_assetIdToInfo.size());
+
+        // The runtime prefers the image, so turning the option off has to remove it rather than leave stale data behind.
+        settingsRegistry->Set(writeCatalogImageKey, false);
+        m_data->m_assetCatalog->BuildRegistry();
+        m_data->m_assetCatalog->SaveRegistry_Impl();
+
+        EXPECT_FALSE(QFileInfo::exists(platformCacheDir.absoluteFilePath("assetcatalog.image")));
+    }
+
     class AssetCatalogTestRelativeSourcePath : public AssetCatalogTest
     {
     public:
@@ -1182,6 +1182,9 @@ namespace EMotionFX
 
             // Make sure the LOD level is valid and update it.
             m_lodLevel = MCore::Clamp<size_t>(m_requestedLODLevel, 0, m_actor->GetNumLODLevels() - 1);
+
+            // The stored poses lack the transforms of newly enabled joints.
+            m_numUpdateRatePoses = 0;
         }
     }
 
@@ -1695,6 +1698,148 @@ namespace EMotionFX
         return m_motionSamplingRate;
     }
 
+    void ActorInstance::SetUpdateRate(float updateRateInSeconds)
+    {
+        if (m_updateRate != updateRateInSeconds)
+        {
+            m_updateRate = updateRateInSeconds;
+            ResetUpdateRatePhase(updateRateInSeconds);
+        }
+    }
+
+    float ActorInstance::GetUpdateRate() const
+    {
+        return m_updateRate;
+    }
+
+    void ActorInstance::SetInvisibleUpdateRate(float updateRateInSeconds)
+    {
+        if (m_invisibleUpdateRate != updateRateInSeconds)
+        {
+            m_invisibleUpdateRate = updateRateInSeconds;
+            ResetUpdateRatePhase(updateRateInSeconds);
+        }
+    }
+
+    float ActorInstance::GetInvisibleUpdateRate() const
+    {
+        return m_invisibleUpdateRate;
+    }
+
+    void ActorInstance::SetUpdateRateInterpolationEnabled(bool enabled)
+    {
+        m_updateRateInterpolation = enabled;
+        if (!enabled)
+        {
+            m_numUpdateRatePoses = 0;
+        }
+    }
+
+    bool ActorInstance::GetUpdateRateInterpolationEnabled() const
+    {
+        return m_updateRateInterpolation;
+    }
+
+    void ActorInstance::ResetUpdateRatePhase(float updateRateInSeconds)
+    {
+        // Multiplicative hashing spreads sequential ids evenly across the [0, 1) range.
+        const float phase = static_cast<float>((m_id * 2654435761u) >> 8) / static_cast<float>(1 << 24);
+        m_updateRateTimer = phase * AZ::GetMax(updateRateInSeconds, 0.0f);
+    }
+
+    bool ActorInstance::AdvanceUpdateRateTimer(float timePassedInSeconds, bool isVisible, float& outTimePassedSinceUpdate)
+    {
+        m_updateRateTimePassed += timePassedInSeconds;
+
+        const float updateRate = isVisible ? m_updateRate : m_invisibleUpdateRate;
+        if (updateRate > 0.0f)
+        {
+            m_updateRateTimer += timePassedInSeconds;
+            if (m_updateRateTimer < updateRate)
+            {
+                return false;
+            }
+
+            // Keep the remainder so that the actor instance stays in its phase, and the updates of different actor instances remain spread across frames.
+            m_updateRateTimer = AZ::GetMod(m_updateRateTimer, updateRate);
+        }
+
+        outTimePassedSinceUpdate = m_updateRateTimePassed;
+        m_updateRateInterval = m_updateRateTimePassed;
+        m_updateRateTimePassed = 0.0f;
+        return true;
+    }
+
+    void ActorInstance::StoreUpdateRatePose(bool isVisible)
+    {
+        if (!isVisible || m_updateRate <= 0.0f || !m_updateRateInterpolation)
+        {
+            m_numUpdateRatePoses = 0;
+            return;
+        }
+
+        if (!m_updateRateLastPose)
+        {
+            m_updateRatePrevPose = AZStd::make_unique<Pose>();
+            m_updateRatePrevPose->LinkToActorInstance(this);
+            m_updateRateLastPose = AZStd::make_unique<Pose>();
+            m_updateRateLastPose->LinkToActorInstance(this);
+        }
+
+        AZStd::swap(m_updateRatePrevPose, m_updateRateLastPose);
+        m_updateRateLastPose->InitFromPose(m_transformData->GetCurrentPose());
+        m_numUpdateRatePoses = AZ::GetMin<size_t>(m_numUpdateRatePoses + 1, 2);
+
+        // Continue from where the interpolation ended last frame, rather than jumping ahead to the pose that just got calculated.
+        if (m_numUpdateRatePoses == 2)
+        {
+            ApplyUpdateRatePose(0.0f);
+        }
+    }
+
+    void ActorInstance::UpdateSkippedTransformations(bool isVisible)
+    {
+        // The entity can still move in between full updates.
+        UpdateWorldTransform();
+
+        if (isVisible)
+        {
+            if (m_updateRateInterpolation && m_numUpdateRatePoses == 2 && m_updateRateInterval > 0.0f)
+            {
+                ApplyUpdateRatePose(AZ::GetMin(m_updateRateTimePassed / m_updateRateInterval, 1.0f));
+            }
+            else
+            {
+                UpdateAttachments();
+            }
+        }
+
+        if (GetBoundsUpdateEnabled() && m_boundsUpdateType == BOUNDS_STATIC_BASED)
+        {
+            UpdateBounds(m_lodLevel, m_boundsUpdateType);
+        }
+    }
+
+    void ActorInstance::ApplyUpdateRatePose(float weight)
+    {
+        AZ_PROFILE_SCOPE(Animation, "ActorInstance::ApplyUpdateRatePose");
+
+        Pose* pose = m_transformData->GetCurrentPose();
+        pose->InitFromPose(m_updateRatePrevPose.get());
+        pose->Blend(m_updateRateLastPose.get(), weight);
+        pose->InvalidateAllModelSpaceTransforms();
+
+        if (m_selfAttachment && m_selfAttachment->GetIsInfluencedByMultipleJoints())
+        {
+            m_selfAttachment->UpdateJointTransforms(*pose);
+        }
+
+        pose->ApplyMorphWeightsToActorInstance();
+        ApplyMorphSetup();
+        UpdateSkinningMatrices();
+        UpdateAttachments();
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         m_numAttachmentRefs += numToIncreaseWith;
@@ -37,6 +37,7 @@ namespace EMotionFX
     class Attachment;
     class AnimGraphInstance;
     class MorphSetupInstance;
+    class Pose;
     class RagdollInstance;
 
 
@@ -279,6 +280,31 @@ namespace EMotionFX
          */
         void UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms = true, bool sampleMotions = true);
 
+        /**
+         * Advance the update rate timer and check if the actor instance needs a full update this frame.
+         * The schedulers call this before UpdateTransformations(). When the update rate is 0 or lower, every frame is a full update.
+         * @param timePassedInSeconds The time passed in seconds, since the last frame.
+         * @param isVisible Set to true when the actor instance is visible, which decides between the visible and the invisible update rate.
+         * @param outTimePassedSinceUpdate The time passed since the last full update, which should be passed on to UpdateTransformations().
+         * @result True when the actor instance needs a full update, false when the update can be skipped and UpdateSkippedTransformations() should be called instead.
+         */
+        bool AdvanceUpdateRateTimer(float timePassedInSeconds, bool isVisible, float& outTimePassedSinceUpdate);
+
+        /**
+         * Store the pose calculated by the last full update, used to interpolate the frames in between full updates.
+         * The schedulers call this after UpdateTransformations(), in case the update rate is in use.
+         * As the interpolation runs one full update behind, this outputs the pose of the previous full update.
+         * @param isVisible Set to true when the actor instance is visible. Invisible updates don't calculate joint transforms, so they reset the stored poses.
+         */
+        void StoreUpdateRatePose(bool isVisible);
+
+        /**
+         * Update the actor instance on a frame where its full update got skipped because of the update rate.
+         * This updates the world transform and, when interpolation is enabled, interpolates between the poses of the last two full updates.
+         * @param isVisible Set to true when the actor instance is visible.
+         */
+        void UpdateSkippedTransformations(bool isVisible);
+
         /**
          * Update/Process the mesh deformers.
          * This will apply skinning and morphing deformations to the meshes used by the actor instance.
@@ -856,6 +882,30 @@ namespace EMotionFX
         float GetMotionSamplingTimer() const;
         float GetMotionSamplingRate() const;
 
+        /**
+         * Set the update rate used while the actor instance is visible, for example based on the distance to the camera.
+         * In between full updates the anim graph or motion system is not updated at all, which makes this a lot cheaper than only reducing the motion sampling rate.
+         * The first full update is offset by a phase that depends on the actor instance id, so that the full updates of many actor instances get spread across frames.
+         * @param updateRateInSeconds The time between full updates, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame.
+         */
+        void SetUpdateRate(float updateRateInSeconds);
+        float GetUpdateRate() const;
+
+        /**
+         * Set the update rate used while the actor instance is invisible.
+         * @param updateRateInSeconds The time between full updates. A value of 0 or lower means to update every frame.
+         */
+        void SetInvisibleUpdateRate(float updateRateInSeconds);
+        float GetInvisibleUpdateRate() const;
+
+        /**
+         * Enable or disable interpolating the joint transforms on frames in between full updates.
+         * Interpolating the poses of the last two full updates delays the visible motion by one update, without it the pose is held until the next full update.
+         * @param enabled Set to true to interpolate in between full updates.
+         */
+        void SetUpdateRateInterpolationEnabled(bool enabled);
+        bool GetUpdateRateInterpolationEnabled() const;
+
         MCORE_INLINE size_t GetNumNodes() const         { return m_actor->GetSkeleton()->GetNumNodes(); }
 
         void UpdateVisualizeScale();                    // not automatically called on creation for performance reasons (this method relatively is slow as it updates all meshes)
@@ -891,6 +941,15 @@ namespace EMotionFX
         float                   m_boundsUpdatePassedTime;/**< The time passed since the last bounds update. */
         float                   m_motionSamplingRate;    /**< The motion sampling rate in seconds, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame. */
         float                   m_motionSamplingTimer;   /**< The time passed since the last time we sampled motions/anim graphs. */
+        float m_updateRate = 0.0f; /**< The time between full updates while visible. A value of 0 or lower means to update every frame. */
+        float m_invisibleUpdateRate = 0.0f; /**< The time between full updates while invisible. A value of 0 or lower means to update every frame. */
+        float m_updateRateTimer = 0.0f; /**< The phase of the update rate, full updates happen when it passes the update rate. */
+        float m_updateRateTimePassed = 0.0f; /**< The time passed since the last full update. */
+        float m_updateRateInterval = 0.0f; /**< The time between the last two full updates, which is the duration of the interpolation. */
+        AZStd::unique_ptr<Pose> m_updateRatePrevPose; /**< The pose of the second to last full update. */
+        AZStd::unique_ptr<Pose> m_updateRateLastPose; /**< The pose of the last full update. */
+        size_t m_numUpdateRatePoses = 0; /**< The number of valid stored poses, interpolation requires both. */
+        bool m_updateRateInterpolation = true; /**< Interpolate the pose in between full updates? */
         float                   m_visualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         size_t                  m_lodLevel;              /**< The current LOD level, where 0 is the highest detail. */
         size_t                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
@@ -1011,5 +1070,17 @@ namespace EMotionFX
          * newly enabled joints (the ones that were not present and thus also not updated in the lower LOD level)will contain incorrect data.
          */
         void UpdateLODLevel();
+
+        /*
+         * Reset the update rate timer to a phase based on the actor instance id, so that actor instances using the same update rate don't all update on the same frame.
+         * @param updateRateInSeconds The update rate to spread the phase across.
+         */
+        void ResetUpdateRatePhase(float updateRateInSeconds);
+
+        /*
+         * Output the interpolated pose of the last two full updates and update the skinning matrices and attachments.
+         * @param weight The interpolation weight, where 0 outputs the pose of the second to last full update and 1 the pose of the last one.
+         */
+        void ApplyUpdateRatePose(float weight);
     };
 }   // namespace EMotionFX
@@ -83,11 +83,13 @@ namespace EMotionFX
         size_t GetNumUpdatedActorInstances() const                  { return m_numUpdated.GetValue(); }
         size_t GetNumVisibleActorInstances() const                  { return m_numVisible.GetValue(); }
         size_t GetNumSampledActorInstances() const                  { return m_numSampled.GetValue(); }
+        size_t GetNumSkippedActorInstances() const                  { return m_numSkipped.GetValue(); }
 
     protected:
         MCore::AtomicSizeT m_numUpdated;
         MCore::AtomicSizeT m_numVisible;
         MCore::AtomicSizeT m_numSampled;
+        MCore::AtomicSizeT m_numSkipped;    // The number of actor instances of which the full update got skipped because of their update rate.
 
         /**
          * The constructor.
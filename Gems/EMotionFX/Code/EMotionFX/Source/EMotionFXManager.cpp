@@ -22,9 +22,12 @@
 #include <MCore/Source/LogManager.h>
 #include <MCore/Source/MemoryTracker.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/DebugDraw.h>
@@ -77,8 +80,12 @@ namespace EMotionFX
         gEMFX.Get()->SetDebugDraw             (aznew DebugDraw());
         gEMFX.Get()->SetGlobalSimulationSpeed (1.0f);
 
-        // set the number of threads
-        const AZ::u32 numThreads = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        // set the number of threads, the TaskGraphScheduler updates the actor instances on the task workers instead of the job workers
+        AZ::u32 numThreads = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        if (AZ::Interface<AZ::TaskGraphActiveInterface>::Get())
+        {
+            numThreads = AZStd::max(numThreads, AZ::TaskExecutor::Instance().GetThreadCount());
+        }
         AZ_Assert(numThreads > 0, "The number of threads is expected to be bigger than 0.");
         gEMFX.Get()->SetNumThreads(numThreads);
 
@@ -0,0 +1,1695 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Source/Importer/MotionFileFormat.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        // The bit reader always loads four bytes, so the packed data is padded to allow reading the last key.
+        constexpr size_t s_numPaddingBytes = 3;
+
+        AZ::u32 GetMaxQuantizedValue(AZ::u8 numBits)
+        {
+            return (1u << numBits) - 1;
+        }
+
+        AZ::u32 Quantize(float value, float rangeMin, float rangeExtent, AZ::u8 numBits)
+        {
+            if (rangeExtent == 0.0f)
+            {
+                return 0;
+            }
+
+            // Floats can't represent every integer at the highest bit rates, so clamp to prevent rounding into the next component.
+            const AZ::u32 maxValue = GetMaxQuantizedValue(numBits);
+            const float normalized = AZ::GetClamp((value - rangeMin) / rangeExtent, 0.0f, 1.0f);
+            return AZ::GetMin(static_cast<AZ::u32>(normalized * static_cast<float>(maxValue) + 0.5f), maxValue);
+        }
+
+        float Dequantize(AZ::u32 value, float rangeMin, float rangeExtent, AZ::u8 numBits)
+        {
+            return rangeMin + static_cast<float>(value) * (rangeExtent / static_cast<float>(GetMaxQuantizedValue(numBits)));
+        }
+
+        void WriteBits(AZStd::vector<AZ::u8>& data, size_t bitOffset, AZ::u32 value, AZ::u8 numBits)
+        {
+            for (AZ::u8 i = 0; i < numBits; ++i)
+            {
+                if (value & (1u << i))
+                {
+                    const size_t bit = bitOffset + i;
+                    data[bit >> 3] |= static_cast<AZ::u8>(1u << (bit & 7));
+                }
+            }
+        }
+
+        AZ::u32 ReadBits(const AZ::u8* data, size_t bitOffset, AZ::u8 numBits)
+        {
+            // Assemble the bytes in little endian order, so that the packed data is the same on every platform.
+            const AZ::u8* bytes = data + (bitOffset >> 3);
+            const AZ::u32 word = static_cast<AZ::u32>(bytes[0]) | (static_cast<AZ::u32>(bytes[1]) << 8) | (static_cast<AZ::u32>(bytes[2]) << 16) | (static_cast<AZ::u32>(bytes[3]) << 24);
+            return (word >> (bitOffset & 7)) & GetMaxQuantizedValue(numBits);
+        }
+
+        // Rotations store the three smallest components, the largest one is reconstructed from the others during decompression.
+        // As the largest component is at least 0.5, its precision stays close to the precision of the stored components.
+        constexpr AZ::u8 s_numRotationIndexBits = 2;
+
+        AZ::u32 EncodeRotation(const float* values, float* outValues)
+        {
+            AZ::u32 largestIndex = 0;
+            for (AZ::u32 c = 1; c < 4; ++c)
+            {
+                if (AZ::GetAbs(values[c]) > AZ::GetAbs(values[largestIndex]))
+                {
+                    largestIndex = c;
+                }
+            }
+
+            // Both q and -q represent the same rotation, pick the one with a positive largest component.
+            const float sign = (values[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+            size_t smallIndex = 0;
+            for (AZ::u32 c = 0; c < 4; ++c)
+            {
+                if (c != largestIndex)
+                {
+                    outValues[smallIndex++] = values[c] * sign;
+                }
+            }
+            return largestIndex;
+        }
+
+        void DecodeRotation(AZ::u32 largestIndex, const float* values, float* outValues)
+        {
+            float lengthSq = 0.0f;
+            size_t smallIndex = 0;
+            for (AZ::u32 c = 0; c < 4; ++c)
+            {
+                if (c != largestIndex)
+                {
+                    outValues[c] = values[smallIndex++];
+                    lengthSq += outValues[c] * outValues[c];
+                }
+            }
+            outValues[largestIndex] = AZ::Sqrt(AZ::GetMax(0.0f, 1.0f - lengthSq));
+
+            const float invLength = 1.0f / AZ::Sqrt(lengthSq + outValues[largestIndex] * outValues[largestIndex]);
+            for (size_t c = 0; c < 4; ++c)
+            {
+                outValues[c] *= invLength;
+            }
+        }
+
+        size_t GetNumKeyBits(size_t numComponents, AZ::u8 bitsPerComponent, bool isRotation)
+        {
+            return numComponents * bitsPerComponent + (isRotation ? s_numRotationIndexBits : 0);
+        }
+
+        size_t GetStride(size_t numComponents, bool isRotation)
+        {
+            return isRotation ? 4 : numComponents;
+        }
+
+        AZ::Quaternion ToQuaternion(const float* values)
+        {
+            return AZ::Quaternion(values[0], values[1], values[2], values[3]);
+        }
+
+        float CalculateRotationError(const AZ::Quaternion& a, const AZ::Quaternion& b)
+        {
+            // Use the chord length instead of the dot product, as the arc cosine loses too much precision for small angles.
+            const AZ::Quaternion alignedB = (a.Dot(b) < 0.0f) ? -b : b;
+            const float chordLength = (a - alignedB).GetLength();
+            return AZ::RadToDeg(4.0f * asinf(AZ::GetMin(chordLength * 0.5f, 1.0f)));
+        }
+
+        float CalculateError(const float* a, const float* b, size_t numComponents, bool isRotation)
+        {
+            if (isRotation)
+            {
+                return CalculateRotationError(ToQuaternion(a), ToQuaternion(b));
+            }
+
+            float distanceSq = 0.0f;
+            for (size_t c = 0; c < numComponents; ++c)
+            {
+                distanceSq += (a[c] - b[c]) * (a[c] - b[c]);
+            }
+            return AZ::Sqrt(distanceSq);
+        }
+
+        void Interpolate(const float* a, const float* b, float t, size_t numComponents, bool isRotation, float* outValues)
+        {
+            if (isRotation)
+            {
+                const AZ::Quaternion result = ToQuaternion(a).NLerp(ToQuaternion(b), t);
+                result.StoreToFloat4(outValues);
+                return;
+            }
+
+            for (size_t c = 0; c < numComponents; ++c)
+            {
+                outValues[c] = AZ::Lerp(a[c], b[c], t);
+            }
+        }
+
+        // Check if all samples between two keys can be reconstructed by interpolating the keys.
+        bool IsSegmentWithinError(const AZStd::vector<float>& values, const AZStd::vector<float>& decodedValues, size_t numComponents, bool isRotation, size_t keyA, size_t keyB, float maxError)
+        {
+            const size_t stride = GetStride(numComponents, isRotation);
+            const float* decodedA = &decodedValues[keyA * stride];
+            const float* decodedB = &decodedValues[keyB * stride];
+            const float invSegmentLength = 1.0f / static_cast<float>(keyB - keyA);
+
+            float interpolated[4];
+            for (size_t s = keyA + 1; s < keyB; ++s)
+            {
+                Interpolate(decodedA, decodedB, static_cast<float>(s - keyA) * invSegmentLength, numComponents, isRotation, interpolated);
+                if (CalculateError(&values[s * stride], interpolated, numComponents, isRotation) > maxError)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool IsInList(const AZStd::vector<size_t>& list, size_t index)
+        {
+            return AZStd::find(list.begin(), list.end(), index) != list.end();
+        }
+
+        void StoreVector3Samples(const AZStd::vector<AZ::Vector3>& samples, AZStd::vector<float>& outValues)
+        {
+            outValues.resize(samples.size() * 3);
+            for (size_t s = 0; s < samples.size(); ++s)
+            {
+                samples[s].StoreToFloat3(&outValues[s * 3]);
+            }
+        }
+
+        void StoreRotationSamples(const AZStd::vector<AZ::Quaternion>& samples, AZStd::vector<float>& outValues)
+        {
+            outValues.resize(samples.size() * 4);
+            for (size_t s = 0; s < samples.size(); ++s)
+            {
+                samples[s].GetNormalized().StoreToFloat4(&outValues[s * 4]);
+            }
+        }
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Keyframes (smaller, slightly slower)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+
+        Clear();
+        CopyBaseMotionData(motionData);
+        SetSampleRate(sampleRate);
+        m_numSamples = numSamples;
+        UpdateDuration();
+
+        AZ_Warning("EMotionFX", AZ::IsClose(m_sampleSpacing, sampleSpacing, AZ::Constants::FloatEpsilon),
+            "Corrected sample spacing should match the set inverse sample rate. Floating point accuracy error.");
+
+        // Resample all animated tracks before compressing them.
+        UncompressedData data;
+        data.m_joints.resize(GetNumJoints());
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            UncompressedData::JointSamples& samples = data.m_joints[i];
+            const bool posAnimated = motionData->IsJointPositionAnimated(i);
+            const bool rotAnimated = motionData->IsJointRotationAnimated(i);
+            if (posAnimated) { samples.m_positions.resize(m_numSamples); }
+            if (rotAnimated) { samples.m_rotations.resize(m_numSamples); }
+            EMFX_SCALECODE
+            (
+                const bool scaleAnimated = motionData->IsJointScaleAnimated(i);
+                if (scaleAnimated) { samples.m_scales.resize(m_numSamples); }
+            )
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float keyTime = s * sampleSpacing;
+                const Transform transform = motionData->SampleJointTransform(keyTime, i);
+                if (posAnimated) samples.m_positions[s] = transform.m_position;
+                if (rotAnimated) samples.m_rotations[s] = transform.m_rotation.GetNormalized();
+                EMFX_SCALECODE
+                (
+                    if (scaleAnimated) samples.m_scales[s] = transform.m_scale;
+                )
+            }
+        }
+
+        data.m_morphs.resize(GetNumMorphs());
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                data.m_morphs[i].resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    data.m_morphs[i][s] = motionData->SampleMorph(s * sampleSpacing, i);
+                }
+            }
+        }
+
+        data.m_floats.resize(GetNumFloats());
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                data.m_floats[i].resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    data.m_floats[i][s] = motionData->SampleFloat(s * sampleSpacing, i);
+                }
+            }
+        }
+
+        Compress(data, OptimizeSettings());
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        UncompressedData data;
+        Decompress(data);
+        Compress(data, settings);
+    }
+
+    void CompressedMotionData::Compress(const UncompressedData& data, const OptimizeSettings& settings)
+    {
+        AZ_Assert(data.m_joints.size() == GetNumJoints() && data.m_morphs.size() == GetNumMorphs() && data.m_floats.size() == GetNumFloats(),
+            "Expected the uncompressed data to match the number of joints, morphs and floats.");
+
+        m_packedData.clear();
+        m_keySamples.clear();
+
+        size_t numBits = 0;
+        AZStd::vector<float> values;
+        for (size_t i = 0; i < data.m_joints.size(); ++i)
+        {
+            // Ignored tracks are stored at the highest bit rate, without removing any keys.
+            const bool ignore = IsInList(settings.m_jointIgnoreList, i);
+            const UncompressedData::JointSamples& samples = data.m_joints[i];
+            JointData& jointData = m_jointData[i];
+            jointData = JointData();
+
+            if (!samples.m_positions.empty())
+            {
+                StoreVector3Samples(samples.m_positions, values);
+                jointData.m_position = CompressTrack(values, 3, /*isRotation=*/false, ignore ? 0.0f : settings.m_maxPosError, numBits);
+            }
+
+            if (!samples.m_rotations.empty())
+            {
+                StoreRotationSamples(samples.m_rotations, values);
+                jointData.m_rotation = CompressTrack(values, 3, /*isRotation=*/true, ignore ? 0.0f : settings.m_maxRotError, numBits);
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            if (!samples.m_scales.empty())
+            {
+                StoreVector3Samples(samples.m_scales, values);
+                jointData.m_scale = CompressTrack(values, 3, /*isRotation=*/false, ignore ? 0.0f : settings.m_maxScaleError, numBits);
+            }
+#endif
+        }
+
+        for (size_t i = 0; i < data.m_morphs.size(); ++i)
+        {
+            m_morphData[i] = data.m_morphs[i].empty() ? Track() :
+                CompressTrack(data.m_morphs[i], 1, /*isRotation=*/false, IsInList(settings.m_morphIgnoreList, i) ? 0.0f : settings.m_maxMorphError, numBits);
+        }
+
+        for (size_t i = 0; i < data.m_floats.size(); ++i)
+        {
+            m_floatData[i] = data.m_floats[i].empty() ? Track() :
+                CompressTrack(data.m_floats[i], 1, /*isRotation=*/false, IsInList(settings.m_floatIgnoreList, i) ? 0.0f : settings.m_maxFloatError, numBits);
+        }
+
+        m_packedData.resize(((numBits + 7) >> 3) + s_numPaddingBytes, 0);
+        m_packedData.shrink_to_fit();
+        m_keySamples.shrink_to_fit();
+    }
+
+    CompressedMotionData::Track CompressedMotionData::CompressTrack(const AZStd::vector<float>& values, size_t numComponents, bool isRotation, float maxError, size_t& inOutNumBits)
+    {
+        AZ_Assert(numComponents <= 3, "Expected at most three components per track.");
+        const size_t stride = GetStride(numComponents, isRotation);
+        const size_t numSamples = values.size() / stride;
+
+        // Rotations are quantized using their smallest three components.
+        AZStd::vector<float> encodedValues;
+        AZStd::vector<AZ::u32> largestIndices;
+        if (isRotation)
+        {
+            encodedValues.resize(numSamples * numComponents);
+            largestIndices.resize(numSamples);
+            for (size_t s = 0; s < numSamples; ++s)
+            {
+                largestIndices[s] = EncodeRotation(&values[s * stride], &encodedValues[s * numComponents]);
+            }
+        }
+        const AZStd::vector<float>& trackValues = isRotation ? encodedValues : values;
+
+        Track track;
+        track.m_numComponents = static_cast<AZ::u8>(numComponents);
+        for (size_t c = 0; c < numComponents; ++c)
+        {
+            float minValue = trackValues[c];
+            float maxValue = trackValues[c];
+            for (size_t s = 1; s < numSamples; ++s)
+            {
+                minValue = AZ::GetMin(minValue, trackValues[s * numComponents + c]);
+                maxValue = AZ::GetMax(maxValue, trackValues[s * numComponents + c]);
+            }
+            track.m_rangeMin[c] = minValue;
+            track.m_rangeExtent[c] = maxValue - minValue;
+        }
+
+        // Find the lowest bit rate that keeps the quantization error within half of the error bound, leaving the rest for key reduction.
+        AZStd::vector<AZ::u32> quantizedValues(numSamples * numComponents);
+        AZStd::vector<float> decodedValues(values.size());
+        const float maxQuantizationError = maxError * 0.5f;
+        for (AZ::u8 numBits = s_minBitsPerComponent; numBits <= s_maxBitsPerComponent; ++numBits)
+        {
+            float quantizationError = 0.0f;
+            float dequantized[3];
+            for (size_t s = 0; s < numSamples; ++s)
+            {
+                for (size_t c = 0; c < numComponents; ++c)
+                {
+                    const AZ::u32 quantized = Quantize(trackValues[s * numComponents + c], track.m_rangeMin[c], track.m_rangeExtent[c], numBits);
+                    quantizedValues[s * numComponents + c] = quantized;
+                    dequantized[c] = Dequantize(quantized, track.m_rangeMin[c], track.m_rangeExtent[c], numBits);
+                }
+
+                float* decoded = &decodedValues[s * stride];
+                if (isRotation)
+                {
+                    DecodeRotation(largestIndices[s], dequantized, decoded);
+                }
+                else
+                {
+                    AZStd::copy(dequantized, dequantized + numComponents, decoded);
+                }
+                quantizationError = AZ::GetMax(quantizationError, CalculateError(&values[s * stride], decoded, numComponents, isRotation));
+            }
+
+            track.m_bitsPerComponent = numBits;
+            if (quantizationError <= maxQuantizationError)
+            {
+                break;
+            }
+        }
+
+        // Remove the samples that can be reconstructed by interpolating their neighboring keys.
+        AZStd::vector<AZ::u16> keySamples;
+        if (maxError > 0.0f && numSamples > 2 && numSamples <= AZStd::numeric_limits<AZ::u16>::max())
+        {
+            keySamples.emplace_back(static_cast<AZ::u16>(0));
+            size_t keyA = 0;
+            while (keyA < numSamples - 1)
+            {
+                const size_t lastKey = AZ::GetMin(keyA + s_maxKeySpacing, numSamples - 1);
+                size_t keyB = keyA + 1;
+                while (keyB < lastKey && IsSegmentWithinError(values, decodedValues, numComponents, isRotation, keyA, keyB + 1, maxError))
+                {
+                    ++keyB;
+                }
+
+                keySamples.emplace_back(static_cast<AZ::u16>(keyB));
+                keyA = keyB;
+            }
+
+            // Only keep the reduced keys when they are smaller than storing every sample, taking the key sample indices into account.
+            const size_t numKeyBits = GetNumKeyBits(numComponents, track.m_bitsPerComponent, isRotation);
+            if (keySamples.size() * (numKeyBits + 16) >= numSamples * numKeyBits)
+            {
+                keySamples.clear();
+            }
+        }
+
+        if (!keySamples.empty())
+        {
+            track.m_keyOffset = static_cast<AZ::u32>(m_keySamples.size());
+            track.m_numKeys = static_cast<AZ::u32>(keySamples.size());
+            m_keySamples.insert(m_keySamples.end(), keySamples.begin(), keySamples.end());
+        }
+        else
+        {
+            track.m_numKeys = static_cast<AZ::u32>(numSamples);
+        }
+
+        // Pack the quantized keys.
+        const size_t numKeyBits = GetNumKeyBits(numComponents, track.m_bitsPerComponent, isRotation);
+        track.m_bitOffset = static_cast<AZ::u32>(inOutNumBits);
+        inOutNumBits += track.m_numKeys * numKeyBits;
+        m_packedData.resize(((inOutNumBits + 7) >> 3) + s_numPaddingBytes, 0);
+        for (size_t k = 0; k < track.m_numKeys; ++k)
+        {
+            const size_t sampleIndex = keySamples.empty() ? k : keySamples[k];
+            size_t bitOffset = track.m_bitOffset + k * numKeyBits;
+            if (isRotation)
+            {
+                WriteBits(m_packedData, bitOffset, largestIndices[sampleIndex], s_numRotationIndexBits);
+                bitOffset += s_numRotationIndexBits;
+            }
+
+            for (size_t c = 0; c < numComponents; ++c)
+            {
+                WriteBits(m_packedData, bitOffset, quantizedValues[sampleIndex * numComponents + c], track.m_bitsPerComponent);
+                bitOffset += track.m_bitsPerComponent;
+            }
+        }
+
+        return track;
+    }
+
+    void CompressedMotionData::Decompress(UncompressedData& outData) const
+    {
+        outData.m_joints.clear();
+        outData.m_joints.resize(m_jointData.size());
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            const JointData& jointData = m_jointData[i];
+            UncompressedData::JointSamples& samples = outData.m_joints[i];
+            if (jointData.m_position.m_numKeys > 0)
+            {
+                samples.m_positions.resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    samples.m_positions[s] = SampleVector3Track(jointData.m_position, s, 0.0f);
+                }
+            }
+
+            if (jointData.m_rotation.m_numKeys > 0)
+            {
+                samples.m_rotations.resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    samples.m_rotations[s] = SampleRotationTrack(jointData.m_rotation, s, 0.0f);
+                }
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            if (jointData.m_scale.m_numKeys > 0)
+            {
+                samples.m_scales.resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    samples.m_scales[s] = SampleVector3Track(jointData.m_scale, s, 0.0f);
+                }
+            }
+#endif
+        }
+
+        outData.m_morphs.clear();
+        outData.m_morphs.resize(m_morphData.size());
+        for (size_t i = 0; i < m_morphData.size(); ++i)
+        {
+            if (m_morphData[i].m_numKeys > 0)
+            {
+                outData.m_morphs[i].resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    outData.m_morphs[i][s] = SampleFloatTrack(m_morphData[i], s, 0.0f);
+                }
+            }
+        }
+
+        outData.m_floats.clear();
+        outData.m_floats.resize(m_floatData.size());
+        for (size_t i = 0; i < m_floatData.size(); ++i)
+        {
+            if (m_floatData[i].m_numKeys > 0)
+            {
+                outData.m_floats[i].resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    outData.m_floats[i][s] = SampleFloatTrack(m_floatData[i], s, 0.0f);
+                }
+            }
+        }
+    }
+
+    void CompressedMotionData::CalculateKeyIndices(const Track& track, size_t indexA, float t, size_t& outKeyA, size_t& outKeyB, float& outT) const
+    {
+        // Tracks that kept all samples are indexed directly.
+        if (track.m_numKeys == m_numSamples)
+        {
+            outKeyA = indexA;
+            outKeyB = AZ::GetMin(indexA + 1, m_numSamples - 1);
+            outT = t;
+            return;
+        }
+
+        // Find the keys surrounding the sample, the first key is always at sample zero and the last key at the last sample.
+        const AZ::u16* keySamplesBegin = m_keySamples.data() + track.m_keyOffset;
+        const AZ::u16* keySamplesEnd = keySamplesBegin + track.m_numKeys;
+        const AZ::u16* upper = AZStd::upper_bound(keySamplesBegin, keySamplesEnd, static_cast<AZ::u16>(indexA));
+        if (upper == keySamplesEnd)
+        {
+            outKeyA = track.m_numKeys - 1;
+            outKeyB = outKeyA;
+            outT = 0.0f;
+            return;
+        }
+
+        outKeyB = upper - keySamplesBegin;
+        outKeyA = outKeyB - 1;
+        const float sampleA = static_cast<float>(keySamplesBegin[outKeyA]);
+        const float sampleB = static_cast<float>(keySamplesBegin[outKeyB]);
+        outT = (static_cast<float>(indexA) + t - sampleA) / (sampleB - sampleA);
+    }
+
+    void CompressedMotionData::DecodeKey(const Track& track, size_t keyIndex, bool isRotation, float* outValues) const
+    {
+        const AZ::u8 numBits = track.m_bitsPerComponent;
+        size_t bitOffset = track.m_bitOffset + keyIndex * GetNumKeyBits(track.m_numComponents, numBits, isRotation);
+        AZ::u32 largestIndex = 0;
+        if (isRotation)
+        {
+            largestIndex = ReadBits(m_packedData.data(), bitOffset, s_numRotationIndexBits);
+            bitOffset += s_numRotationIndexBits;
+        }
+
+        float values[3];
+        for (size_t c = 0; c < track.m_numComponents; ++c)
+        {
+            values[c] = Dequantize(ReadBits(m_packedData.data(), bitOffset, numBits), track.m_rangeMin[c], track.m_rangeExtent[c], numBits);
+            bitOffset += numBits;
+        }
+
+        if (isRotation)
+        {
+            DecodeRotation(largestIndex, values, outValues);
+        }
+        else
+        {
+            AZStd::copy(values, values + track.m_numComponents, outValues);
+        }
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleVector3Track(const Track& track, size_t indexA, float t) const
+    {
+        size_t keyA;
+        size_t keyB;
+        float keyT;
+        CalculateKeyIndices(track, indexA, t, keyA, keyB, keyT);
+
+        float valuesA[3];
+        float valuesB[3];
+        DecodeKey(track, keyA, /*isRotation=*/false, valuesA);
+        DecodeKey(track, keyB, /*isRotation=*/false, valuesB);
+        return AZ::Vector3::CreateFromFloat3(valuesA).Lerp(AZ::Vector3::CreateFromFloat3(valuesB), keyT);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleRotationTrack(const Track& track, size_t indexA, float t) const
+    {
+        size_t keyA;
+        size_t keyB;
+        float keyT;
+        CalculateKeyIndices(track, indexA, t, keyA, keyB, keyT);
+
+        float valuesA[4];
+        float valuesB[4];
+        DecodeKey(track, keyA, /*isRotation=*/true, valuesA);
+        DecodeKey(track, keyB, /*isRotation=*/true, valuesB);
+        return ToQuaternion(valuesA).NLerp(ToQuaternion(valuesB), keyT);
+    }
+
+    float CompressedMotionData::SampleFloatTrack(const Track& track, size_t indexA, float t) const
+    {
+        size_t keyA;
+        size_t keyB;
+        float keyT;
+        CalculateKeyIndices(track, indexA, t, keyA, keyB, keyT);
+
+        float valueA;
+        float valueB;
+        DecodeKey(track, keyA, /*isRotation=*/false, &valueA);
+        DecodeKey(track, keyB, /*isRotation=*/false, &valueB);
+        return AZ::Lerp(valueA, valueB, keyT);
+    }
+
+    Transform CompressedMotionData::SampleJointData(size_t jointDataIndex, size_t indexA, float t) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+
+        Transform result;
+        result.m_position = (jointData.m_position.m_numKeys > 0) ? SampleVector3Track(jointData.m_position, indexA, t) : staticTransform.m_position;
+        result.m_rotation = (jointData.m_rotation.m_numKeys > 0) ? SampleRotationTrack(jointData.m_rotation, indexA, t) : staticTransform.m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+        result.m_scale = (jointData.m_scale.m_numKeys > 0) ? SampleVector3Track(jointData.m_scale, indexA, t) : staticTransform.m_scale;
+#endif
+        return result;
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const SampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t transformDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && transformDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const bool inPlace = (settings.m_inPlace && skeleton->GetNode(jointSkeletonIndex)->GetIsRootNode());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (transformDataIndex != InvalidIndex && !inPlace)
+        {
+            result = SampleJointData(transformDataIndex, indexA, t);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const SampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeleton->GetNode(skeletonJointIndex)->GetIsRootNode());
+
+            // Sample the interpolated data.
+            Transform result;
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                result = SampleJointData(jointDataIndex, indexA, t);
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const Track& track = m_morphData[realIndex];
+                if (track.m_numKeys > 0)
+                {
+                    outputPose->SetMorphWeight(i, SampleFloatTrack(track, indexA, t));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, m_staticMorphData[realIndex].m_staticValue);
+                }
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const Track& track = m_morphData[morphDataIndex];
+        return (track.m_numKeys > 0) ? SampleFloatTrack(track, indexA, t) : m_staticMorphData[morphDataIndex].m_staticValue;
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const Track& track = m_floatData[floatDataIndex];
+        return (track.m_numKeys > 0) ? SampleFloatTrack(track, indexA, t) : m_staticFloatData[floatDataIndex].m_staticValue;
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleJointData(jointDataIndex, indexA, t);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const Track& track = m_jointData[jointDataIndex].m_position;
+        return (track.m_numKeys > 0) ? SampleVector3Track(track, indexA, t) : m_staticJointData[jointDataIndex].m_staticTransform.m_position;
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const Track& track = m_jointData[jointDataIndex].m_rotation;
+        return (track.m_numKeys > 0) ? SampleRotationTrack(track, indexA, t) : m_staticJointData[jointDataIndex].m_staticTransform.m_rotation;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const Track& track = m_jointData[jointDataIndex].m_scale;
+        return (track.m_numKeys > 0) ? SampleVector3Track(track, indexA, t) : m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+    }
+#endif
+
+    CompressedMotionData::ErrorStats CompressedMotionData::CalculateErrorStats(const MotionData* referenceData) const
+    {
+        AZ_Assert(referenceData, "Expected a valid reference motion data.");
+        AZ_Assert(referenceData->GetNumJoints() == GetNumJoints() && referenceData->GetNumMorphs() == GetNumMorphs() && referenceData->GetNumFloats() == GetNumFloats(),
+            "Expected the reference motion data to contain the same joints, morphs and floats.");
+
+        ErrorStats result;
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            const float sampleTime = s * m_sampleSpacing;
+            for (size_t i = 0; i < GetNumJoints(); ++i)
+            {
+                const Transform transform = SampleJointTransform(sampleTime, i);
+                const Transform referenceTransform = referenceData->SampleJointTransform(sampleTime, i);
+                result.m_maxPosError = AZ::GetMax(result.m_maxPosError, transform.m_position.GetDistance(referenceTransform.m_position));
+                result.m_maxRotError = AZ::GetMax(result.m_maxRotError, CalculateRotationError(transform.m_rotation, referenceTransform.m_rotation.GetNormalized()));
+                EMFX_SCALECODE
+                (
+                    result.m_maxScaleError = AZ::GetMax(result.m_maxScaleError, transform.m_scale.GetDistance(referenceTransform.m_scale));
+                )
+            }
+
+            for (size_t i = 0; i < GetNumMorphs(); ++i)
+            {
+                result.m_maxMorphError = AZ::GetMax(result.m_maxMorphError, AZ::GetAbs(SampleMorph(sampleTime, i) - referenceData->SampleMorph(sampleTime, i)));
+            }
+
+            for (size_t i = 0; i < GetNumFloats(); ++i)
+            {
+                result.m_maxFloatError = AZ::GetMax(result.m_maxFloatError, AZ::GetAbs(SampleFloat(sampleTime, i) - referenceData->SampleFloat(sampleTime, i)));
+            }
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointData.resize(numJoints);
+        m_morphData.resize(numMorphs);
+        m_floatData.resize(numFloats);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointData.size(), "Expected the size of the jointData vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointData.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphData.size(), "Expected the size of the morphData vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphData.emplace_back();
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatData.size(), "Expected the size of the floatData vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatData.emplace_back();
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        m_jointData.erase(m_jointData.begin() + jointDataIndex);
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphData.erase(m_morphData.begin() + morphDataIndex);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatData.erase(m_floatData.begin() + floatDataIndex);
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointData.clear();
+        m_jointData.shrink_to_fit();
+        m_morphData.clear();
+        m_morphData.shrink_to_fit();
+        m_floatData.clear();
+        m_floatData.shrink_to_fit();
+        m_keySamples.clear();
+        m_keySamples.shrink_to_fit();
+        m_packedData.clear();
+        m_packedData.shrink_to_fit();
+
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // The quantized values are relative to the track range, so scaling the range scales the decoded positions.
+        for (JointData& jointData : m_jointData)
+        {
+            for (size_t c = 0; c < 3; ++c)
+            {
+                jointData.m_position.m_rangeMin[c] *= scaleFactor;
+                jointData.m_position.m_rangeExtent[c] *= scaleFactor;
+            }
+        }
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    size_t CompressedMotionData::GetNumKeys() const
+    {
+        size_t numKeys = 0;
+        for (const JointData& jointData : m_jointData)
+        {
+            numKeys += jointData.m_position.m_numKeys + jointData.m_rotation.m_numKeys;
+            EMFX_SCALECODE
+            (
+                numKeys += jointData.m_scale.m_numKeys;
+            )
+        }
+
+        for (const Track& track : m_morphData)
+        {
+            numKeys += track.m_numKeys;
+        }
+
+        for (const Track& track : m_floatData)
+        {
+            numKeys += track.m_numKeys;
+        }
+
+        return numKeys;
+    }
+
+    size_t CompressedMotionData::GetPackedDataSizeInBytes() const
+    {
+        return m_packedData.empty() ? 0 : m_packedData.size() - s_numPaddingBytes;
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_position.m_numKeys > 0;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotation.m_numKeys > 0;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_scale.m_numKeys > 0;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+#ifndef EMFX_SCALE_DISABLED
+        return (IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex) || IsJointScaleAnimated(jointDataIndex));
+#else
+        return (IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex));
+#endif
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphData[morphDataIndex].m_numKeys > 0;
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatData[floatDataIndex].m_numKeys > 0;
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        for (JointData& data : m_jointData)
+        {
+            data = JointData();
+        }
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (Track& track : m_morphData)
+        {
+            track = Track();
+        }
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (Track& track : m_floatData)
+        {
+            track = Track();
+        }
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_position = Track();
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_rotation = Track();
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_scale = Track();
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex] = JointData();
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphData[morphDataIndex] = Track();
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatData[floatDataIndex] = Track();
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        AZ::u32 m_numKeySamples = 0;
+        AZ::u32 m_numPackedBytes = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+        // AZ::u16[m_numKeySamples]
+        // AZ::u8[m_numPackedBytes]
+    };
+
+    struct File_CompressedMotionData_Track
+    {
+        float m_rangeMin[3] = { 0.0f, 0.0f, 0.0f };
+        float m_rangeExtent[3] = { 0.0f, 0.0f, 0.0f };
+        AZ::u32 m_bitOffset = 0;
+        AZ::u32 m_keyOffset = 0;
+        AZ::u32 m_numKeys = 0;          // Zero when the track is not animated.
+        AZ::u8 m_numComponents = 0;
+        AZ::u8 m_bitsPerComponent = 0;
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+
+        // Followed by:
+        // string : The name of the joint.
+        // File_CompressedMotionData_Track : The position track.
+        // File_CompressedMotionData_Track : The rotation track.
+        // File_CompressedMotionData_Track : The scale track.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f; // The static (first frame) value.
+
+        // Followed by:
+        // string : The name of the channel.
+        // File_CompressedMotionData_Track : The track.
+    };
+    //---------------------------------------------------------------------------------------
+
+    bool CompressedMotionData::SaveTrack(MCore::Stream* stream, const Track& track, MCore::Endian::EEndianType targetEndianType)
+    {
+        File_CompressedMotionData_Track trackChunk;
+        for (size_t c = 0; c < 3; ++c)
+        {
+            trackChunk.m_rangeMin[c] = track.m_rangeMin[c];
+            trackChunk.m_rangeExtent[c] = track.m_rangeExtent[c];
+            ExporterLib::ConvertFloat(&trackChunk.m_rangeMin[c], targetEndianType);
+            ExporterLib::ConvertFloat(&trackChunk.m_rangeExtent[c], targetEndianType);
+        }
+        trackChunk.m_bitOffset = track.m_bitOffset;
+        trackChunk.m_keyOffset = track.m_keyOffset;
+        trackChunk.m_numKeys = track.m_numKeys;
+        trackChunk.m_numComponents = track.m_numComponents;
+        trackChunk.m_bitsPerComponent = track.m_bitsPerComponent;
+        ExporterLib::ConvertUnsignedInt(&trackChunk.m_bitOffset, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&trackChunk.m_keyOffset, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&trackChunk.m_numKeys, targetEndianType);
+
+        return stream->Write(&trackChunk, sizeof(File_CompressedMotionData_Track)) != 0;
+    }
+
+    bool CompressedMotionData::ReadTrack(MCore::Stream* stream, Track& track, MCore::Endian::EEndianType sourceEndianType)
+    {
+        File_CompressedMotionData_Track trackChunk;
+        if (stream->Read(&trackChunk, sizeof(File_CompressedMotionData_Track)) == 0)
+        {
+            return false;
+        }
+
+        MCore::Endian::ConvertFloat(trackChunk.m_rangeMin, sourceEndianType, /*count=*/3);
+        MCore::Endian::ConvertFloat(trackChunk.m_rangeExtent, sourceEndianType, /*count=*/3);
+        MCore::Endian::ConvertUnsignedInt32(&trackChunk.m_bitOffset, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&trackChunk.m_keyOffset, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&trackChunk.m_numKeys, sourceEndianType);
+
+        for (size_t c = 0; c < 3; ++c)
+        {
+            track.m_rangeMin[c] = trackChunk.m_rangeMin[c];
+            track.m_rangeExtent[c] = trackChunk.m_rangeExtent[c];
+        }
+        track.m_bitOffset = trackChunk.m_bitOffset;
+        track.m_keyOffset = trackChunk.m_keyOffset;
+        track.m_numKeys = trackChunk.m_numKeys;
+        track.m_numComponents = trackChunk.m_numComponents;
+        track.m_bitsPerComponent = trackChunk.m_bitsPerComponent;
+        return true;
+    }
+
+    bool CompressedMotionData::IsTrackValid(const Track& track, bool isRotation) const
+    {
+        if (track.m_numKeys == 0)
+        {
+            return true;
+        }
+
+        if (track.m_numComponents == 0 || track.m_numComponents > 3 ||
+            track.m_bitsPerComponent < s_minBitsPerComponent || track.m_bitsPerComponent > s_maxBitsPerComponent)
+        {
+            return false;
+        }
+
+        // Tracks either store every sample, or a list of key samples that starts at the first and ends at the last sample.
+        if (track.m_numKeys != m_numSamples)
+        {
+            if (track.m_numKeys < 2 || static_cast<size_t>(track.m_keyOffset) + track.m_numKeys > m_keySamples.size() ||
+                m_keySamples[track.m_keyOffset] != 0 || m_keySamples[track.m_keyOffset + track.m_numKeys - 1] != m_numSamples - 1)
+            {
+                return false;
+            }
+        }
+
+        const size_t numTrackBits = static_cast<size_t>(track.m_numKeys) * GetNumKeyBits(track.m_numComponents, track.m_bitsPerComponent, isRotation);
+        return static_cast<size_t>(track.m_bitOffset) + numTrackBits <= GetPackedDataSizeInBytes() * 8;
+    }
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+            numBytes += 3 * sizeof(File_CompressedMotionData_Track);
+        }
+
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+            numBytes += sizeof(File_CompressedMotionData_Track);
+        }
+
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+            numBytes += sizeof(File_CompressedMotionData_Track);
+        }
+
+        numBytes += m_keySamples.size() * sizeof(AZ::u16);
+        numBytes += GetPackedDataSizeInBytes();
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_numKeySamples = static_cast<AZ::u32>(m_keySamples.size());
+        info.m_numPackedBytes = static_cast<AZ::u32>(GetPackedDataSizeInBytes());
+        info.m_sampleRate = GetSampleRate();
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumSamples     = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + NumKeys        = %zu", GetNumKeys());
+            MCore::LogDetailedInfo("  + NumPackedBytes = %d", info.m_numPackedBytes);
+        }
+
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numKeySamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numPackedBytes, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, GetJointStaticRotation(i));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, GetJointBindPoseRotation(i));
+            EMFX_SCALECODE
+            (
+                ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(GetJointStaticScale(i)));
+                ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(GetJointBindPoseScale(i)));
+            )
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(i).c_str());
+                MCore::LogDetailedInfo("   + Position Keys: %d", m_jointData[i].m_position.m_numKeys);
+                MCore::LogDetailedInfo("   + Rotation Keys: %d", m_jointData[i].m_rotation.m_numKeys);
+                EMFX_SCALECODE
+                (
+                    MCore::LogDetailedInfo("   + Scale Keys:    %d", m_jointData[i].m_scale.m_numKeys);
+                )
+            }
+
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+
+            const JointData& jointData = m_jointData[i];
+#ifndef EMFX_SCALE_DISABLED
+            const Track& scaleTrack = jointData.m_scale;
+#else
+            const Track scaleTrack;
+#endif
+            if (!SaveTrack(stream, jointData.m_position, targetEndianType) ||
+                !SaveTrack(stream, jointData.m_rotation, targetEndianType) ||
+                !SaveTrack(stream, scaleTrack, targetEndianType))
+            {
+                return false;
+            }
+        }
+
+        // Write the morph and float channels.
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = GetMorphStaticValue(i);
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetMorphName(i), stream, targetEndianType);
+            if (!SaveTrack(stream, m_morphData[i], targetEndianType))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = GetFloatStaticValue(i);
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetFloatName(i), stream, targetEndianType);
+            if (!SaveTrack(stream, m_floatData[i], targetEndianType))
+            {
+                return false;
+            }
+        }
+
+        // Write the key samples.
+        for (AZ::u16 keySample : m_keySamples)
+        {
+            ExporterLib::ConvertUnsignedShort(&keySample, targetEndianType);
+            if (stream->Write(&keySample, sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+        }
+
+        // Write the packed keys, these are stored byte by byte so they don't need endian conversion.
+        const size_t numPackedBytes = GetPackedDataSizeInBytes();
+        if (numPackedBytes > 0 && stream->Write(m_packedData.data(), numPackedBytes) == 0)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numKeySamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numPackedBytes, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints      = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs      = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats      = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples     = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + NumPackedBytes = %d", info.m_numPackedBytes);
+            MCore::LogDetailedInfo("  + SampleRate     = %f", info.m_sampleRate);
+        }
+
+        // Initialize the motion data.
+        Clear();
+        Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        m_numSamples = info.m_numSamples;
+        SetSampleRate(info.m_sampleRate);
+        UpdateDuration();
+
+        // Read all joints.
+        AZStd::string name;
+        for (size_t i = 0; i < info.m_numJoints; ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetJointName(i, name);
+
+            JointData& jointData = m_jointData[i];
+#ifndef EMFX_SCALE_DISABLED
+            Track& scaleTrack = jointData.m_scale;
+#else
+            Track scaleTrack;
+#endif
+            if (!ReadTrack(stream, jointData.m_position, sourceEndianType) ||
+                !ReadTrack(stream, jointData.m_rotation, sourceEndianType) ||
+                !ReadTrack(stream, scaleTrack, sourceEndianType))
+            {
+                return false;
+            }
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - Position Keys = %d", jointData.m_position.m_numKeys);
+                MCore::LogDetailedInfo("    - Rotation Keys = %d", jointData.m_rotation.m_numKeys);
+                MCore::LogDetailedInfo("    - Scale Keys    = %d", scaleTrack.m_numKeys);
+            }
+        }
+
+        // Read the morphs.
+        for (size_t i = 0; i < info.m_numMorphs; ++i)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetMorphName(i, name);
+            SetMorphStaticValue(i, floatInfo.m_staticValue);
+            if (!ReadTrack(stream, m_morphData[i], sourceEndianType))
+            {
+                return false;
+            }
+        }
+
+        // Read the floats.
+        for (size_t i = 0; i < info.m_numFloats; ++i)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetFloatName(i, name);
+            SetFloatStaticValue(i, floatInfo.m_staticValue);
+            if (!ReadTrack(stream, m_floatData[i], sourceEndianType))
+            {
+                return false;
+            }
+        }
+
+        // Read the key samples and the packed keys.
+        m_keySamples.resize(info.m_numKeySamples);
+        if (info.m_numKeySamples > 0)
+        {
+            if (stream->Read(m_keySamples.data(), info.m_numKeySamples * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt16(m_keySamples.data(), sourceEndianType, info.m_numKeySamples);
+        }
+
+        m_packedData.resize(info.m_numPackedBytes + s_numPaddingBytes, 0);
+        if (info.m_numPackedBytes > 0 && stream->Read(m_packedData.data(), info.m_numPackedBytes) == 0)
+        {
+            return false;
+        }
+
+        // Make sure no track reads outside of the packed data.
+        bool isValid = true;
+        for (const JointData& jointData : m_jointData)
+        {
+            isValid &= IsTrackValid(jointData.m_position, /*isRotation=*/false) && IsTrackValid(jointData.m_rotation, /*isRotation=*/true);
+            EMFX_SCALECODE
+            (
+                isValid &= IsTrackValid(jointData.m_scale, /*isRotation=*/false);
+            )
+        }
+        for (const Track& track : m_morphData)
+        {
+            isValid &= IsTrackValid(track, /*isRotation=*/false);
+        }
+        for (const Track& track : m_floatData)
+        {
+            isValid &= IsTrackValid(track, /*isRotation=*/false);
+        }
+
+        if (!isValid)
+        {
+            AZ_Error("EMotionFX", false, "CompressedMotionData contains tracks that are out of range, cannot load motion data.");
+            Clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+
+} // namespace EMotionFX
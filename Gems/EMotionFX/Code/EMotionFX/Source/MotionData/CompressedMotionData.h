@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    //! Motion data that stores quantized and key reduced tracks.
+    //! The data is resampled at a uniform sample rate. Every animated track is then quantized within its own value range, using the
+    //! lowest number of bits per component that stays within the error bounds of the optimize settings. Afterwards, samples that can be
+    //! reconstructed by interpolating their neighbors are removed. The remaining keys of all tracks are packed into a single bit stream.
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator, 0)
+        AZ_RTTI(CompressedMotionData, "{AE0D8637-105E-49EA-9080-B04A495A5E5C}", MotionData)
+
+        static constexpr AZ::u8 s_minBitsPerComponent = 4;
+        static constexpr AZ::u8 s_maxBitsPerComponent = 24;
+        static constexpr size_t s_maxKeySpacing = 255; // The maximum number of samples between two keys, limits the cost of key reduction.
+
+        //! The maximum errors between sampled values and the values of a reference motion.
+        struct EMFX_API ErrorStats
+        {
+            float m_maxPosError = 0.0f;     // In units.
+            float m_maxRotError = 0.0f;     // In degrees.
+            float m_maxScaleError = 0.0f;   // In scale factor.
+            float m_maxMorphError = 0.0f;   // Morph difference.
+            float m_maxFloatError = 0.0f;   // Float difference.
+        };
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+
+        //! Recompresses the tracks using the error bounds of the given settings.
+        //! The tracks are recompressed from their decompressed samples, so the error bounds add up with the ones used before.
+        //! InitFromNonUniformData uses the default optimize settings.
+        void Optimize(const OptimizeSettings& settings) override;
+
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const SampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const SampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        //! Samples both this and the reference motion data at every sample time and returns the largest differences.
+        //! @param referenceData The motion data to compare against, usually the motion data this was initialized from.
+        ErrorStats CalculateErrorStats(const MotionData* referenceData) const;
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        size_t GetNumKeys() const;
+        size_t GetPackedDataSizeInBytes() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+    private:
+        // A quantized track of up to three components.
+        // Rotations store the three smallest components of the quaternion, every key is prefixed with the index of the largest component.
+        struct EMFX_API Track
+        {
+            float m_rangeMin[3] = { 0.0f, 0.0f, 0.0f };
+            float m_rangeExtent[3] = { 0.0f, 0.0f, 0.0f };
+            AZ::u32 m_bitOffset = 0;        // The offset of the first key in the packed data, in bits.
+            AZ::u32 m_keyOffset = 0;        // The offset of the first key sample index, only used when keys have been removed.
+            AZ::u32 m_numKeys = 0;          // The number of keys, zero when the track is not animated.
+            AZ::u8 m_numComponents = 0;
+            AZ::u8 m_bitsPerComponent = 0;
+        };
+
+        struct EMFX_API JointData
+        {
+            Track m_position;
+            Track m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+            Track m_scale;
+#endif
+        };
+
+        // The uncompressed samples of all tracks, used while (re)compressing.
+        struct EMFX_API UncompressedData
+        {
+            struct EMFX_API JointSamples
+            {
+                AZStd::vector<AZ::Vector3> m_positions;
+                AZStd::vector<AZ::Quaternion> m_rotations;
+#ifndef EMFX_SCALE_DISABLED
+                AZStd::vector<AZ::Vector3> m_scales;
+#endif
+            };
+
+            AZStd::vector<JointSamples> m_joints;
+            AZStd::vector<AZStd::vector<float>> m_morphs;
+            AZStd::vector<AZStd::vector<float>> m_floats;
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+        void UpdateSampleSpacing();
+
+        void Compress(const UncompressedData& data, const OptimizeSettings& settings);
+        void Decompress(UncompressedData& outData) const;
+        Track CompressTrack(const AZStd::vector<float>& values, size_t numComponents, bool isRotation, float maxError, size_t& inOutNumBits);
+        bool IsTrackValid(const Track& track, bool isRotation) const;
+
+        void CalculateKeyIndices(const Track& track, size_t indexA, float t, size_t& outKeyA, size_t& outKeyB, float& outT) const;
+        void DecodeKey(const Track& track, size_t keyIndex, bool isRotation, float* outValues) const;
+        AZ::Vector3 SampleVector3Track(const Track& track, size_t indexA, float t) const;
+        AZ::Quaternion SampleRotationTrack(const Track& track, size_t indexA, float t) const;
+        float SampleFloatTrack(const Track& track, size_t indexA, float t) const;
+        Transform SampleJointData(size_t jointDataIndex, size_t indexA, float t) const;
+
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+        static bool SaveTrack(MCore::Stream* stream, const Track& track, MCore::Endian::EEndianType targetEndianType);
+        static bool ReadTrack(MCore::Stream* stream, Track& track, MCore::Endian::EEndianType sourceEndianType);
+
+        AZStd::vector<JointData> m_jointData;
+        AZStd::vector<Track> m_morphData;
+        AZStd::vector<Track> m_floatData;
+        AZStd::vector<AZ::u16> m_keySamples;    // The sample indices of the keys of all key reduced tracks.
+        AZStd::vector<AZ::u8> m_packedData;     // The quantized keys of all tracks.
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
@@ -145,6 +145,7 @@ namespace EMotionFX
         m_numUpdated.SetValue(0);
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
+        m_numSkipped.SetValue(0);
 
         for (const ScheduleStep& currentStep : m_steps)
         {
@@ -176,9 +177,18 @@ namespace EMotionFX
                         m_numVisible.Increment();
                     }
 
+                    // check if the update rate allows a full update this frame
+                    float updateTimePassed = timePassedInSeconds;
+                    if (!actorInstance->AdvanceUpdateRateTimer(timePassedInSeconds, isVisible, updateTimePassed))
+                    {
+                        actorInstance->UpdateSkippedTransformations(isVisible);
+                        m_numSkipped.Increment();
+                        return;
+                    }
+
                     // check if we want to sample motions
                     bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + updateTimePassed);
                     if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
                     {
                         sampleMotions = true;
@@ -191,7 +201,8 @@ namespace EMotionFX
                     }
 
                     // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                    actorInstance->UpdateTransformations(updateTimePassed, isVisible, sampleMotions);
+                    actorInstance->StoreUpdateRatePose(isVisible);
                 }, true, jobContext);
 
                 job->SetDependent(&jobCompletion);               
@@ -48,6 +48,7 @@ namespace EMotionFX
         m_numUpdated.SetValue(0);
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
+        m_numSkipped.SetValue(0);
 
         // propagate root actor instance visibility to their attachments
         const size_t numRootActorInstances = GetActorManager().GetNumRootActorInstances();
@@ -85,28 +86,39 @@ namespace EMotionFX
 
         const bool isVisible = actorInstance->GetIsVisible();
 
-        // check if we want to sample motions
-        bool sampleMotions = false;
-        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        if (isVisible)
         {
-            sampleMotions = true;
-            actorInstance->SetMotionSamplingTimer(0.0f);
+            m_numVisible.Increment();
+        }
 
-            if (isVisible)
+        // check if the update rate allows a full update this frame
+        float updateTimePassed = timePassedInSeconds;
+        if (actorInstance->AdvanceUpdateRateTimer(timePassedInSeconds, isVisible, updateTimePassed))
+        {
+            // check if we want to sample motions
+            bool sampleMotions = false;
+            actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + updateTimePassed);
+            if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
             {
-                m_numSampled.Increment();
+                sampleMotions = true;
+                actorInstance->SetMotionSamplingTimer(0.0f);
+
+                if (isVisible)
+                {
+                    m_numSampled.Increment();
+                }
             }
-        }
 
-        if (isVisible)
+            // update the transformations
+            actorInstance->UpdateTransformations(updateTimePassed, isVisible, sampleMotions);
+            actorInstance->StoreUpdateRatePose(isVisible);
+        }
+        else
         {
-            m_numVisible.Increment();
+            actorInstance->UpdateSkippedTransformations(isVisible);
+            m_numSkipped.Increment();
         }
 
-        // update the transformations
-        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
-
         // recursively process the attachments
         const size_t numAttachments = actorInstance->GetNumAttachments();
         for (size_t i = 0; i < numAttachments; ++i)
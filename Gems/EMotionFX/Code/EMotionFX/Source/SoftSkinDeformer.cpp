@@ -7,6 +7,8 @@
  */
 
 // include the required headers
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include "EMotionFXConfig.h"
 #include "SoftSkinDeformer.h"
 #include "Mesh.h"
@@ -17,6 +19,7 @@
 #include "TransformData.h"
 #include "ActorInstance.h"
 #include <EMotionFX/Source/Allocators.h>
+#include <AzCore/Math/SimdMath.h>
 #include <MCore/Source/AzCoreConversions.h>
 
 
@@ -36,6 +39,8 @@ namespace EMotionFX
     {
         m_nodeNumbers.clear();
         m_boneMatrices.clear();
+        m_bakedBoneIndices.clear();
+        m_bakedBoneWeights.clear();
     }
 
 
@@ -69,6 +74,8 @@ namespace EMotionFX
         // copy the bone info (for precalc/optimization reasons)
         result->m_nodeNumbers    = m_nodeNumbers;
         result->m_boneMatrices   = m_boneMatrices;
+        result->m_bakedBoneIndices = m_bakedBoneIndices;
+        result->m_bakedBoneWeights = m_bakedBoneWeights;
 
         // return the result
         return result;
@@ -103,7 +110,87 @@ namespace EMotionFX
         AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
         AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
+        const uint32 numVertices = m_mesh->GetNumVertices();
+        if (!GetHasBakedInfluences())
+        {
+            SkinVertexRange(0, numVertices, positions, normals, tangents, bitangents, orgVerts, layer);
+            return;
+        }
+
+        // Small meshes are not worth the job overhead.
+        if (numVertices <= s_numVerticesPerBatch)
+        {
+            SkinBakedVertexRange(0, numVertices, positions, normals, tangents, bitangents, orgVerts);
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+
+        // Split up the skinned vertices into batches, the last batch is skinned on the calling thread.
+        const uint32 numBatches = (numVertices + s_numVerticesPerBatch - 1) / s_numVerticesPerBatch;
+        for (uint32 batchIndex = 0; batchIndex < numBatches - 1; ++batchIndex)
+        {
+            const uint32 startVertex = batchIndex * s_numVerticesPerBatch;
+            const uint32 endVertex = startVertex + s_numVerticesPerBatch;
+
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts]()
+                {
+                    SkinBakedVertexRange(startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts);
+                }, /*isAutoDelete=*/true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        SkinBakedVertexRange((numBatches - 1) * s_numVerticesPerBatch, numVertices, positions, normals, tangents, bitangents, orgVerts);
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+
+    void SoftSkinDeformer::SkinBakedVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, const uint32* orgVerts) const
+    {
+        using AZ::Simd::Vec4;
+
+        const AZ::Matrix3x4* __restrict boneMatrices = m_boneMatrices.data();
+        const uint16* __restrict boneIndices = m_bakedBoneIndices.data();
+        const float* __restrict boneWeights = m_bakedBoneWeights.data();
+
+        for (uint32 v = startVertex; v < endVertex; ++v)
+        {
+            // Blend the rows of the influencing bone matrices. Unused influences have a weight of zero, so every vertex
+            // runs the same fixed number of multiply-adds without branching on the influence count.
+            const size_t influenceOffset = static_cast<size_t>(orgVerts[v]) * s_maxBakedInfluences;
+            const uint16* vertexBoneIndices = boneIndices + influenceOffset;
+            const float* vertexBoneWeights = boneWeights + influenceOffset;
+
+            const Vec4::FloatType* boneRows = boneMatrices[vertexBoneIndices[0]].GetSimdValues();
+            Vec4::FloatType weight = Vec4::Splat(vertexBoneWeights[0]);
+            Vec4::FloatType row0 = Vec4::Mul(boneRows[0], weight);
+            Vec4::FloatType row1 = Vec4::Mul(boneRows[1], weight);
+            Vec4::FloatType row2 = Vec4::Mul(boneRows[2], weight);
+            for (uint32 i = 1; i < s_maxBakedInfluences; ++i)
+            {
+                boneRows = boneMatrices[vertexBoneIndices[i]].GetSimdValues();
+                weight = Vec4::Splat(vertexBoneWeights[i]);
+                row0 = Vec4::Madd(boneRows[0], weight, row0);
+                row1 = Vec4::Madd(boneRows[1], weight, row1);
+                row2 = Vec4::Madd(boneRows[2], weight, row2);
+            }
+            const AZ::Matrix3x4 skinMatrix(row0, row1, row2);
+
+            // output the skinned values
+            positions[v] = skinMatrix * positions[v];
+            normals[v] = skinMatrix.TransformVector(normals[v]);
+            if (tangents)
+            {
+                tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(skinMatrix.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
+            }
+            if (bitangents)
+            {
+                bitangents[v] = skinMatrix.TransformVector(bitangents[v]);
+            }
+        }
     }
 
 
@@ -211,6 +298,8 @@ namespace EMotionFX
         // clear the bone information array
         m_boneMatrices.clear();
         m_nodeNumbers.clear();
+        m_bakedBoneIndices.clear();
+        m_bakedBoneWeights.clear();
 
         // if there is no mesh
         if (m_mesh == nullptr)
@@ -252,5 +341,44 @@ namespace EMotionFX
                 influence->SetBoneNr(static_cast<uint16>(boneIndex));
             }
         }
+
+        BakeInfluences(skinningLayer);
+    }
+
+
+    void SoftSkinDeformer::BakeInfluences(SkinningInfoVertexAttributeLayer* skinningLayer)
+    {
+        m_bakedBoneIndices.clear();
+        m_bakedBoneWeights.clear();
+
+        if (m_boneMatrices.empty())
+        {
+            return;
+        }
+
+        const uint32 numOrgVerts = m_mesh->GetNumOrgVertices();
+        for (uint32 i = 0; i < numOrgVerts; ++i)
+        {
+            if (skinningLayer->GetNumInfluences(i) > s_maxBakedInfluences)
+            {
+                // Fall back to skinning directly from the skinning info layer.
+                return;
+            }
+        }
+
+        // Unused influence slots point at the first bone with a weight of zero.
+        m_bakedBoneIndices.resize(static_cast<size_t>(numOrgVerts) * s_maxBakedInfluences, 0);
+        m_bakedBoneWeights.resize(static_cast<size_t>(numOrgVerts) * s_maxBakedInfluences, 0.0f);
+        for (uint32 i = 0; i < numOrgVerts; ++i)
+        {
+            const size_t influenceOffset = static_cast<size_t>(i) * s_maxBakedInfluences;
+            const size_t numInfluences = skinningLayer->GetNumInfluences(i);
+            for (size_t a = 0; a < numInfluences; ++a)
+            {
+                const SkinInfluence* influence = skinningLayer->GetInfluence(i, a);
+                m_bakedBoneIndices[influenceOffset + a] = influence->GetBoneNr();
+                m_bakedBoneWeights[influenceOffset + a] = influence->GetWeight();
+            }
+        }
     }
 } // namespace EMotionFX
@@ -117,9 +117,20 @@ namespace EMotionFX
         MCORE_INLINE void ReserveLocalBones(size_t numBones)                { m_nodeNumbers.reserve(numBones); m_boneMatrices.reserve(numBones); }
 
 
+        /**
+         * Check if the skinning influences have been baked into the fixed size influence arrays.
+         * Meshes that have vertices with more than s_maxBakedInfluences influences are skinned using the skinning info layer directly.
+         * @result True in case the baked influences are used for skinning, false if not.
+         */
+        MCORE_INLINE bool GetHasBakedInfluences() const                     { return !m_bakedBoneIndices.empty(); }
+
+        static constexpr uint32 s_maxBakedInfluences = 4;   /**< The maximum number of influences per vertex that can be baked. */
+
     protected:
         AZStd::vector<AZ::Matrix3x4>    m_boneMatrices;
         AZStd::vector<size_t>           m_nodeNumbers;
+        AZStd::vector<uint16>           m_bakedBoneIndices;     /**< The local bone indices, s_maxBakedInfluences per original vertex. Empty in case the influences could not be baked. */
+        AZStd::vector<float>            m_bakedBoneWeights;     /**< The influence weights, s_maxBakedInfluences per original vertex, unused slots have a weight of zero. */
 
         /**
          * Default constructor.
@@ -144,5 +155,20 @@ namespace EMotionFX
         }
 
         void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+
+        /**
+         * Skin a range of vertices using the baked influences.
+         * Instead of transforming every vertex attribute by each of the influencing bones, the bone matrices are blended first
+         * and the attributes are transformed only once by the blended matrix.
+         */
+        void SkinBakedVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, const uint32* orgVerts) const;
+
+        /**
+         * Bake the skinning influences of the mesh into the fixed size influence arrays.
+         * @param skinningLayer The skinning info layer of the mesh, with the local bone numbers already assigned.
+         */
+        void BakeInfluences(SkinningInfoVertexAttributeLayer* skinningLayer);
+
+        static constexpr uint32 s_numVerticesPerBatch = 10000;
     };
 } // namespace EMotionFX
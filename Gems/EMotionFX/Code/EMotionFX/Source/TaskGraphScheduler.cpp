@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "TaskGraphScheduler.h"
+#include "ActorManager.h"
+#include "ActorInstance.h"
+#include "Attachment.h"
+#include "EMotionFXManager.h"
+#include <EMotionFX/Source/Allocators.h>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(TaskGraphScheduler, ActorUpdateAllocator, 0)
+
+    // create
+    TaskGraphScheduler* TaskGraphScheduler::Create()
+    {
+        return aznew TaskGraphScheduler();
+    }
+
+
+    // clear the schedule
+    void TaskGraphScheduler::Clear()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_actorInstances.clear();
+        m_isTaskGraphDirty = true;
+    }
+
+
+    // log it, for debugging purposes
+    void TaskGraphScheduler::Print()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        UpdateTaskGraph();
+
+        const size_t numBatches = m_batches.size();
+        for (size_t i = 0; i < numBatches; ++i)
+        {
+            const Batch& batch = m_batches[i];
+            if (batch.m_parentBatch == InvalidIndex)
+            {
+                AZ_Printf("EMotionFX", "BATCH %.3zu - %zu actor instances, %zu joints", i, batch.m_actorInstances.size(), batch.m_numJoints);
+            }
+            else
+            {
+                AZ_Printf("EMotionFX", "BATCH %.3zu - %zu actor instances, %zu joints, after batch %.3zu", i, batch.m_actorInstances.size(), batch.m_numJoints, batch.m_parentBatch);
+            }
+        }
+
+        AZ_Printf("EMotionFX", "---------");
+    }
+
+
+    void TaskGraphScheduler::SetMinBatchNumJoints(size_t numJoints)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        if (m_minBatchNumJoints != numJoints)
+        {
+            m_minBatchNumJoints = numJoints;
+            m_isTaskGraphDirty = true;
+        }
+    }
+
+
+    // execute the schedule
+    void TaskGraphScheduler::Execute(float timePassedInSeconds)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        if (m_actorInstances.empty())
+        {
+            return;
+        }
+
+        // propagate root actor instance visibility to their attachments
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
+            if (rootInstance->GetIsEnabled() == false)
+            {
+                continue;
+            }
+
+            rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
+        }
+
+        // reset stats
+        m_numUpdated.SetValue(0);
+        m_numVisible.SetValue(0);
+        m_numSampled.SetValue(0);
+        m_numSkipped.SetValue(0);
+
+        UpdateTaskGraph();
+
+        // the retained tasks read the time passed from the scheduler, as their captures can't change in between submissions
+        m_timePassedInSeconds = timePassedInSeconds;
+
+        // every task worker needs its own thread data, as it holds the pose pools, which EMotion FX creates on initialization
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        if (useTaskGraph && GetEMotionFX().GetNumThreads() < AZ::TaskExecutor::Instance().GetThreadCount())
+        {
+            AZ_WarningOnce("EMotionFX", false, "EMotion FX got initialized before the task executor, actor instances are updated serially.");
+            useTaskGraph = false;
+        }
+
+        if (!useTaskGraph)
+        {
+            for (const Batch& batch : m_batches)
+            {
+                ExecuteBatch(batch, 0);
+            }
+            return;
+        }
+
+        m_taskGraph.Submit(&m_taskGraphEvent);
+        m_taskGraphEvent.Wait();
+    }
+
+
+    void TaskGraphScheduler::UpdateTaskGraph()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        if (!m_isTaskGraphDirty)
+        {
+            return;
+        }
+        m_isTaskGraphDirty = false;
+
+        // group the actor instances into batches, starting at the root of every attachment hierarchy
+        m_batches.clear();
+        size_t openBatch = InvalidIndex;
+        for (ActorInstance* actorInstance : m_actorInstances)
+        {
+            if (!HasActorInstance(actorInstance->GetAttachedTo()))
+            {
+                RecursiveAddToBatches(actorInstance, InvalidIndex, openBatch);
+            }
+        }
+
+        // create a task per batch, where batches holding attachments follow the batch of the actor instance they are attached to
+        m_taskGraph.Reset();
+
+        static const AZ::TaskDescriptor batchTaskDescriptor{ "TaskGraphScheduler::ExecuteBatch", "Animation" };
+        const size_t numBatches = m_batches.size();
+        AZStd::vector<AZ::TaskToken> taskTokens;
+        taskTokens.reserve(numBatches);
+        for (size_t i = 0; i < numBatches; ++i)
+        {
+            taskTokens.emplace_back(m_taskGraph.AddTask(batchTaskDescriptor, [this, i]()
+            {
+                AZ_PROFILE_SCOPE(Animation, "TaskGraphScheduler::ExecuteBatch");
+
+                const uint32 threadIndex = AZ::TaskExecutor::Instance().GetWorkerIndex();
+                AZ_Assert(threadIndex < GetEMotionFX().GetNumThreads(), "Expected the batch to be executed by a task worker.");
+                ExecuteBatch(m_batches[i], threadIndex);
+            }));
+
+            const size_t parentBatch = m_batches[i].m_parentBatch;
+            if (parentBatch != InvalidIndex)
+            {
+                taskTokens[parentBatch].Precedes(taskTokens[i]);
+            }
+        }
+    }
+
+
+    void TaskGraphScheduler::RecursiveAddToBatches(ActorInstance* actorInstance, size_t parentBatch, size_t& inOutOpenBatch)
+    {
+        const size_t numJoints = actorInstance->GetNumNodes();
+
+        size_t batchIndex = InvalidIndex;
+        if (parentBatch != InvalidIndex && numJoints < m_minBatchNumJoints)
+        {
+            // small attachments are updated right after the actor instance they are attached to, inside the same task
+            batchIndex = parentBatch;
+        }
+        else if (parentBatch == InvalidIndex && inOutOpenBatch != InvalidIndex && m_batches[inOutOpenBatch].m_numJoints < m_minBatchNumJoints)
+        {
+            // fill up the open batch with root actor instances until it has enough joints
+            batchIndex = inOutOpenBatch;
+        }
+        else
+        {
+            batchIndex = m_batches.size();
+            m_batches.emplace_back().m_parentBatch = parentBatch;
+            if (parentBatch == InvalidIndex)
+            {
+                inOutOpenBatch = batchIndex;
+            }
+        }
+
+        m_batches[batchIndex].m_actorInstances.emplace_back(actorInstance);
+        m_batches[batchIndex].m_numJoints += numJoints;
+
+        // the attachments get added after their parent, so they are updated after it when they end up in the same batch
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment && HasActorInstance(attachment))
+            {
+                RecursiveAddToBatches(attachment, batchIndex, inOutOpenBatch);
+            }
+        }
+    }
+
+
+    void TaskGraphScheduler::ExecuteBatch(const Batch& batch, uint32 threadIndex)
+    {
+        for (ActorInstance* actorInstance : batch.m_actorInstances)
+        {
+            if (actorInstance->GetIsEnabled())
+            {
+                UpdateActorInstance(actorInstance, threadIndex);
+            }
+        }
+    }
+
+
+    void TaskGraphScheduler::UpdateActorInstance(ActorInstance* actorInstance, uint32 threadIndex)
+    {
+        actorInstance->SetThreadIndex(threadIndex);
+        m_numUpdated.Increment();
+
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // check if the update rate allows a full update this frame
+        float updateTimePassed = m_timePassedInSeconds;
+        if (!actorInstance->AdvanceUpdateRateTimer(m_timePassedInSeconds, isVisible, updateTimePassed))
+        {
+            actorInstance->UpdateSkippedTransformations(isVisible);
+            m_numSkipped.Increment();
+            return;
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + updateTimePassed);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        // update the actor instance
+        actorInstance->UpdateTransformations(updateTimePassed, isVisible, sampleMotions);
+        actorInstance->StoreUpdateRatePose(isVisible);
+    }
+
+
+    bool TaskGraphScheduler::HasActorInstance(const ActorInstance* actorInstance) const
+    {
+        return actorInstance && AZStd::find(m_actorInstances.begin(), m_actorInstances.end(), actorInstance) != m_actorInstances.end();
+    }
+
+
+    void TaskGraphScheduler::RecursiveInsertActorInstance(ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        AZ_Assert(!HasActorInstance(actorInstance), "Expected the actor instance not being part of the schedule already.");
+
+        if (!HasActorInstance(actorInstance))
+        {
+            m_actorInstances.emplace_back(actorInstance);
+            m_isTaskGraphDirty = true;
+        }
+
+        // recursively add all attachments too
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveInsertActorInstance(attachment);
+            }
+        }
+    }
+
+
+    // remove the actor instance from the schedule (excluding attachments)
+    size_t TaskGraphScheduler::RemoveActorInstance(ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        const auto it = AZStd::find(m_actorInstances.begin(), m_actorInstances.end(), actorInstance);
+        if (it != m_actorInstances.end())
+        {
+            m_actorInstances.erase(it);
+            m_isTaskGraphDirty = true;
+        }
+
+        return 0;
+    }
+
+
+    // remove the actor instance (including all of its attachments)
+    void TaskGraphScheduler::RecursiveRemoveActorInstance(ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        RemoveActorInstance(actorInstance);
+
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveRemoveActorInstance(attachment);
+            }
+        }
+    }
+}   // namespace EMotionFX
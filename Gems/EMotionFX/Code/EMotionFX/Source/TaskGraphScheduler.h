@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// include the required headers
+#include "EMotionFXConfig.h"
+#include "ActorUpdateScheduler.h"
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+
+
+    /**
+     * The task graph update scheduler.
+     * This scheduler updates the actor instances on the task graph. The graph gets built once and is resubmitted every frame, until the set of
+     * scheduled actor instances changes. Actor instances with only a few joints are batched into a single task, so that the task overhead
+     * doesn't outweigh the update itself. Attachments are updated after the actor instance they are attached to, either inside the same task
+     * or in a task that follows it, so that independent actor instances never have to wait on each other.
+     */
+    class EMFX_API TaskGraphScheduler
+        : public ActorUpdateScheduler
+    {
+        AZ_CLASS_ALLOCATOR_DECL
+
+    public:
+        enum
+        {
+            TYPE_ID = 0x00000003
+        };
+
+        static constexpr size_t s_defaultMinBatchNumJoints = 512;
+
+        /**
+         * A group of actor instances that get updated in order, by a single task.
+         */
+        struct EMFX_API Batch
+        {
+            AZStd::vector<ActorInstance*> m_actorInstances;
+            size_t m_numJoints = 0;                 /**< The total number of joints of the actor instances in the batch. */
+            size_t m_parentBatch = InvalidIndex;    /**< The batch that has to be updated before this one, as it contains the actor instance the first actor instance is attached to. */
+        };
+
+        static TaskGraphScheduler* Create();
+
+        const char* GetName() const override        { return "TaskGraphScheduler"; }
+        uint32 GetType() const override             { return TYPE_ID; }
+
+        void Execute(float timePassedInSeconds) override;
+        void Print() override;
+        void Clear() override;
+
+        void RecursiveInsertActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+        void RecursiveRemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+        size_t RemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Set the minimum number of joints a task should update.
+         * Actor instances are added to a batch until their joints add up to this value. Attachments with fewer joints are updated in the task of the
+         * actor instance they are attached to.
+         * @param numJoints The minimum number of joints per task. Setting it to 0 creates a task for every actor instance.
+         */
+        void SetMinBatchNumJoints(size_t numJoints);
+        size_t GetMinBatchNumJoints() const         { return m_minBatchNumJoints; }
+
+        const Batch& GetBatch(size_t index) const   { return m_batches[index]; }
+        size_t GetNumBatches() const                { return m_batches.size(); }
+
+        /**
+         * Build the task graph in case the set of actor instances changed since the last time.
+         * This is called automatically by Execute().
+         */
+        void UpdateTaskGraph();
+
+    protected:
+        MCore::MutexRecursive           m_mutex;
+        AZ::TaskGraph                   m_taskGraph;
+        AZ::TaskGraphEvent              m_taskGraphEvent;
+        AZStd::vector<ActorInstance*>   m_actorInstances;
+        AZStd::vector<Batch>            m_batches;
+        size_t                          m_minBatchNumJoints = s_defaultMinBatchNumJoints;
+        float                           m_timePassedInSeconds = 0.0f;   /**< The time passed of the frame that is being executed, read by the retained tasks. */
+        bool                            m_isTaskGraphDirty = true;
+
+        TaskGraphScheduler() = default;
+        ~TaskGraphScheduler() override = default;
+
+        bool HasActorInstance(const ActorInstance* actorInstance) const;
+        void RecursiveAddToBatches(ActorInstance* actorInstance, size_t parentBatch, size_t& inOutOpenBatch);
+        void ExecuteBatch(const Batch& batch, uint32 threadIndex);
+        void UpdateActorInstance(ActorInstance* actorInstance, uint32 threadIndex);
+    };
+}   // namespace EMotionFX
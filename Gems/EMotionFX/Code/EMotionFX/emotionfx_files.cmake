@@ -136,6 +136,8 @@ set(FILES
     Source/StandardMaterial.h
     Source/SubMesh.cpp
     Source/SubMesh.h
+    Source/TaskGraphScheduler.cpp
+    Source/TaskGraphScheduler.h
     Source/ThreadData.cpp
     Source/ThreadData.h
     Source/Transform.cpp
@@ -346,6 +348,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
@@ -34,10 +34,14 @@ namespace EMotionFX
             if (serializeContext)
             {
                 serializeContext->Class<Configuration>()
-                    ->Version(2)
+                    ->Version(3)
                     ->Field("LODDistances", &Configuration::m_lodDistances)
                     ->Field("EnableLODSampling", &Configuration::m_enableLodSampling)
                     ->Field("LODSampleRates", &Configuration::m_lodSampleRates)
+                    ->Field("EnableLODUpdateRates", &Configuration::m_enableLodUpdateRates)
+                    ->Field("LODUpdateRates", &Configuration::m_lodUpdateRates)
+                    ->Field("InvisibleUpdateRate", &Configuration::m_invisibleUpdateRate)
+                    ->Field("InterpolateUpdates", &Configuration::m_interpolateUpdates)
                     ;
 
                 AZ::EditContext* editContext = serializeContext->GetEditContext();
@@ -61,7 +65,25 @@ namespace EMotionFX
                             ->Attribute(AZ::Edit::Attributes::Visibility, &SimpleLODComponent::Configuration::GetEnableLodSampling)
                             ->Attribute(AZ::Edit::Attributes::ContainerCanBeModified, false)
                             ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
-                            ->ElementAttribute(AZ::Edit::Attributes::Step, 1.0f);
+                            ->ElementAttribute(AZ::Edit::Attributes::Step, 1.0f)
+                        ->DataElement(0, &SimpleLODComponent::Configuration::m_enableLodUpdateRates,
+                            "Enable LOD update rates", "The anim graph update rate will adjust based on LOD level and visibility. Updates of many actors get spread across frames.")
+                            ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                        ->DataElement(0, &SimpleLODComponent::Configuration::m_lodUpdateRates,
+                            "Update rates", "The number of anim graph updates per second based on LOD. Setting it to 0 means updating every frame.")
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &SimpleLODComponent::Configuration::GetEnableLodUpdateRates)
+                            ->Attribute(AZ::Edit::Attributes::ContainerCanBeModified, false)
+                            ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                            ->ElementAttribute(AZ::Edit::Attributes::Min, 0.0f)
+                            ->ElementAttribute(AZ::Edit::Attributes::Step, 1.0f)
+                        ->DataElement(0, &SimpleLODComponent::Configuration::m_invisibleUpdateRate,
+                            "Invisible update rate", "The number of anim graph updates per second while the actor is not visible. Setting it to 0 means updating every frame.")
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &SimpleLODComponent::Configuration::GetEnableLodUpdateRates)
+                            ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                            ->Attribute(AZ::Edit::Attributes::Step, 1.0f)
+                        ->DataElement(0, &SimpleLODComponent::Configuration::m_interpolateUpdates,
+                            "Interpolate updates", "Interpolate the pose in between updates. This delays the motion by one update, without it the pose is held until the next update.")
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &SimpleLODComponent::Configuration::GetEnableLodUpdateRates);
                 }
             }
         }
@@ -90,6 +112,17 @@ namespace EMotionFX
                 m_lodSampleRates.resize(numLODs);
                 AZStd::copy(begin(defaultSampleRate), end(defaultSampleRate), begin(m_lodSampleRates));
             }
+
+            if (numLODs != m_lodUpdateRates.size())
+            {
+                // Generate the default LOD update rate to every frame, 30, 20, 15, 10, 5, and keep the lowest rate for any further LODs.
+                constexpr AZStd::array defaultUpdateRate {0.0f, 30.0f, 20.0f, 15.0f, 10.0f, 5.0f};
+                m_lodUpdateRates.resize(numLODs);
+                for (size_t i = 0; i < numLODs; ++i)
+                {
+                    m_lodUpdateRates[i] = defaultUpdateRate[AZ::GetMin(i, defaultUpdateRate.size() - 1)];
+                }
+            }
         }
 
         bool SimpleLODComponent::Configuration::GetEnableLodSampling()
@@ -97,6 +130,11 @@ namespace EMotionFX
             return m_enableLodSampling;
         }
 
+        bool SimpleLODComponent::Configuration::GetEnableLodUpdateRates()
+        {
+            return m_enableLodUpdateRates;
+        }
+
         void SimpleLODComponent::Reflect(AZ::ReflectContext* context)
         {
             Configuration::Reflect(context);
@@ -210,6 +248,20 @@ namespace EMotionFX
                     const float updateRateInSeconds = animGraphSampleRate > 0.0f ? 1.0f / animGraphSampleRate : 0.0f;
                     actorInstance->SetMotionSamplingRate(updateRateInSeconds);
                 }
+
+                if (configuration.m_enableLodUpdateRates && lodByDistance < configuration.m_lodUpdateRates.size())
+                {
+                    const float lodUpdateRate = configuration.m_lodUpdateRates[lodByDistance];
+                    actorInstance->SetUpdateRate(lodUpdateRate > 0.0f ? 1.0f / lodUpdateRate : 0.0f);
+                    actorInstance->SetInvisibleUpdateRate(configuration.m_invisibleUpdateRate > 0.0f ? 1.0f / configuration.m_invisibleUpdateRate : 0.0f);
+                    actorInstance->SetUpdateRateInterpolationEnabled(configuration.m_interpolateUpdates);
+                }
+                else
+                {
+                    // Update every frame again, in case the update rates were enabled before
+                    actorInstance->SetUpdateRate(0.0f);
+                    actorInstance->SetInvisibleUpdateRate(0.0f);
+                }
             }
         }
     } // namespace integration
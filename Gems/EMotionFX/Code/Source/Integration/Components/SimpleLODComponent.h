@@ -46,12 +46,17 @@ namespace EMotionFX
                 // Generate the default value based on LOD level.
                 void GenerateDefaultValue(size_t numLODs);
                 bool GetEnableLodSampling();
+                bool GetEnableLodUpdateRates();
 
                 static void Reflect(AZ::ReflectContext* context);
 
                 AZStd::vector<float> m_lodDistances;         // LOD distances that decide which lod the actor should choose.
                 AZStd::vector<float> m_lodSampleRates;       // Per LOD sample rate.
                 bool m_enableLodSampling = false;            // Enable per LOD sampling rate. This will allow animation to sample at a lower rate for performance improvement.
+                AZStd::vector<float> m_lodUpdateRates;       // Per LOD update rate, in updates per second.
+                float m_invisibleUpdateRate = 5.0f;          // Update rate while the actor is not visible, in updates per second.
+                bool m_enableLodUpdateRates = false;         // Enable per LOD update rate. This will skip whole anim graph updates on far away or invisible actors for performance improvement.
+                bool m_interpolateUpdates = true;            // Interpolate the pose in between updates.
             };
 
             SimpleLODComponent(const Configuration* config = nullptr);
@@ -18,6 +18,7 @@
 
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/SingleThreadScheduler.h>
+#include <EMotionFX/Source/TaskGraphScheduler.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/AnimGraphManager.h>
 #include <EMotionFX/Source/AnimGraphObjectFactory.h>
@@ -368,8 +369,9 @@ namespace EMotionFX
             if (serializeContext)
             {
                 serializeContext->Class<SystemComponent, AZ::Component>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("NumThreads", &SystemComponent::m_numThreads)
+                    ->Field("UseTaskGraphScheduler", &SystemComponent::m_useTaskGraphScheduler)
                 ;
 
                 serializeContext->Class<MotionEvent>()
@@ -383,6 +385,7 @@ namespace EMotionFX
                         ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System", 0xc94d118b))
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                         ->DataElement(AZ::Edit::UIHandlers::Default, &SystemComponent::m_numThreads, "Number of threads", "Number of threads used internally by EMotion FX")
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &SystemComponent::m_useTaskGraphScheduler, "Use task graph scheduler", "Update the actor instances on the task graph, where attachments only wait on the actor instance they are attached to")
                     ;
                 }
             }
@@ -447,6 +450,7 @@ namespace EMotionFX
         {
             dependent.push_back(AZ_CRC("AssetCatalogService", 0xc68ffc57));
             dependent.push_back(AZ_CRC("JobsService", 0xd5ab5a50));
+            dependent.push_back(AZ_CRC_CE("TaskExecutorService"));
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -487,6 +491,11 @@ namespace EMotionFX
                 return;
             }
 
+            if (m_useTaskGraphScheduler)
+            {
+                EMotionFX::GetActorManager().SetScheduler(EMotionFX::TaskGraphScheduler::Create());
+            }
+
             SetMediaRoot("@assets@");
             // \todo Right now we're pointing at the @devassets@ location (source) and working from there, because .actor and .motion (motion) aren't yet processed through
             // the scene pipeline. Once they are, we'll need to update various segments of the Tool to always read from the @assets@ cache, but write to the @devassets@ data/metadata.
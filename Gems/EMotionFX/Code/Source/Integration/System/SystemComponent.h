@@ -121,6 +121,7 @@ namespace EMotionFX
 #endif // EMOTIONFXANIMATION_EDITOR
 
             AZ::u32 m_numThreads;
+            bool m_useTaskGraphScheduler = false;
 
         private:
             AZStd::vector<AZStd::unique_ptr<AZ::Data::AssetHandler> > m_assetHandlers;
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/JackActor.h>
+
+namespace EMotionFX
+{
+    class ActorUpdateRateFixture
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+
+            SystemComponentFixture::TearDown();
+        }
+
+        ActorInstance* CreateActorInstance()
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+            m_actorInstances.emplace_back(actorInstance);
+            return actorInstance;
+        }
+
+    protected:
+        AZStd::unique_ptr<JackNoMeshesActor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    TEST_F(ActorUpdateRateFixture, FullUpdatesReceiveTimePassedSinceLastUpdate)
+    {
+        ActorInstance* actorInstance = CreateActorInstance();
+        const float timeDelta = 0.01f;
+        float timePassed = 0.0f;
+
+        // Without an update rate every frame is a full update.
+        EXPECT_TRUE(actorInstance->AdvanceUpdateRateTimer(timeDelta, /*isVisible=*/true, timePassed));
+        EXPECT_FLOAT_EQ(timePassed, timeDelta);
+
+        actorInstance->SetUpdateRate(0.1f);
+        size_t numFullUpdates = 0;
+        for (size_t frame = 0; frame < 100; ++frame)
+        {
+            if (actorInstance->AdvanceUpdateRateTimer(timeDelta, /*isVisible=*/true, timePassed))
+            {
+                // The first full update depends on the phase of the actor instance, all later ones are one update rate apart.
+                if (numFullUpdates > 0)
+                {
+                    EXPECT_NEAR(timePassed, 0.1f, timeDelta + 0.001f);
+                }
+                numFullUpdates++;
+            }
+        }
+        EXPECT_GE(numFullUpdates, 9);
+        EXPECT_LE(numFullUpdates, 11);
+
+        // Invisible actor instances use their own update rate.
+        actorInstance->SetInvisibleUpdateRate(0.0f);
+        EXPECT_TRUE(actorInstance->AdvanceUpdateRateTimer(timeDelta, /*isVisible=*/false, timePassed));
+    }
+
+    TEST_F(ActorUpdateRateFixture, FullUpdatesAreSpreadAcrossFrames)
+    {
+        const size_t numActorInstances = 10;
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            CreateActorInstance()->SetUpdateRate(0.25f);
+        }
+
+        // At 60 frames per second, every actor instance gets a full update every 15 frames.
+        const ActorUpdateScheduler* scheduler = GetActorManager().GetScheduler();
+        size_t numFullUpdates = 0;
+        for (size_t frame = 0; frame < 60; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+
+            const size_t numFullUpdatesThisFrame = numActorInstances - scheduler->GetNumSkippedActorInstances();
+            EXPECT_LE(numFullUpdatesThisFrame, numActorInstances / 2) << "Expected the full updates to be spread across frames.";
+            numFullUpdates += numFullUpdatesThisFrame;
+        }
+
+        EXPECT_GE(numFullUpdates, 3 * numActorInstances);
+        EXPECT_LE(numFullUpdates, 4 * numActorInstances);
+    }
+} // namespace EMotionFX
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzCore/Math/Quaternion.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX::Benchmarks
+{
+    // Motion data registers itself with the EMotionFX runtime, so the benchmarks run inside the regular system component setup.
+    class MotionDataBenchmarkEnvironment
+        : public SystemComponentFixture
+    {
+    public:
+        void TestBody() override {}
+    };
+
+    class MotionDataBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr size_t s_numJoints = 64;
+        static constexpr size_t s_numSamples = 901;
+        static constexpr float s_sampleRate = 30.0f;
+
+        void internalSetUp()
+        {
+            m_environment = std::make_unique<MotionDataBenchmarkEnvironment>();
+            m_environment->SetUp();
+
+            // Every joint gets its own mix of curves, so that tracks end up with different bit rates and key counts.
+            m_sourceData = std::make_unique<NonUniformMotionData>();
+            m_sourceData->Resize(s_numJoints, /*numMorphs=*/0, /*numFloats=*/0);
+            for (size_t i = 0; i < s_numJoints; ++i)
+            {
+                const float frequency = 0.5f + static_cast<float>(i % 7) * 0.3f;
+                const float amplitude = 0.1f + static_cast<float>(i % 5) * 0.2f;
+                m_sourceData->AllocateJointPositionSamples(i, s_numSamples);
+                m_sourceData->AllocateJointRotationSamples(i, s_numSamples);
+                for (size_t s = 0; s < s_numSamples; ++s)
+                {
+                    const float time = s / s_sampleRate;
+                    const AZ::Vector3 position(amplitude * sinf(time * frequency), amplitude * cosf(time * frequency * 0.5f), time * 0.1f);
+                    const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationZ(time * frequency) * AZ::Quaternion::CreateRotationX(amplitude * sinf(time));
+                    m_sourceData->SetJointPositionSample(i, s, { time, position });
+                    m_sourceData->SetJointRotationSample(i, s, { time, rotation });
+                }
+            }
+            m_sourceData->UpdateDuration();
+        }
+
+        void internalTearDown()
+        {
+            m_sourceData.reset();
+            m_environment->TearDown();
+            m_environment.reset();
+        }
+
+        void SetUp(const ::benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(::benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        // Sample every joint at times that don't line up with the samples, similar to what playing back a motion does.
+        void SampleAllJoints(const MotionData& motionData, ::benchmark::State& state)
+        {
+            const float duration = motionData.GetDuration();
+            const float timeStep = 1.0f / 60.0f;
+            float time = 0.0f;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t i = 0; i < s_numJoints; ++i)
+                {
+                    Transform transform = motionData.SampleJointTransform(time, i);
+                    ::benchmark::DoNotOptimize(transform);
+                }
+
+                time += timeStep;
+                if (time > duration)
+                {
+                    time = 0.0f;
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * s_numJoints);
+        }
+
+        void SampleCompressed(const MotionData::OptimizeSettings& settings, ::benchmark::State& state)
+        {
+            CompressedMotionData motionData;
+            motionData.InitFromNonUniformData(m_sourceData.get(), /*keepSameSampleRate=*/false, s_sampleRate);
+            motionData.Optimize(settings);
+
+            const CompressedMotionData::ErrorStats errors = motionData.CalculateErrorStats(m_sourceData.get());
+            state.counters["PackedBytes"] = static_cast<double>(motionData.GetPackedDataSizeInBytes());
+            state.counters["Keys"] = static_cast<double>(motionData.GetNumKeys());
+            state.counters["MaxPosError"] = errors.m_maxPosError;
+            state.counters["MaxRotError"] = errors.m_maxRotError;
+
+            SampleAllJoints(motionData, state);
+        }
+
+    protected:
+        std::unique_ptr<MotionDataBenchmarkEnvironment> m_environment;
+        std::unique_ptr<NonUniformMotionData> m_sourceData;
+    };
+
+    BENCHMARK_F(MotionDataBenchmarkFixture, SampleUniformMotionData)(::benchmark::State& state)
+    {
+        UniformMotionData motionData;
+        motionData.InitFromNonUniformData(m_sourceData.get(), /*keepSameSampleRate=*/false, s_sampleRate);
+        state.counters["SampleBytes"] = static_cast<double>(s_numJoints * s_numSamples * (sizeof(AZ::Vector3) + sizeof(MCore::Compressed16BitQuaternion)));
+        SampleAllJoints(motionData, state);
+    }
+
+    BENCHMARK_F(MotionDataBenchmarkFixture, SampleCompressedMotionDataDefaultErrors)(::benchmark::State& state)
+    {
+        SampleCompressed(MotionData::OptimizeSettings(), state);
+    }
+
+    BENCHMARK_F(MotionDataBenchmarkFixture, SampleCompressedMotionDataHighErrors)(::benchmark::State& state)
+    {
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.01f;
+        settings.m_maxRotError = 0.1f;
+        SampleCompressed(settings, state);
+    }
+} // namespace EMotionFX::Benchmarks
+
+#endif // HAVE_BENCHMARK
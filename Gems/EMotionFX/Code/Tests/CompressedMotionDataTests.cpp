@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Quaternion.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/SystemComponentFixture.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataFixture
+        : public SystemComponentFixture
+    {
+    public:
+        static constexpr size_t s_numSamples = 301;
+        static constexpr float s_sampleRate = 30.0f;
+
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            // Joint 0 has curved position and rotation tracks, joint 1 moves linearly and joint 2 isn't animated.
+            m_sourceData.Resize(/*numJoints=*/3, /*numMorphs=*/1, /*numFloats=*/1);
+            m_sourceData.SetJointName(0, "curved");
+            m_sourceData.SetJointName(1, "linear");
+            m_sourceData.SetJointName(2, "static");
+            m_sourceData.SetJointStaticPosition(2, AZ::Vector3(1.0f, 2.0f, 3.0f));
+            m_sourceData.SetMorphName(0, "morph");
+            m_sourceData.SetFloatName(0, "float");
+
+            m_sourceData.AllocateJointPositionSamples(0, s_numSamples);
+            m_sourceData.AllocateJointRotationSamples(0, s_numSamples);
+            m_sourceData.AllocateJointPositionSamples(1, s_numSamples);
+            m_sourceData.AllocateMorphSamples(0, s_numSamples);
+            m_sourceData.AllocateFloatSamples(0, s_numSamples);
+            for (size_t s = 0; s < s_numSamples; ++s)
+            {
+                const float time = s / s_sampleRate;
+                const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationY(time * 1.7f) * AZ::Quaternion::CreateRotationX(sinf(time));
+                m_sourceData.SetJointPositionSample(0, s, { time, AZ::Vector3(sinf(time * 3.0f), cosf(time), time * 0.5f) });
+                m_sourceData.SetJointRotationSample(0, s, { time, rotation });
+                m_sourceData.SetJointPositionSample(1, s, { time, AZ::Vector3(time, time * 2.0f, -time) });
+                m_sourceData.SetMorphSample(0, s, { time, 0.5f + 0.5f * sinf(time * 2.0f) });
+                m_sourceData.SetFloatSample(0, s, { time, time * 10.0f });
+            }
+            m_sourceData.UpdateDuration();
+        }
+
+        void ExpectWithinBounds(const CompressedMotionData& motionData, const MotionData::OptimizeSettings& settings)
+        {
+            // Allow a small tolerance on top of the bounds for floating point differences between the error metrics.
+            const float tolerance = 1.0e-5f;
+            const CompressedMotionData::ErrorStats errors = motionData.CalculateErrorStats(&m_sourceData);
+            EXPECT_LE(errors.m_maxPosError, settings.m_maxPosError + tolerance);
+            EXPECT_LE(errors.m_maxRotError, settings.m_maxRotError + tolerance);
+            EXPECT_LE(errors.m_maxMorphError, settings.m_maxMorphError + tolerance);
+            EXPECT_LE(errors.m_maxFloatError, settings.m_maxFloatError + tolerance);
+        }
+
+    protected:
+        NonUniformMotionData m_sourceData;
+    };
+
+    TEST_F(CompressedMotionDataFixture, DefaultSettingsStayWithinErrorBounds)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData, /*keepSameSampleRate=*/false, s_sampleRate);
+        ASSERT_EQ(motionData.GetNumSamples(), s_numSamples);
+        EXPECT_TRUE(motionData.IsJointAnimated(0));
+        EXPECT_TRUE(motionData.IsJointAnimated(1));
+        EXPECT_FALSE(motionData.IsJointAnimated(2));
+        EXPECT_TRUE(motionData.SampleJointPosition(1.0f, 2).IsClose(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+
+        ExpectWithinBounds(motionData, MotionData::OptimizeSettings());
+    }
+
+    TEST_F(CompressedMotionDataFixture, OptimizeReducesKeysWithinErrorBounds)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData, /*keepSameSampleRate=*/false, s_sampleRate);
+        const size_t numKeysBefore = motionData.GetNumKeys();
+        const size_t numBytesBefore = motionData.GetPackedDataSizeInBytes();
+
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.01f;
+        settings.m_maxRotError = 0.1f;
+        settings.m_maxMorphError = 0.01f;
+        settings.m_maxFloatError = 0.01f;
+        motionData.Optimize(settings);
+        EXPECT_LT(motionData.GetNumKeys(), numKeysBefore);
+        EXPECT_LT(motionData.GetPackedDataSizeInBytes(), numBytesBefore);
+
+        // The already compressed samples get recompressed, so the bounds add up with the default ones used during initialization.
+        MotionData::OptimizeSettings accumulatedSettings = settings;
+        const MotionData::OptimizeSettings defaultSettings;
+        accumulatedSettings.m_maxPosError += defaultSettings.m_maxPosError;
+        accumulatedSettings.m_maxRotError += defaultSettings.m_maxRotError;
+        accumulatedSettings.m_maxMorphError += defaultSettings.m_maxMorphError;
+        accumulatedSettings.m_maxFloatError += defaultSettings.m_maxFloatError;
+        ExpectWithinBounds(motionData, accumulatedSettings);
+    }
+
+    TEST_F(CompressedMotionDataFixture, LinearTrackKeepsOnlyEndKeys)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData, /*keepSameSampleRate=*/false, s_sampleRate);
+
+        // Ignore the curved joint, so that only the linear joint, morph and float channels can be key reduced.
+        MotionData::OptimizeSettings settings;
+        settings.m_jointIgnoreList = { 0 };
+        motionData.Optimize(settings);
+        motionData.ClearJointTransformSamples(0);
+        motionData.ClearAllMorphSamples();
+
+        // A linear track can be reconstructed from its first and last sample, with one key per key spacing.
+        const size_t maxLinearKeys = (s_numSamples - 1) / CompressedMotionData::s_maxKeySpacing + 2;
+        EXPECT_LE(motionData.GetNumKeys(), 2 * maxLinearKeys);
+        EXPECT_TRUE(motionData.SampleJointPosition(5.0f, 1).IsClose(AZ::Vector3(5.0f, 10.0f, -5.0f), 0.01f));
+        EXPECT_NEAR(motionData.SampleFloat(5.0f, 0), 50.0f, 0.2f);
+    }
+
+    TEST_F(CompressedMotionDataFixture, SaveAndReadRoundTrip)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&m_sourceData, /*keepSameSampleRate=*/false, s_sampleRate);
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.01f;
+        motionData.Optimize(settings);
+
+        MCore::MemoryFile file;
+        file.Open();
+        const MotionData::SaveSettings saveSettings;
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        file.Seek(0);
+        CompressedMotionData loadedData;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+
+        ASSERT_EQ(loadedData.GetNumJoints(), motionData.GetNumJoints());
+        EXPECT_EQ(loadedData.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_EQ(loadedData.GetNumKeys(), motionData.GetNumKeys());
+        EXPECT_EQ(loadedData.GetJointName(1), motionData.GetJointName(1));
+        EXPECT_FLOAT_EQ(loadedData.GetDuration(), motionData.GetDuration());
+        for (float time = 0.0f; time < motionData.GetDuration(); time += 0.37f)
+        {
+            EXPECT_TRUE(loadedData.SampleJointPosition(time, 0).IsClose(motionData.SampleJointPosition(time, 0), 1.0e-6f));
+            EXPECT_TRUE(loadedData.SampleJointRotation(time, 0).IsClose(motionData.SampleJointRotation(time, 0), 1.0e-6f));
+            EXPECT_TRUE(loadedData.SampleJointPosition(time, 1).IsClose(motionData.SampleJointPosition(time, 1), 1.0e-6f));
+            EXPECT_FLOAT_EQ(loadedData.SampleMorph(time, 0), motionData.SampleMorph(time, 0));
+            EXPECT_FLOAT_EQ(loadedData.SampleFloat(time, 0), motionData.SampleFloat(time, 0));
+        }
+    }
+} // namespace EMotionFX
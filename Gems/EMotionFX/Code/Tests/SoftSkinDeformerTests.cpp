@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/Matchers.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/MeshDeformerStack.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <EMotionFX/Source/SoftSkinManager.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/MeshFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class SoftSkinDeformerFixture
+        : public SystemComponentFixture
+    {
+    public:
+        static constexpr size_t s_numJoints = 6;
+
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(s_numJoints);
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+
+            // Use a different skinning matrix for every joint so that mixing up influences shows in the results.
+            AZ::Matrix3x4* skinningMatrices = m_actorInstance->GetTransformData()->GetSkinningMatrices();
+            for (size_t i = 0; i < s_numJoints; ++i)
+            {
+                const float value = static_cast<float>(i + 1);
+                skinningMatrices[i] = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(
+                    AZ::Quaternion::CreateRotationZ(value * 0.3f), AZ::Vector3(value, -value, value * 0.5f));
+            }
+        }
+
+        void TearDown() override
+        {
+            m_actorInstance->Destroy();
+            SystemComponentFixture::TearDown();
+        }
+
+        // Skin a mesh where the vertices cycle through 1 up to maxInfluences influences and compare the results with the reference calculation.
+        void SkinAndCompare(AZ::u32 numVertices, size_t maxInfluences, bool expectBakedInfluences)
+        {
+            AZStd::vector<AZ::u32> indices(numVertices);
+            AZStd::vector<AZ::Vector3> vertices(numVertices);
+            AZStd::vector<AZ::Vector3> normals(numVertices);
+            AZStd::vector<MeshFactory::VertexSkinInfluences> skinningInfo(numVertices);
+            for (AZ::u32 v = 0; v < numVertices; ++v)
+            {
+                indices[v] = v;
+                vertices[v] = AZ::Vector3(static_cast<float>(v % 7), static_cast<float>(v % 5), static_cast<float>(v % 3));
+                normals[v] = AZ::Vector3(0.0f, 0.0f, 1.0f);
+
+                const size_t numInfluences = (v % maxInfluences) + 1;
+                for (size_t i = 0; i < numInfluences; ++i)
+                {
+                    skinningInfo[v].emplace_back((v + i) % s_numJoints, 1.0f / static_cast<float>(numInfluences));
+                }
+            }
+
+            const size_t lodLevel = 0;
+            const size_t jointIndex = 0;
+            Mesh* mesh = MeshFactory::Create(indices, vertices, normals, {}, skinningInfo);
+            m_actor->SetMesh(lodLevel, jointIndex, mesh);
+            MeshDeformerStack* meshDeformerStack = MeshDeformerStack::Create(mesh);
+            m_actor->SetMeshDeformerStack(lodLevel, jointIndex, meshDeformerStack);
+
+            SoftSkinDeformer* deformer = GetSoftSkinManager().CreateDeformer(mesh);
+            meshDeformerStack->AddDeformer(deformer);
+            deformer->Reinitialize(m_actor.get(), m_actor->GetSkeleton()->GetNode(jointIndex), lodLevel);
+            EXPECT_EQ(deformer->GetHasBakedInfluences(), expectBakedInfluences);
+
+            deformer->Update(m_actorInstance, m_actor->GetSkeleton()->GetNode(jointIndex), 0.0f);
+
+            const AZ::Matrix3x4* skinningMatrices = m_actorInstance->GetTransformData()->GetSkinningMatrices();
+            const AZ::Vector3* positions = static_cast<const AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            const AZ::Vector3* skinnedNormals = static_cast<const AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+            for (AZ::u32 v = 0; v < numVertices; ++v)
+            {
+                AZ::Vector3 expectedPosition = AZ::Vector3::CreateZero();
+                AZ::Vector3 expectedNormal = AZ::Vector3::CreateZero();
+                for (const auto& [nodeNr, weight] : skinningInfo[v])
+                {
+                    expectedPosition += weight * (skinningMatrices[nodeNr] * vertices[v]);
+                    expectedNormal += weight * skinningMatrices[nodeNr].TransformVector(normals[v]);
+                }
+
+                EXPECT_THAT(positions[v], IsClose(expectedPosition));
+                EXPECT_THAT(skinnedNormals[v], IsClose(expectedNormal));
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+    };
+
+    TEST_F(SoftSkinDeformerFixture, BakedInfluencesMatchReference)
+    {
+        SkinAndCompare(/*numVertices=*/60, SoftSkinDeformer::s_maxBakedInfluences, /*expectBakedInfluences=*/true);
+    }
+
+    TEST_F(SoftSkinDeformerFixture, TooManyInfluencesFallBackToSkinningLayer)
+    {
+        SkinAndCompare(/*numVertices=*/60, SoftSkinDeformer::s_maxBakedInfluences + 1, /*expectBakedInfluences=*/false);
+    }
+
+    TEST_F(SoftSkinDeformerFixture, LargeMeshSkinnedInBatches)
+    {
+        SkinAndCompare(/*numVertices=*/24000, SoftSkinDeformer::s_maxBakedInfluences, /*expectBakedInfluences=*/true);
+    }
+} // namespace EMotionFX
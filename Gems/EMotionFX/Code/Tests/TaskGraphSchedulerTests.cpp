@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/AttachmentNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/TaskGraphScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class TaskGraphSchedulerFixture
+        : public SystemComponentFixture
+    {
+    public:
+        static constexpr size_t s_numJoints = 10;
+
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_scheduler = TaskGraphScheduler::Create();
+            GetActorManager().SetScheduler(m_scheduler);
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(s_numJoints);
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+
+            SystemComponentFixture::TearDown();
+        }
+
+        ActorInstance* CreateActorInstance()
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+            m_actorInstances.emplace_back(actorInstance);
+            return actorInstance;
+        }
+
+        ActorInstance* CreateAttachment(ActorInstance* attachTo)
+        {
+            ActorInstance* attachment = CreateActorInstance();
+            attachTo->AddAttachment(AttachmentNode::Create(attachTo, /*attachToNodeIndex=*/s_numJoints - 1, attachment));
+            return attachment;
+        }
+
+        size_t FindBatch(const ActorInstance* actorInstance) const
+        {
+            for (size_t i = 0; i < m_scheduler->GetNumBatches(); ++i)
+            {
+                const AZStd::vector<ActorInstance*>& actorInstances = m_scheduler->GetBatch(i).m_actorInstances;
+                if (AZStd::find(actorInstances.begin(), actorInstances.end(), actorInstance) != actorInstances.end())
+                {
+                    return i;
+                }
+            }
+            return InvalidIndex;
+        }
+
+    protected:
+        TaskGraphScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<SimpleJointChainActor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    TEST_F(TaskGraphSchedulerFixture, SmallActorInstancesShareBatches)
+    {
+        // Each hierarchy has three actor instances. The attachments have fewer joints than the minimum and stay in the batch of their parent,
+        // after which one more hierarchy is needed to reach the minimum number of joints of a batch.
+        m_scheduler->SetMinBatchNumJoints(4 * s_numJoints);
+        for (size_t i = 0; i < 6; ++i)
+        {
+            ActorInstance* actorInstance = CreateActorInstance();
+            CreateAttachment(CreateAttachment(actorInstance));
+        }
+
+        m_scheduler->UpdateTaskGraph();
+        ASSERT_EQ(m_scheduler->GetNumBatches(), 3);
+        for (size_t i = 0; i < m_scheduler->GetNumBatches(); ++i)
+        {
+            EXPECT_EQ(m_scheduler->GetBatch(i).m_parentBatch, InvalidIndex);
+        }
+
+        // Attachments have to be updated after the actor instance they are attached to.
+        for (const ActorInstance* actorInstance : m_actorInstances)
+        {
+            const ActorInstance* attachedTo = actorInstance->GetAttachedTo();
+            if (attachedTo)
+            {
+                const size_t batchIndex = FindBatch(actorInstance);
+                ASSERT_EQ(batchIndex, FindBatch(attachedTo));
+                const AZStd::vector<ActorInstance*>& actorInstances = m_scheduler->GetBatch(batchIndex).m_actorInstances;
+                EXPECT_LT(AZStd::find(actorInstances.begin(), actorInstances.end(), attachedTo), AZStd::find(actorInstances.begin(), actorInstances.end(), actorInstance));
+            }
+        }
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), m_actorInstances.size());
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, LargeAttachmentsFollowTheirParentBatch)
+    {
+        m_scheduler->SetMinBatchNumJoints(0);
+        ActorInstance* actorInstance = CreateActorInstance();
+        ActorInstance* attachment = CreateAttachment(actorInstance);
+        ActorInstance* otherActorInstance = CreateActorInstance();
+
+        m_scheduler->UpdateTaskGraph();
+        ASSERT_EQ(m_scheduler->GetNumBatches(), 3);
+        const size_t parentBatch = FindBatch(actorInstance);
+        const size_t attachmentBatch = FindBatch(attachment);
+        ASSERT_NE(parentBatch, InvalidIndex);
+        ASSERT_NE(attachmentBatch, InvalidIndex);
+        EXPECT_EQ(m_scheduler->GetBatch(attachmentBatch).m_parentBatch, parentBatch);
+        EXPECT_EQ(m_scheduler->GetBatch(parentBatch).m_parentBatch, InvalidIndex);
+        EXPECT_EQ(m_scheduler->GetBatch(FindBatch(otherActorInstance)).m_parentBatch, InvalidIndex);
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 3);
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, RemovedActorInstancesRebuildTheGraph)
+    {
+        m_scheduler->SetMinBatchNumJoints(0);
+        CreateActorInstance();
+        CreateActorInstance();
+        m_scheduler->UpdateTaskGraph();
+        EXPECT_EQ(m_scheduler->GetNumBatches(), 2);
+
+        m_actorInstances.back()->Destroy();
+        m_actorInstances.pop_back();
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumBatches(), 1);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 1);
+    }
+} // namespace EMotionFX
@@ -12,6 +12,7 @@ set(FILES
     Tests/ActorFixture.cpp
     Tests/ActorFixture.h
     Tests/ActorInstanceCommandTests.cpp
+    Tests/ActorUpdateRateTests.cpp
     Tests/AdditiveMotionSamplingTests.cpp
     Tests/AnimAudioComponentTests.cpp
     Tests/AnimGraphActionTests.cpp
@@ -75,8 +76,10 @@ set(FILES
     Tests/BlendTreeSimulatedObjectNodeTests.cpp
     Tests/BlendTreeTransformNodeTests.cpp
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
+    Tests/Benchmarks/MotionDataBenchmarks.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedMotionDataTests.cpp
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -108,9 +111,11 @@ set(FILES
     Tests/SimulatedObjectSerializeTests.cpp
     Tests/SkeletalLODTests.cpp
     Tests/SkeletonNodeSearchTests.cpp
+    Tests/SoftSkinDeformerTests.cpp
     Tests/SyncingSystemTests.cpp
     Tests/SystemComponentFixture.h
     Tests/SystemComponentTests.cpp
+    Tests/TaskGraphSchedulerTests.cpp
     Tests/TransformUnitTests.cpp
     Tests/Vector2ToVector3CompatibilityTests.cpp
     Tests/Vector3ParameterTests.cpp
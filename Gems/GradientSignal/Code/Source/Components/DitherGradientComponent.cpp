@@ -222,29 +222,61 @@ namespace GradientSignal
         return indexMatrix[patternSize * y + x] / static_cast<float>(patternSizeSq);
     }
 
+    AZ::Vector3 GetFlooredCoordinate(const AZ::Vector3& scaledCoordinate, float pointsPerUnit)
+    {
+        auto x = std::floor(scaledCoordinate.GetX()) / pointsPerUnit;
+        auto y = std::floor(scaledCoordinate.GetY()) / pointsPerUnit;
+        auto z = std::floor(scaledCoordinate.GetZ()) / pointsPerUnit;
+        return AZ::Vector3(x, y, z);
+    }
+
     float DitherGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        const AZ::Vector3& coordinate = sampleParams.m_position;
+        const float pointsPerUnit = GetCalculatedPointsPerUnit();
+        const AZ::Vector3 scaledCoordinate = sampleParams.m_position * pointsPerUnit;
+
+        GradientSampleParams adjustedSampleParams = sampleParams;
+        adjustedSampleParams.m_position = GetFlooredCoordinate(scaledCoordinate, pointsPerUnit);
+        float value = m_configuration.m_gradientSampler.GetValue(adjustedSampleParams);
 
+        return GetDitheredValue(scaledCoordinate, value);
+    }
+
+    void DitherGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const float pointsPerUnit = GetCalculatedPointsPerUnit();
+
+        AZStd::vector<AZ::Vector3> flooredCoordinates;
+        flooredCoordinates.reserve(positions.size());
+        for (const AZ::Vector3& position : positions)
+        {
+            flooredCoordinates.emplace_back(GetFlooredCoordinate(position * pointsPerUnit, pointsPerUnit));
+        }
+
+        m_configuration.m_gradientSampler.GetValues(flooredCoordinates, outValues);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            outValues[index] = GetDitheredValue(positions[index] * pointsPerUnit, outValues[index]);
+        }
+    }
+
+    float DitherGradientComponent::GetCalculatedPointsPerUnit() const
+    {
         float pointsPerUnit = m_configuration.m_pointsPerUnit;
         if (m_configuration.m_useSystemPointsPerUnit)
         {
             SectorDataRequestBus::Broadcast(&SectorDataRequestBus::Events::GetPointsPerMeter, pointsPerUnit);
         }
-        pointsPerUnit = AZ::GetMax(pointsPerUnit, 0.0001f);
-
-        auto scaledCoordinate = coordinate * pointsPerUnit;
-        auto x = std::floor(scaledCoordinate.GetX()) / pointsPerUnit;
-        auto y = std::floor(scaledCoordinate.GetY()) / pointsPerUnit;
-        auto z = std::floor(scaledCoordinate.GetZ()) / pointsPerUnit;
-        AZ::Vector3 flooredCoordinate(x, y, z);
-
-        GradientSampleParams adjustedSampleParams = sampleParams;
-        adjustedSampleParams.m_position = flooredCoordinate;
-        float value = m_configuration.m_gradientSampler.GetValue(adjustedSampleParams);
+        return AZ::GetMax(pointsPerUnit, 0.0001f);
+    }
 
+    float DitherGradientComponent::GetDitheredValue(const AZ::Vector3& scaledCoordinate, float value) const
+    {
         float d = 0.0f;
         switch (m_configuration.m_patternType)
         {
@@ -77,6 +77,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
         //////////////////////////////////////////////////////////////////////////
@@ -102,6 +103,10 @@ namespace GradientSignal
         GradientSampler& GetGradientSampler() override;
 
     private:
+        //! Get the points per unit used for dithering, which might come from the sector data
+        float GetCalculatedPointsPerUnit() const;
+        float GetDitheredValue(const AZ::Vector3& scaledCoordinate, float value) const;
+
         DitherGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
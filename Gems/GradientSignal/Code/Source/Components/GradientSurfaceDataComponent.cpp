@@ -224,9 +224,15 @@ namespace GradientSignal
                 validShapeBounds = m_cachedShapeConstraintBounds.IsValid();
             }
 
+            // Gather all of the points that are within our allowed shape bounds, so that the gradient can be queried for all of them at once.
             const AZ::EntityId entityId = GetEntityId();
-            for (auto& point : surfacePointList)
+            AZStd::vector<size_t> pointIndices;
+            AZStd::vector<AZ::Vector3> positions;
+            pointIndices.reserve(surfacePointList.size());
+            positions.reserve(surfacePointList.size());
+            for (size_t pointIndex = 0; pointIndex < surfacePointList.size(); ++pointIndex)
             {
+                const auto& point = surfacePointList[pointIndex];
                 if (point.m_entityId != entityId)
                 {
                     bool inBounds = true;
@@ -243,19 +249,24 @@ namespace GradientSignal
                         }
                     }
 
-                    // If the point is within our allowed shape bounds, verify that it meets the gradient thresholds.
-                    // If so, then add the value to the surface tags.
                     if (inBounds)
                     {
-                        const GradientSampleParams sampleParams = { point.m_position };
-                        const float value = m_gradientSampler.GetValue(sampleParams);
-                        if (value >= m_configuration.m_thresholdMin &&
-                            value <= m_configuration.m_thresholdMax)
-                        {
-                            SurfaceData::AddMaxValueForMasks(point.m_masks, m_configuration.m_modifierTags, value);
-                        }
+                        pointIndices.emplace_back(pointIndex);
+                        positions.emplace_back(point.m_position);
                     }
+                }
+            }
 
+            // Verify that the points meet the gradient thresholds. If so, then add the value to the surface tags.
+            AZStd::vector<float> values(positions.size());
+            m_gradientSampler.GetValues(positions, values);
+            for (size_t index = 0; index < pointIndices.size(); ++index)
+            {
+                const float value = values[index];
+                if (value >= m_configuration.m_thresholdMin &&
+                    value <= m_configuration.m_thresholdMax)
+                {
+                    SurfaceData::AddMaxValueForMasks(surfacePointList[pointIndices[index]].m_masks, m_configuration.m_modifierTags, value);
                 }
             }
         }
@@ -149,9 +149,24 @@ namespace GradientSignal
     }
 
     float PosterizeGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
+    {
+        return GetPosterizedValue(m_configuration.m_gradientSampler.GetValue(sampleParams));
+    }
+
+    void PosterizeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+
+        for (float& output : outValues)
+        {
+            output = GetPosterizedValue(output);
+        }
+    }
+
+    float PosterizeGradientComponent::GetPosterizedValue(float value) const
     {
         const float bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f);
-        const float input = AZ::GetClamp(m_configuration.m_gradientSampler.GetValue(sampleParams), 0.0f, 1.0f);
+        const float input = AZ::GetClamp(value, 0.0f, 1.0f);
         float output = 0.0f;
 
         // "quantize" the input down to a number that goes from 0 to (bands-1)
@@ -61,8 +61,11 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
 
     private:
+        float GetRandomValue(const AZ::Vector3& uvw) const;
+
         RandomGradientConfig m_configuration;
 
         /////////////////////////////////////////////////////////////////////////
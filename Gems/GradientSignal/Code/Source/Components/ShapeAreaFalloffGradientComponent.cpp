@@ -162,6 +162,36 @@ namespace GradientSignal
         float distance = 0.0f;
         LmbrCentral::ShapeComponentRequestsBus::EventResult(distance, m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceFromPoint, sampleParams.m_position);
 
+        return GetFalloffValue(distance);
+    }
+
+    void ShapeAreaFalloffGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(positions.size() == outValues.size(), "The positions and outValues lists are expected to have the same size.");
+
+        // Points are treated as being at distance 0 when there is no shape, just like in GetValue
+        AZStd::vector<float> distances(positions.size(), 0.0f);
+
+        // Query all of the distances with a single dispatch instead of one per position
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            m_configuration.m_shapeEntityId,
+            [&positions, &distances](LmbrCentral::ShapeComponentRequests* shapeRequests)
+            {
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    distances[index] = shapeRequests->DistanceFromPoint(positions[index]);
+                }
+            });
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            outValues[index] = GetFalloffValue(distances[index]);
+        }
+    }
+
+    float ShapeAreaFalloffGradientComponent::GetFalloffValue(float distance) const
+    {
         // In the special case of 0 falloff, make sure that all points inside the shape (0 distance) return 
         // 1.0, and all points outside the shape return 0.
         if (m_configuration.m_falloffWidth == 0.0f)
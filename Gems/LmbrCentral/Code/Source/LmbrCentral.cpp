@@ -8,6 +8,7 @@
 #include "LmbrCentral.h"
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/IO/FileIO.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/std/containers/list.h>
@@ -85,6 +86,8 @@
 namespace LmbrCentral
 {
     static const char* s_assetCatalogFilename = "assetcatalog.xml";
+    // Written next to the catalog by the Asset Processor when its AssetCatalog/writeCatalogImage setting is enabled.
+    static const char* s_assetCatalogImageFilename = "assetcatalog.image";
 
     using LmbrCentralAllocatorScope = AZ::AllocatorScope<AZ::LegacyAllocator>;
 
@@ -483,8 +486,13 @@ namespace LmbrCentral
             }
         }
 
-        // load the catalog from disk (supported over VFS).
-        EBUS_EVENT(AZ::Data::AssetCatalogRequestBus, LoadCatalog, AZStd::string::format("@assets@/%s", s_assetCatalogFilename).c_str());
+        // load the catalog from disk (supported over VFS), preferring the catalog image since it's queried in place.
+        AZStd::string catalogFile = AZStd::string::format("@assets@/%s", s_assetCatalogImageFilename);
+        if (!AZ::IO::FileIOBase::GetInstance() || !AZ::IO::FileIOBase::GetInstance()->Exists(catalogFile.c_str()))
+        {
+            catalogFile = AZStd::string::format("@assets@/%s", s_assetCatalogFilename);
+        }
+        EBUS_EVENT(AZ::Data::AssetCatalogRequestBus, LoadCatalog, catalogFile.c_str());
     }
 
     void LmbrCentralSystemComponent::OnCrySystemShutdown([[maybe_unused]] ISystem& system)
@@ -13,6 +13,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
@@ -133,6 +134,18 @@ namespace Multiplayer
         bool SerializeEntityCorrection(AzNetworking::ISerializer& serializer);
 
         bool SerializeStateDeltaMessage(ReplicationRecord& replicationRecord, AzNetworking::ISerializer& serializer);
+
+        //! Serializes the state delta for the provided replication record, sharing the serialized payload between connections.
+        //! Connections that observe this entity with an identical replication record within the same host frame reuse the
+        //! bits written by the first connection instead of serializing the network properties again.
+        //! Payloads are only shared between serializers that pack values the same way, so bit packed and byte aligned connections
+        //! each get their own copy.
+        //! This may be called concurrently by multiple connections generating their entity updates.
+        //! @param replicationRecord the replication record describing the network properties to serialize
+        //! @param serializer        the input serializer to append the state delta to
+        //! @return boolean true on success
+        bool SerializeCachedStateDeltaMessage(ReplicationRecord& replicationRecord, AzNetworking::ISerializer& serializer);
+
         void NotifyStateDeltaChanges(ReplicationRecord& replicationRecord);
 
         void FillReplicationRecord(ReplicationRecord& replicationRecord) const;
@@ -151,6 +164,7 @@ namespace Multiplayer
         void NetworkAttach();
 
         void HandleMarkedDirty();
+        void InvalidateStateDeltaCache();
         void HandleLocalServerRpcMessage(NetworkEntityRpcMessage& message);
 
         void DetermineInputOrdering();
@@ -161,6 +175,20 @@ namespace Multiplayer
         ReplicationRecord m_totalRecord = NetEntityRole::InvalidRole;
         ReplicationRecord m_predictableRecord = NetEntityRole::Autonomous;
         ReplicationRecord m_localNotificationRecord = NetEntityRole::InvalidRole;
+
+        //! State deltas serialized during the current host frame, shared by all connections replicating this entity
+        struct CachedStateDelta
+        {
+            ReplicationRecord m_replicationRecord;
+            AZStd::vector<uint8_t> m_serializedDelta;
+            uint32_t m_serializedDeltaBits = 0;
+            bool m_bitPacked = false;
+        };
+        AZStd::vector<CachedStateDelta> m_cachedStateDeltas;
+        uint32_t m_cachedStateDeltaCount = 0;
+        HostFrameId m_cachedStateDeltaFrameId = InvalidHostFrameId;
+        AZStd::mutex m_cachedStateDeltaMutex;
+
         PrefabEntityId    m_prefabEntityId;
         AZStd::unordered_map<NetComponentId, MultiplayerComponent*> m_multiplayerComponentMap;
         AZStd::vector<MultiplayerComponent*> m_multiplayerSerializationComponentVector;
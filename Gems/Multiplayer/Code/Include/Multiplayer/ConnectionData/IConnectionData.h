@@ -43,6 +43,11 @@ namespace Multiplayer
         //! @param hostTimeMs current server game time in milliseconds
         virtual void Update(AZ::TimeMs hostTimeMs) = 0;
 
+        //! Performs the main thread portion of an update, such as activating pending entities.
+        //! Used when connection updates are multithreaded, the caller is then responsible for generating and sending updates through the replication manager.
+        //! @return true if the replication manager should generate and send updates to the remote endpoint
+        virtual bool PrepareUpdate() = 0;
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
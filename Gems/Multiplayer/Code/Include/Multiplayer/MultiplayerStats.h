@@ -11,6 +11,7 @@
 #include <AzCore/Time/ITime.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace AzNetworking
@@ -93,5 +94,12 @@ namespace Multiplayer
         };
 
         void ConnectHandlers(EventHandlers& handlers);
+
+        //! Returns true if any handlers are bound to the entity serialization events.
+        //! These handlers expect serialization to occur on a single thread, so connection updates will not be multithreaded while they are bound.
+        bool HasSerializeEventHandlers() const;
+
+        //! Guards the sent property metrics, which may be recorded by multiple connections serializing entity updates concurrently.
+        AZStd::mutex m_propertySentMutex;
     };
 }
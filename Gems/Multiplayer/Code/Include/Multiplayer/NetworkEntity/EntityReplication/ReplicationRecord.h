@@ -55,6 +55,10 @@ namespace Multiplayer
         void Subtract(const ReplicationRecord &rhs);
         bool HasChanges() const;
 
+        //! Returns true if both records target the same remote role and have the same bits set.
+        //! Consumed bit counts and the sent packet id are not compared.
+        bool HasSameChanges(const ReplicationRecord &rhs) const;
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         void ConsumeAuthorityToClientBits(uint32_t consumedBits);
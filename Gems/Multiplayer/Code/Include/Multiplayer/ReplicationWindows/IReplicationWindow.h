@@ -31,6 +31,8 @@ namespace Multiplayer
         virtual const ReplicationSet& GetReplicationSet() const = 0;
         //! Max number of entities we can send updates for in one frame
         virtual uint32_t GetMaxProxyEntityReplicatorSendCount() const = 0;
+        //! Max number of bytes per second we can spend on entity updates, 0 if updates are not bandwidth limited
+        virtual uint32_t GetMaxBytesPerSecond() const = 0;
         virtual bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const = 0;
         virtual void UpdateWindow() = 0;
         virtual void DebugDraw() const = 0;
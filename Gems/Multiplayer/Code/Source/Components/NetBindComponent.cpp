@@ -23,6 +23,9 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR(uint32_t, net_EntityStateDeltaCacheMaxRecords, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of distinct replication records per entity whose serialized state delta is shared between connections each host frame, 0 disables sharing");
+
     void NetBindComponent::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
@@ -490,6 +493,69 @@ namespace Multiplayer
         return success;
     }
 
+    bool NetBindComponent::SerializeCachedStateDeltaMessage(ReplicationRecord& replicationRecord, AzNetworking::ISerializer& serializer)
+    {
+        // The per entity serialization events expect every connection to serialize the entity, so don't share payloads while they are bound
+        INetworkTime* networkTime = GetNetworkTime();
+        if ((net_EntityStateDeltaCacheMaxRecords == 0) || (networkTime == nullptr) || GetMultiplayer()->GetStats().HasSerializeEventHandlers()
+            || (serializer.GetSerializerMode() != AzNetworking::SerializerMode::ReadFromObject))
+        {
+            return SerializeStateDeltaMessage(replicationRecord, serializer);
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_cachedStateDeltaMutex);
+
+        const HostFrameId hostFrameId = networkTime->GetHostFrameId();
+        if (m_cachedStateDeltaFrameId != hostFrameId)
+        {
+            m_cachedStateDeltaCount = 0;
+            m_cachedStateDeltaFrameId = hostFrameId;
+        }
+
+        const bool bitPacked = serializer.IsBitPacked();
+        for (uint32_t i = 0; i < m_cachedStateDeltaCount; ++i)
+        {
+            const CachedStateDelta& cachedStateDelta = m_cachedStateDeltas[i];
+            if ((cachedStateDelta.m_bitPacked == bitPacked) && cachedStateDelta.m_replicationRecord.HasSameChanges(replicationRecord))
+            {
+                return serializer.CopyBitsToBuffer(cachedStateDelta.m_serializedDelta.data(), cachedStateDelta.m_serializedDeltaBits);
+            }
+        }
+
+        // Serializing from the object never modifies the record, so the bits written are only a function of the record and the current entity state
+        const uint32_t startBit = serializer.GetSizeInBits();
+        const bool success = SerializeStateDeltaMessage(replicationRecord, serializer);
+        if (!success || !serializer.IsValid() || (m_cachedStateDeltaCount >= net_EntityStateDeltaCacheMaxRecords))
+        {
+            return success;
+        }
+
+        if (m_cachedStateDeltaCount >= m_cachedStateDeltas.size())
+        {
+            m_cachedStateDeltas.emplace_back();
+        }
+        CachedStateDelta& cachedStateDelta = m_cachedStateDeltas[m_cachedStateDeltaCount++];
+        cachedStateDelta.m_replicationRecord = replicationRecord;
+        cachedStateDelta.m_bitPacked = bitPacked;
+        cachedStateDelta.m_serializedDeltaBits = serializer.GetSizeInBits() - startBit;
+
+        // Store the delta starting at the first bit of the cached buffer, the serializer may not have been byte aligned when it started
+        const uint8_t* buffer = serializer.GetBuffer();
+        cachedStateDelta.m_serializedDelta.clear();
+        for (uint32_t bit = startBit; bit < startBit + cachedStateDelta.m_serializedDeltaBits; bit += 8)
+        {
+            const uint32_t byteIndex = bit >> 3;
+            const uint32_t bitOffset = bit & 7;
+            uint32_t bits = buffer[byteIndex] >> bitOffset;
+            if ((bitOffset != 0) && (bit + 8 - bitOffset < startBit + cachedStateDelta.m_serializedDeltaBits))
+            {
+                bits |= static_cast<uint32_t>(buffer[byteIndex + 1]) << (8 - bitOffset);
+            }
+            cachedStateDelta.m_serializedDelta.push_back(static_cast<uint8_t>(bits));
+        }
+        return success;
+    }
+
     void NetBindComponent::NotifyStateDeltaChanges(ReplicationRecord& replicationRecord)
     {
         for (auto iter = m_multiplayerSerializationComponentVector.begin(); iter != m_multiplayerSerializationComponentVector.end(); ++iter)
@@ -653,6 +719,7 @@ namespace Multiplayer
 
     void NetBindComponent::HandleMarkedDirty()
     {
+        InvalidateStateDeltaCache();
         m_dirtiedEvent.Signal();
         if (NetworkRoleHasController(GetNetEntityRole()))
         {
@@ -666,6 +733,14 @@ namespace Multiplayer
         m_currentRecord.Clear();
     }
 
+    void NetBindComponent::InvalidateStateDeltaCache()
+    {
+        // Network properties have changed since the cached deltas were serialized
+        AZStd::scoped_lock<AZStd::mutex> lock(m_cachedStateDeltaMutex);
+        m_cachedStateDeltaCount = 0;
+        m_cachedStateDeltaFrameId = InvalidHostFrameId;
+    }
+
     void NetBindComponent::HandleLocalServerRpcMessage(NetworkEntityRpcMessage& message)
     {
         message.SetRpcDeliveryType(RpcDeliveryType::ServerToAuthority);
@@ -67,6 +67,14 @@ namespace Multiplayer
     }
 
     void ServerToClientConnectionData::Update(AZ::TimeMs hostTimeMs)
+    {
+        if (PrepareUpdate())
+        {
+            m_entityReplicationManager.SendUpdates(hostTimeMs);
+        }
+    }
+
+    bool ServerToClientConnectionData::PrepareUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
 
@@ -74,11 +82,9 @@ namespace Multiplayer
         {
             NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
-            if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
-            {
-                m_entityReplicationManager.SendUpdates(hostTimeMs);
-            }
+            return (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority));
         }
+        return false;
     }
 
     void ServerToClientConnectionData::OnControlledEntityRemove()
@@ -46,6 +46,7 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_propertySentMutex);
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
@@ -220,4 +221,12 @@ namespace Multiplayer
         handlers.m_rpcSent.Connect(m_events.m_rpcSent);
         handlers.m_rpcReceived.Connect(m_events.m_rpcReceived);
     }
+
+    bool MultiplayerStats::HasSerializeEventHandlers() const
+    {
+        return m_events.m_entitySerializeStart.HasHandlerConnected()
+            || m_events.m_componentSerializeEnd.HasHandlerConnected()
+            || m_events.m_entitySerializeStop.HasHandlerConnected()
+            || m_events.m_propertySent.HasHandlerConnected();
+    }
 }
@@ -27,6 +27,7 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Session/ISessionRequests.h>
 #include <AzFramework/Session/SessionConfig.h>
@@ -83,6 +84,8 @@ namespace Multiplayer
     AZ_CVAR(AZ::TimeMs, cl_defaultNetworkEntityActivationTimeSliceMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "Max Ms to use to activate entities coming from the network, 0 means instantiate everything");
     AZ_CVAR(AZ::TimeMs, sv_serverSendRateMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of milliseconds between each network update");
+    AZ_CVAR(bool, sv_multithreadedConnectionUpdates, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, entity updates for each connection are serialized in parallel using the task graph, only the sends themselves remain on the main thread");
+    AZ_CVAR(uint32_t, sv_minConnectionsForMultithreadedUpdates, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "The minimum number of connections that need to send updates before connection updates are multithreaded");
     AZ_CVAR(AZ::CVarFixedString, sv_defaultPlayerSpawnAsset, "prefabs/player.network.spawnable", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "The default spawnable to use when a new player connects");
     AZ_CVAR(float, cl_renderTickBlendBase, 0.15f, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -348,12 +351,16 @@ namespace Multiplayer
 
         // Send out the game state update to all connections
         {
-            auto sendNetworkUpdates = [hostTimeMs, &stats](IConnection& connection)
+            m_connectionsPendingUpdate.clear();
+            auto prepareNetworkUpdates = [this, &stats](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
                 {
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
-                    connectionData->Update(hostTimeMs);
+                    if (connectionData->PrepareUpdate())
+                    {
+                        m_connectionsPendingUpdate.push_back(connectionData);
+                    }
                     if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
                     {
                         stats.m_clientConnectionCount++;
@@ -365,7 +372,8 @@ namespace Multiplayer
                 }
             };
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            m_networkInterface->GetConnectionSet().VisitConnections(prepareNetworkUpdates);
+            SendConnectionUpdates(hostTimeMs);
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -397,6 +405,50 @@ namespace Multiplayer
         }
     }
 
+    void MultiplayerSystemComponent::SendConnectionUpdates(AZ::TimeMs hostTimeMs)
+    {
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool multithreaded = sv_multithreadedConnectionUpdates
+            && (m_connectionsPendingUpdate.size() >= sv_minConnectionsForMultithreadedUpdates)
+            && (taskGraphActiveInterface != nullptr) && taskGraphActiveInterface->IsTaskGraphActive()
+            && !GetStats().HasSerializeEventHandlers();
+
+        if (multithreaded)
+        {
+            // Each replication manager only touches its own connection's replicators while serializing,
+            // so update generation can run in parallel and we only need to serialize the actual sends
+            static const AZ::TaskDescriptor generateUpdatesTaskDescriptor{ "MultiplayerSystemComponent::GenerateUpdates", "Multiplayer" };
+            AZ::TaskGraph taskGraph;
+            for (IConnectionData* connectionData : m_connectionsPendingUpdate)
+            {
+                taskGraph.AddTask(generateUpdatesTaskDescriptor, [connectionData, hostTimeMs]()
+                {
+                    connectionData->GetReplicationManager().GenerateUpdates(hostTimeMs);
+                });
+            }
+
+            AZ::TaskGraphEvent finishedEvent;
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            for (IConnectionData* connectionData : m_connectionsPendingUpdate)
+            {
+                connectionData->GetReplicationManager().GenerateUpdates(hostTimeMs);
+            }
+        }
+
+        // Coalesce the sends for every connection so the transport can flush them with as few system calls as possible
+        m_networkInterface->BeginSendBatch();
+        for (IConnectionData* connectionData : m_connectionsPendingUpdate)
+        {
+            connectionData->GetReplicationManager().SendGeneratedUpdates();
+        }
+        m_networkInterface->EndSendBatch();
+        m_connectionsPendingUpdate.clear();
+    }
+
     int MultiplayerSystemComponent::GetTickOrder()
     {
         // Tick immediately after the network system component
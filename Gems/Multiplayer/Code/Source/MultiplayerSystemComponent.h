@@ -37,6 +37,8 @@ namespace AzNetworking
 
 namespace Multiplayer
 {
+    class IConnectionData;
+
     //! Multiplayer system component wraps the bridging logic between the game and transport layer.
     class MultiplayerSystemComponent final
         : public AZ::Component
@@ -129,6 +131,7 @@ namespace Multiplayer
     private:
 
         void TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds);
+        void SendConnectionUpdates(AZ::TimeMs hostTimeMs);
         void OnConsoleCommandInvoked(AZStd::string_view command, const AZ::ConsoleCommandContainer& args, AZ::ConsoleFunctorFlags flags, AZ::ConsoleInvokedFrom invokedFrom);
         void ExecuteConsoleCommandList(AzNetworking::IConnection* connection, const AZStd::fixed_vector<Multiplayer::LongNetworkString, 32>& commands);
         NetworkEntityHandle SpawnDefaultPlayerPrefab();
@@ -153,6 +156,9 @@ namespace Multiplayer
 
         AZStd::queue<AZStd::string> m_pendingConnectionTickets;
 
+        //! Connections that are ready to generate and send updates this tick
+        AZStd::vector<IConnectionData*> m_connectionsPendingUpdate;
+
         AZ::TimeMs m_lastReplicatedHostTimeMs = AZ::TimeMs{ 0 };
         HostFrameId m_lastReplicatedHostFrameId = HostFrameId(0);
 
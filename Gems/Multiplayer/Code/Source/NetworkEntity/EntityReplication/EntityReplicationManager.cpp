@@ -21,6 +21,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Serialization/TrackChangedSerializer.h>
@@ -37,6 +38,7 @@ namespace Multiplayer
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
+    AZ_CVAR(AZ::TimeMs, sv_ReplicationBudgetMaxBurstMs, AZ::TimeMs{ 250 }, nullptr, AZ::ConsoleFunctorFlags::Null, "The max amount of unused replication bandwidth, in milliseconds, a connection may bank for later updates");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -49,6 +51,7 @@ namespace Multiplayer
     {
         // Our max payload size is whatever is passed in, minus room for a udp packetheader
         m_maxPayloadSize = connection.GetConnectionMtu() - UdpPacketHeaderSerializeSize - ReplicationManagerPacketOverhead;
+        m_replicationScheduler = EntityReplicationScheduler(m_maxPayloadSize);
 
         // Schedule ClearRemovedReplicators()
         m_clearRemovedReplicators.Enqueue(AZ::TimeMs{ 0 }, true);
@@ -108,9 +111,22 @@ namespace Multiplayer
     }
 
     void EntityReplicationManager::SendUpdates(AZ::TimeMs hostTimeMs)
+    {
+        GenerateUpdates(hostTimeMs);
+        SendGeneratedUpdates();
+    }
+
+    void EntityReplicationManager::GenerateUpdates(AZ::TimeMs hostTimeMs)
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
-        SendEntityUpdates(hostTimeMs);
+        m_pendingUpdatesHostTimeMs = hostTimeMs;
+        m_pendingUpdatesHostFrameId = GetNetworkTime()->GetHostFrameId();
+        GenerateEntityUpdates();
+    }
+
+    void EntityReplicationManager::SendGeneratedUpdates()
+    {
+        SendEntityUpdates();
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
         SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
@@ -130,19 +146,14 @@ namespace Multiplayer
         );
     }
 
-    void EntityReplicationManager::SendEntityUpdatesPacketHelper
+    void EntityReplicationManager::GenerateEntityUpdatesPacketHelper
     (
-        AZ::TimeMs hostTimeMs,
         EntityReplicatorList& toSendList,
         uint32_t maxPayloadSize,
-        AzNetworking::IConnection& connection
+        PendingEntityUpdates& outPendingUpdates
     )
     {
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
-        MultiplayerPackets::EntityUpdates entityUpdatePacket;
-        entityUpdatePacket.SetHostTimeMs(hostTimeMs);
-        entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
         // Serialize everything
         while (!toSendList.empty())
         {
@@ -153,17 +164,18 @@ namespace Multiplayer
 
             // Check if we are over our limits
             const bool payloadFull = (pendingPacketSize + nextMessageSize > maxPayloadSize);
-            const bool capacityReached = (entityUpdatePacket.GetEntityMessages().size() >= entityUpdatePacket.GetEntityMessages().capacity());
-            const bool largeEntityDetected = (payloadFull && replicatorUpdatedList.empty());
+            const bool capacityReached = (outPendingUpdates.m_entityMessages.size() >= MaxAggregateEntityMessages);
+            const bool largeEntityDetected = (payloadFull && outPendingUpdates.m_replicators.empty());
             if (capacityReached || (payloadFull && !largeEntityDetected))
             {
                 break;
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdatePacket.ModifyEntityMessages().push_back(updateMessage);
-            replicatorUpdatedList.push_back(replicator);
+            outPendingUpdates.m_entityMessages.push_back(AZStd::move(updateMessage));
+            outPendingUpdates.m_replicators.push_back(replicator);
             toSendList.pop_front();
+            m_replicationScheduler.OnEntitySent(replicator->GetEntityHandle().GetNetEntityId(), nextMessageSize);
 
             if (largeEntityDetected)
             {
@@ -179,17 +191,9 @@ namespace Multiplayer
                 break;
             }
         }
-
-        const AzNetworking::PacketId sentId = connection.SendUnreliablePacket(entityUpdatePacket);
-
-        // Update the sent things with the packet id
-        for (EntityReplicator* replicator : replicatorUpdatedList)
-        {
-            replicator->GetPropertyPublisher()->FinalizeSerialization(sentId);
-        }
     }
 
-    EntityReplicationManager::EntityReplicatorList EntityReplicationManager::GenerateEntityUpdateList()
+    EntityReplicationManager::EntityReplicatorList EntityReplicationManager::GenerateEntityUpdateList(AZ::TimeMs deltaTimeMs)
     {
         if (m_replicationWindow == nullptr)
         {
@@ -199,7 +203,6 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
-        uint32_t proxySendCount = 0;
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -237,10 +240,10 @@ namespace Multiplayer
                         {
                             toSendList.push_back(replicator);
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else
                         {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
+                            // Proxies are prioritized below, anything not selected stays pending and accumulates priority
+                            m_replicationScheduler.AddCandidate(entityId, deltaTimeMs);
                         }
                     }
                 }
@@ -257,12 +260,32 @@ namespace Multiplayer
             }
         }
 
+        m_scheduledEntities.clear();
+        m_replicationScheduler.SelectCandidates(m_replicationWindow->GetMaxProxyEntityReplicatorSendCount(), m_scheduledEntities);
+        for (NetEntityId entityId : m_scheduledEntities)
+        {
+            toSendList.push_back(GetEntityReplicator(entityId));
+        }
+
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdates(AZ::TimeMs hostTimeMs)
+    void EntityReplicationManager::GenerateEntityUpdates()
     {
-        EntityReplicatorList toSendList = GenerateEntityUpdateList();
+        const AZ::TimeMs deltaTimeMs = (m_lastEntityUpdateTimeMs > AZ::TimeMs{ 0 }) ? (m_frameTimeMs - m_lastEntityUpdateTimeMs) : AZ::TimeMs{ 0 };
+        m_lastEntityUpdateTimeMs = m_frameTimeMs;
+
+        uint32_t maxBytesPerSecond = (m_replicationWindow != nullptr) ? m_replicationWindow->GetMaxBytesPerSecond() : 0;
+
+        // If the connection runs congestion control, never budget more than the rate it currently estimates the link can carry
+        const uint32_t connectionBytesPerSecond = m_connection.GetSendRateBytesPerSecond();
+        if (connectionBytesPerSecond > 0)
+        {
+            maxBytesPerSecond = (maxBytesPerSecond > 0) ? AZStd::min(maxBytesPerSecond, connectionBytesPerSecond) : connectionBytesPerSecond;
+        }
+        m_replicationScheduler.UpdateBudget(deltaTimeMs, maxBytesPerSecond, sv_ReplicationBudgetMaxBurstMs);
+
+        EntityReplicatorList toSendList = GenerateEntityUpdateList(deltaTimeMs);
 
         AZLOG(NET_ReplicationInfo, "Sending %zd updates from %d to %d", toSendList.size(), (uint8_t)GetNetworkEntityManager()->GetHostId(), (uint8_t)GetRemoteHostId());
 
@@ -273,12 +296,37 @@ namespace Multiplayer
         }
 
         // While our to send list is not empty, build up another packet to send
+        // We always generate at least one packet, even if it is empty, so the remote host receives our current host time and frame id
+        m_pendingEntityUpdates.clear();
         do
         {
-            SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, m_maxPayloadSize, m_connection);
+            GenerateEntityUpdatesPacketHelper(toSendList, m_maxPayloadSize, m_pendingEntityUpdates.emplace_back());
         } while (!toSendList.empty());
     }
 
+    void EntityReplicationManager::SendEntityUpdates()
+    {
+        for (PendingEntityUpdates& pendingUpdates : m_pendingEntityUpdates)
+        {
+            MultiplayerPackets::EntityUpdates entityUpdatePacket;
+            entityUpdatePacket.SetHostTimeMs(m_pendingUpdatesHostTimeMs);
+            entityUpdatePacket.SetHostFrameId(m_pendingUpdatesHostFrameId);
+            for (NetworkEntityUpdateMessage& updateMessage : pendingUpdates.m_entityMessages)
+            {
+                entityUpdatePacket.ModifyEntityMessages().emplace_back(AZStd::move(updateMessage));
+            }
+
+            const AzNetworking::PacketId sentId = m_connection.SendUnreliablePacket(entityUpdatePacket);
+
+            // Update the sent things with the packet id
+            for (EntityReplicator* replicator : pendingUpdates.m_replicators)
+            {
+                replicator->GetPropertyPublisher()->FinalizeSerialization(sentId);
+            }
+        }
+        m_pendingEntityUpdates.clear();
+    }
+
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable)
     {
         while (!deferredRpcs.empty())
@@ -344,6 +392,7 @@ namespace Multiplayer
             m_replicatorsPendingSend.clear();
         }
 
+        m_replicationScheduler.Clear();
         m_entityReplicatorMap.clear();
     }
 
@@ -790,7 +839,13 @@ namespace Multiplayer
             return HandleEntityDeleteMessage(entityReplicator, packetHeader, updateMessage);
         }
 
-        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+        // Updates sent over a bit packing connection are bit packed as well
+        const uint32_t dataSize = static_cast<uint32_t>(updateMessage.GetData()->GetSize());
+        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> byteSerializer(updateMessage.GetData()->GetBuffer(), dataSize);
+        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkBitOutputSerializer> bitSerializer(updateMessage.GetData()->GetBuffer(), dataSize);
+        AzNetworking::ISerializer& outputSerializer = packetHeader.IsPacketFlagSet(AzNetworking::PacketFlag::BitPacked)
+            ? static_cast<AzNetworking::ISerializer&>(bitSerializer)
+            : static_cast<AzNetworking::ISerializer&>(byteSerializer);
 
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
@@ -961,6 +1016,7 @@ namespace Multiplayer
                 if (newWindowIter->first && (newWindowIter->first.GetNetEntityId() < currWindowIter->first))
                 {
                     AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                    m_replicationScheduler.SetRelevance(newWindowIter->first.GetNetEntityId(), newWindowIter->second.m_priority);
                     ++newWindowIter;
                 }
                 else if (newWindowIter->first.GetNetEntityId() > currWindowIter->first)
@@ -981,6 +1037,7 @@ namespace Multiplayer
                         currReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
                     }
                     currReplicator->ClearPendingRemoval();
+                    m_replicationScheduler.SetRelevance(newWindowIter->first.GetNetEntityId(), newWindowIter->second.m_priority);
                     ++newWindowIter;
                     ++currWindowIter;
                 }
@@ -990,6 +1047,7 @@ namespace Multiplayer
             while (newWindowIter != newWindow.end())
             {
                 AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                m_replicationScheduler.SetRelevance(newWindowIter->first.GetNetEntityId(), newWindowIter->second.m_priority);
                 ++newWindowIter;
             }
 
@@ -1251,6 +1309,7 @@ namespace Multiplayer
                 if (replicator->IsDeletionAcknowledged())
                 {
                     m_remoteEntitiesPendingCreation.erase(replicator->GetEntityHandle().GetNetEntityId());
+                    m_replicationScheduler.RemoveEntity(*iter);
                     m_entityReplicatorMap.erase(*iter);
                     iter = m_replicatorsPendingRemoval.erase(iter);
                 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <Source/NetworkEntity/EntityReplication/EntityReplicationScheduler.h>
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
@@ -59,6 +60,14 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates(AZ::TimeMs hostTimeMs);
+
+        //! Serializes all pending entity updates into packets without sending them.
+        //! This only modifies state owned by this replication manager, so the managers for different connections may generate updates concurrently.
+        //! @param hostTimeMs current server game time in milliseconds
+        void GenerateUpdates(AZ::TimeMs hostTimeMs);
+
+        //! Sends the packets built by GenerateUpdates along with any deferred Rpcs, must be invoked from the main thread.
+        void SendGeneratedUpdates();
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -115,11 +124,19 @@ namespace Multiplayer
         bool DispatchOrphanedRpc(NetworkEntityRpcMessage& message, EntityReplicator* entityReplicator);
 
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
-        EntityReplicatorList GenerateEntityUpdateList();
+        EntityReplicatorList GenerateEntityUpdateList(AZ::TimeMs deltaTimeMs);
+
+        //! The serialized contents of a single EntityUpdates packet, waiting to be sent.
+        struct PendingEntityUpdates
+        {
+            AZStd::vector<NetworkEntityUpdateMessage> m_entityMessages;
+            EntityReplicatorList m_replicators;
+        };
 
-        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
+        void GenerateEntityUpdatesPacketHelper(EntityReplicatorList& toSendList, uint32_t maxPayloadSize, PendingEntityUpdates& outPendingUpdates);
 
-        void SendEntityUpdates(AZ::TimeMs hostTimeMs);
+        void GenerateEntityUpdates();
+        void SendEntityUpdates();
         void SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable);
 
         void MigrateEntityInternal(NetEntityId entityId);
@@ -186,6 +203,10 @@ namespace Multiplayer
         AZStd::set<NetEntityId> m_replicatorsPendingRemoval;
         AZStd::unordered_set<NetEntityId> m_replicatorsPendingSend;
 
+        //! Accumulating priority scheduler used to spread proxy entity updates across ticks within the connection's byte budget
+        EntityReplicationScheduler m_replicationScheduler;
+        AZStd::vector<NetEntityId> m_scheduledEntities;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
@@ -204,6 +225,10 @@ namespace Multiplayer
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::TimeMs{ 0 };
         AZ::TimeMs m_entityPendingRemovalMs = AZ::TimeMs{ 0 };
         AZ::TimeMs m_frameTimeMs = AZ::TimeMs{ 0 };
+        AZ::TimeMs m_lastEntityUpdateTimeMs = AZ::TimeMs{ 0 };
+        AZ::TimeMs m_pendingUpdatesHostTimeMs = AZ::TimeMs{ 0 };
+        HostFrameId m_pendingUpdatesHostFrameId = InvalidHostFrameId;
+        AZStd::vector<PendingEntityUpdates> m_pendingEntityUpdates;
         HostId m_remoteHostId = InvalidHostId;
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
         uint32_t m_maxPayloadSize = 0;
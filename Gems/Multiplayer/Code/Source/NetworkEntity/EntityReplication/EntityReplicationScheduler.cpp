@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntityReplicationScheduler.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    EntityReplicationScheduler::EntityReplicationScheduler(uint32_t referenceUpdateSize)
+        : m_referenceUpdateSize(AZStd::max<uint32_t>(referenceUpdateSize, 1))
+    {
+        ;
+    }
+
+    void EntityReplicationScheduler::SetRelevance(NetEntityId netEntityId, float relevance)
+    {
+        m_entityStates[netEntityId].m_relevance = AZStd::max(relevance, 0.0f);
+    }
+
+    void EntityReplicationScheduler::RemoveEntity(NetEntityId netEntityId)
+    {
+        m_entityStates.erase(netEntityId);
+    }
+
+    void EntityReplicationScheduler::Clear()
+    {
+        m_entityStates.clear();
+        m_candidates.clear();
+        m_availableBytes = 0;
+        m_budgetEnabled = false;
+    }
+
+    void EntityReplicationScheduler::UpdateBudget(AZ::TimeMs deltaTimeMs, uint32_t bytesPerSecond, AZ::TimeMs maxBurstMs)
+    {
+        m_budgetEnabled = (bytesPerSecond > 0);
+        if (!m_budgetEnabled)
+        {
+            m_availableBytes = 0;
+            return;
+        }
+
+        // Any overspend from the previous update is paid back before new bytes become available
+        const int64_t refillBytes = (static_cast<int64_t>(bytesPerSecond) * static_cast<int64_t>(deltaTimeMs)) / 1000;
+        const int64_t maxBankedBytes = AZStd::max<int64_t>((static_cast<int64_t>(bytesPerSecond) * static_cast<int64_t>(maxBurstMs)) / 1000, 1);
+        m_availableBytes = AZStd::min(m_availableBytes + refillBytes, maxBankedBytes);
+    }
+
+    void EntityReplicationScheduler::AddCandidate(NetEntityId netEntityId, AZ::TimeMs deltaTimeMs)
+    {
+        EntityState& state = m_entityStates[netEntityId];
+        state.m_accumulatedPriority += state.m_relevance * static_cast<float>(deltaTimeMs);
+
+        // Large updates consume more of the budget, so weight them down to give smaller updates a chance to go out first
+        const float sizeWeight = static_cast<float>(m_referenceUpdateSize) / static_cast<float>(m_referenceUpdateSize + state.m_estimatedSize);
+        m_candidates.push_back({ netEntityId, state.m_accumulatedPriority * sizeWeight, state.m_relevance });
+    }
+
+    void EntityReplicationScheduler::SelectCandidates(uint32_t maxCount, AZStd::vector<NetEntityId>& outSelected)
+    {
+        AZStd::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& lhs, const Candidate& rhs)
+        {
+            // Ties (for example on the first update, when nothing has accumulated yet) are broken by relevance
+            return (lhs.m_score != rhs.m_score) ? (lhs.m_score > rhs.m_score) : (lhs.m_relevance > rhs.m_relevance);
+        });
+
+        for (const Candidate& candidate : m_candidates)
+        {
+            if (outSelected.size() >= maxCount)
+            {
+                break;
+            }
+
+            // We allow the last selected update to overspend, the deficit is carried into the next update
+            if (m_budgetEnabled && (m_availableBytes <= 0))
+            {
+                break;
+            }
+
+            EntityState& state = m_entityStates[candidate.m_netEntityId];
+            state.m_selected = true;
+            m_availableBytes -= state.m_estimatedSize;
+            outSelected.push_back(candidate.m_netEntityId);
+        }
+
+        m_candidates.clear();
+    }
+
+    void EntityReplicationScheduler::OnEntitySent(NetEntityId netEntityId, uint32_t sentBytes)
+    {
+        auto iter = m_entityStates.find(netEntityId);
+        if (iter == m_entityStates.end())
+        {
+            m_availableBytes -= sentBytes;
+            return;
+        }
+
+        EntityState& state = iter->second;
+        if (state.m_selected)
+        {
+            // The estimate was charged on selection, correct the budget using the actual size
+            m_availableBytes += static_cast<int64_t>(state.m_estimatedSize) - static_cast<int64_t>(sentBytes);
+            state.m_selected = false;
+        }
+        else
+        {
+            m_availableBytes -= sentBytes;
+        }
+
+        // Smooth the estimate so that a single large update (like entity creation) doesn't dominate future scheduling
+        state.m_estimatedSize = AZStd::max<uint32_t>((state.m_estimatedSize + sentBytes) / 2, 1);
+        state.m_accumulatedPriority = 0.0f;
+    }
+
+    float EntityReplicationScheduler::GetAccumulatedPriority(NetEntityId netEntityId) const
+    {
+        auto iter = m_entityStates.find(netEntityId);
+        return (iter != m_entityStates.end()) ? iter->second.m_accumulatedPriority : 0.0f;
+    }
+
+    int64_t EntityReplicationScheduler::GetAvailableBytes() const
+    {
+        return m_availableBytes;
+    }
+
+    bool EntityReplicationScheduler::IsBudgetEnabled() const
+    {
+        return m_budgetEnabled;
+    }
+}
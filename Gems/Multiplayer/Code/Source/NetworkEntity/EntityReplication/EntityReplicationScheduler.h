@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class EntityReplicationScheduler
+    //! @brief Decides which proxy entity updates get sent to a single connection each tick.
+    //! Every entity with pending changes accumulates priority at a rate proportional to its relevance for as long as it waits to be sent,
+    //! so low relevance entities are updated less often but are never starved. Selection is limited by a per-connection byte budget
+    //! which refills over time, allowing updates to be spread out across ticks instead of saturating the connection.
+    class EntityReplicationScheduler
+    {
+    public:
+        //! Estimated update size used for entities that have never been sent.
+        static constexpr uint32_t DefaultEstimatedUpdateSize = 64;
+
+        //! Constructor.
+        //! @param referenceUpdateSize the update size, in bytes, which halves the scheduling weight of an entity (typically the max payload size)
+        explicit EntityReplicationScheduler(uint32_t referenceUpdateSize = 1024);
+
+        //! Sets the relevance of an entity to this connection, as provided by the replication window.
+        //! Entities that never had their relevance set default to a relevance of 1.
+        //! @param netEntityId the entity to set the relevance for
+        //! @param relevance   relevance of the entity, higher values accumulate priority faster
+        void SetRelevance(NetEntityId netEntityId, float relevance);
+
+        //! Discards any scheduling state for the provided entity.
+        //! @param netEntityId the entity to stop tracking
+        void RemoveEntity(NetEntityId netEntityId);
+
+        //! Discards all scheduling state and resets the byte budget.
+        void Clear();
+
+        //! Refills the byte budget for the elapsed time.
+        //! @param deltaTimeMs    time elapsed since the last update
+        //! @param bytesPerSecond bytes per second this connection may spend on entity updates, 0 disables the budget
+        //! @param maxBurstMs     the maximum amount of unspent budget that can be banked, in milliseconds of bandwidth
+        void UpdateBudget(AZ::TimeMs deltaTimeMs, uint32_t bytesPerSecond, AZ::TimeMs maxBurstMs);
+
+        //! Adds an entity with pending changes as a send candidate, accumulating its priority for the time it has been waiting.
+        //! @param netEntityId the entity that requires an update
+        //! @param deltaTimeMs time elapsed since the last update
+        void AddCandidate(NetEntityId netEntityId, AZ::TimeMs deltaTimeMs);
+
+        //! Orders all candidates by priority and selects as many as the byte budget allows.
+        //! The candidate list is cleared, unselected entities keep their accumulated priority for the next update.
+        //! @param maxCount       the maximum number of entities to select
+        //! @param outSelected    the selected entities, highest priority first
+        void SelectCandidates(uint32_t maxCount, AZStd::vector<NetEntityId>& outSelected);
+
+        //! Records the serialized size of an entity update that was sent, resetting its accumulated priority.
+        //! Entities that were not selected through SelectCandidates (such as autonomous entities) are charged against the budget directly.
+        //! @param netEntityId the entity that was sent
+        //! @param sentBytes   the serialized size of the update
+        void OnEntitySent(NetEntityId netEntityId, uint32_t sentBytes);
+
+        //! Returns the current priority accumulated by an entity, 0 if the entity is not tracked.
+        float GetAccumulatedPriority(NetEntityId netEntityId) const;
+
+        //! Returns the number of bytes that may still be spent, or a negative value if the budget was overspent.
+        int64_t GetAvailableBytes() const;
+
+        //! Returns true if a byte budget is currently being enforced.
+        bool IsBudgetEnabled() const;
+
+    private:
+        struct EntityState
+        {
+            float m_relevance = 1.0f;
+            float m_accumulatedPriority = 0.0f;
+            uint32_t m_estimatedSize = DefaultEstimatedUpdateSize;
+            bool m_selected = false;
+        };
+
+        struct Candidate
+        {
+            NetEntityId m_netEntityId;
+            float m_score;
+            float m_relevance;
+        };
+
+        AZStd::unordered_map<NetEntityId, EntityState> m_entityStates;
+        AZStd::vector<Candidate> m_candidates;
+        int64_t m_availableBytes = 0;
+        uint32_t m_referenceUpdateSize = 1024;
+        bool m_budgetEnabled = false;
+    };
+}
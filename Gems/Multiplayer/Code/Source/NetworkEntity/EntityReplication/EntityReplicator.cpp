@@ -23,6 +23,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/PacketLayer/IPacket.h>
 #include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 
@@ -488,7 +489,13 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
+        // Match the packing of the connection, the receiver picks its serializer from the flags of the packet carrying this update
+        const uint32_t bufferCapacity = static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity());
+        AzNetworking::NetworkInputSerializer byteSerializer(updateMessage.ModifyData().GetBuffer(), bufferCapacity);
+        AzNetworking::NetworkBitInputSerializer bitSerializer(updateMessage.ModifyData().GetBuffer(), bufferCapacity);
+        AzNetworking::ISerializer& inputSerializer = m_connection->IsBitPackingEnabled()
+            ? static_cast<AzNetworking::ISerializer&>(bitSerializer)
+            : static_cast<AzNetworking::ISerializer&>(byteSerializer);
         m_propertyPublisher->UpdateSerialization(inputSerializer);
         updateMessage.ModifyData().Resize(inputSerializer.GetSize());
 
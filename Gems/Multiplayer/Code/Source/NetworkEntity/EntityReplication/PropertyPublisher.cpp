@@ -167,12 +167,12 @@ namespace Multiplayer
         return !IsDeleted();
     }
 
-    bool PropertyPublisher::SerializeUpdateEntityRecord(AzNetworking::ISerializer &serializer)
+    bool PropertyPublisher::SerializeUpdateEntityRecord(AzNetworking::ISerializer& serializer)
     {
         AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
         m_pendingRecord.ResetConsumedBits();
         m_pendingRecord.Serialize(serializer);
-        m_netBindComponent->SerializeStateDeltaMessage(m_pendingRecord, serializer);
+        m_netBindComponent->SerializeCachedStateDeltaMessage(m_pendingRecord, serializer);
         return serializer.IsValid();
     }
 
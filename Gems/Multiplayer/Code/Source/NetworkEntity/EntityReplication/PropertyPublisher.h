@@ -76,6 +76,7 @@ namespace Multiplayer
 
         //! Phase 2, serialize the record
         //! No add, they share the update path
+        //! The state delta is shared with any other connection serializing an identical record for this entity in the same host frame
         bool SerializeUpdateEntityRecord(AzNetworking::ISerializer& serializer);
         bool SerializeDeleteEntityRecord(AzNetworking::ISerializer& serializer);
 
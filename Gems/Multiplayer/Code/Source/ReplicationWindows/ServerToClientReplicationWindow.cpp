@@ -23,12 +23,23 @@ namespace Multiplayer
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
     AZ_CVAR(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
+    AZ_CVAR(float, sv_ClientRelevanceFalloffDistance, 50.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The distance from the client at which an entity's replication relevance is halved");
+    AZ_CVAR(uint32_t, sv_ClientMaxBytesPerSecond, 65536, nullptr, AZ::ConsoleFunctorFlags::Null, "The max number of bytes per second to spend on entity updates to a client connection, 0 to disable the limit");
+    AZ_CVAR(float, sv_PoorConnectionBandwidthScale, 0.5f, nullptr, AZ::ConsoleFunctorFlags::Null, "The fraction of sv_ClientMaxBytesPerSecond used for connections considered poor");
+    AZ_CVAR(float, sv_MinConnectionBandwidthScale, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The minimum fraction of sv_ClientMaxBytesPerSecond used regardless of connection quality");
 
     const char* GetConnectionStateString(bool isPoor)
     {
         return isPoor ? "poor" : "ideal";
     }
 
+    // Relevance is in the range (0, 1], the replication scheduler accumulates it over time so distant entities still get updated eventually
+    static float ComputeRelevance(float distanceSquared)
+    {
+        const float falloffDistance = AZStd::max(static_cast<float>(sv_ClientRelevanceFalloffDistance), 1.0f);
+        return 1.0f / (1.0f + distanceSquared / (falloffDistance * falloffDistance));
+    }
+
     ServerToClientReplicationWindow::PrioritizedReplicationCandidate::PrioritizedReplicationCandidate
     (
         const ConstNetworkEntityHandle& entityHandle,
@@ -90,6 +101,25 @@ namespace Multiplayer
         return m_isPoorConnection ? sv_MinEntitiesToReplicate : sv_MaxEntitiesToReplicate;
     }
 
+    uint32_t ServerToClientReplicationWindow::GetMaxBytesPerSecond() const
+    {
+        if (sv_ClientMaxBytesPerSecond == 0)
+        {
+            return 0;
+        }
+
+        // Back off proportionally to the loss we are currently seeing, further reduced if the connection has been deemed poor
+        const float lossRate = m_connection->GetMetrics().m_sendDatarate.GetLossRatePercent();
+        float bandwidthScale = AZStd::clamp(1.0f - lossRate, 0.0f, 1.0f);
+        if (m_isPoorConnection)
+        {
+            bandwidthScale *= sv_PoorConnectionBandwidthScale;
+        }
+        bandwidthScale = AZStd::clamp(bandwidthScale, static_cast<float>(sv_MinConnectionBandwidthScale), 1.0f);
+
+        return AZStd::max<uint32_t>(static_cast<uint32_t>(static_cast<float>(sv_ClientMaxBytesPerSecond) * bandwidthScale), 1);
+    }
+
     bool ServerToClientReplicationWindow::IsInWindow(const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
     {
         // TODO: Clean up this interface, this function is used for server->server migrations, and probably shouldn't be exposed in it's current setup
@@ -161,7 +191,7 @@ namespace Multiplayer
                 const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
                 const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
                 const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-                const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
+                const float priority = ComputeRelevance(gatherDistanceSquared);
 
                 NetworkEntityHandle entityHandle(entryNetBindComponent, networkEntityTracker);
                 AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
@@ -228,7 +258,7 @@ namespace Multiplayer
                     // Make sure we would be in the awareness radius
                     if (distSq < awarenessSq)
                     {
-                        AddEntityToReplicationSet(entityHandle, 1.0f, distSq);
+                        AddEntityToReplicationSet(entityHandle, ComputeRelevance(distSq), distSq);
                     }
                 }
             }
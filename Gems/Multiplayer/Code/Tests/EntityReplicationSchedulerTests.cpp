@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntityReplicationScheduler.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class EntityReplicationSchedulerTests
+        : public AllocatorsFixture
+    {
+    };
+
+    static constexpr AZ::TimeMs TickTimeMs = AZ::TimeMs{ 33 };
+    static constexpr AZ::TimeMs BurstTimeMs = AZ::TimeMs{ 250 };
+
+    TEST_F(EntityReplicationSchedulerTests, SelectsByRelevanceWithoutBudget)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.SetRelevance(NetEntityId{ 1 }, 0.1f);
+        scheduler.SetRelevance(NetEntityId{ 2 }, 1.0f);
+        scheduler.SetRelevance(NetEntityId{ 3 }, 0.5f);
+
+        scheduler.UpdateBudget(TickTimeMs, 0, BurstTimeMs);
+        EXPECT_FALSE(scheduler.IsBudgetEnabled());
+
+        scheduler.AddCandidate(NetEntityId{ 1 }, TickTimeMs);
+        scheduler.AddCandidate(NetEntityId{ 2 }, TickTimeMs);
+        scheduler.AddCandidate(NetEntityId{ 3 }, TickTimeMs);
+
+        AZStd::vector<NetEntityId> selected;
+        scheduler.SelectCandidates(2, selected);
+        ASSERT_EQ(selected.size(), 2);
+        EXPECT_EQ(selected[0], NetEntityId{ 2 });
+        EXPECT_EQ(selected[1], NetEntityId{ 3 });
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, LowRelevanceEntitiesAreNotStarved)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.SetRelevance(NetEntityId{ 1 }, 1.0f);
+        scheduler.SetRelevance(NetEntityId{ 2 }, 0.1f);
+
+        bool farEntitySent = false;
+        for (uint32_t tick = 0; tick < 20 && !farEntitySent; ++tick)
+        {
+            // Both entities are dirty every tick, but only one update fits
+            scheduler.AddCandidate(NetEntityId{ 1 }, TickTimeMs);
+            scheduler.AddCandidate(NetEntityId{ 2 }, TickTimeMs);
+
+            AZStd::vector<NetEntityId> selected;
+            scheduler.SelectCandidates(1, selected);
+            ASSERT_EQ(selected.size(), 1);
+            scheduler.OnEntitySent(selected[0], EntityReplicationScheduler::DefaultEstimatedUpdateSize);
+            farEntitySent = (selected[0] == NetEntityId{ 2 });
+        }
+
+        EXPECT_TRUE(farEntitySent);
+        EXPECT_EQ(scheduler.GetAccumulatedPriority(NetEntityId{ 2 }), 0.0f);
+        EXPECT_GT(scheduler.GetAccumulatedPriority(NetEntityId{ 1 }), 0.0f);
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, BudgetLimitsSelectedUpdates)
+    {
+        static constexpr uint32_t BytesPerSecond = 4000;
+        static constexpr uint32_t EntityCount = 32;
+
+        EntityReplicationScheduler scheduler;
+        scheduler.UpdateBudget(AZ::TimeMs{ 100 }, BytesPerSecond, BurstTimeMs);
+        EXPECT_TRUE(scheduler.IsBudgetEnabled());
+        EXPECT_EQ(scheduler.GetAvailableBytes(), 400);
+
+        for (uint32_t i = 0; i < EntityCount; ++i)
+        {
+            scheduler.AddCandidate(NetEntityId{ i }, TickTimeMs);
+        }
+
+        // 400 bytes at the default estimate of 64 bytes allows 7 updates, the last one overspending the budget
+        AZStd::vector<NetEntityId> selected;
+        scheduler.SelectCandidates(EntityCount, selected);
+        EXPECT_EQ(selected.size(), 7);
+        EXPECT_LT(scheduler.GetAvailableBytes(), 0);
+
+        // Actual sizes correct the estimates that were charged on selection
+        for (NetEntityId netEntityId : selected)
+        {
+            scheduler.OnEntitySent(netEntityId, 32);
+        }
+        EXPECT_EQ(scheduler.GetAvailableBytes(), 400 - 7 * 32);
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, BudgetIsCappedByBurst)
+    {
+        EntityReplicationScheduler scheduler;
+        for (uint32_t tick = 0; tick < 100; ++tick)
+        {
+            scheduler.UpdateBudget(TickTimeMs, 1000, BurstTimeMs);
+        }
+        EXPECT_EQ(scheduler.GetAvailableBytes(), 250);
+
+        // Unscheduled sends (like autonomous entities) are charged directly
+        scheduler.OnEntitySent(NetEntityId{ 7 }, 300);
+        EXPECT_EQ(scheduler.GetAvailableBytes(), -50);
+
+        AZStd::vector<NetEntityId> selected;
+        scheduler.AddCandidate(NetEntityId{ 1 }, TickTimeMs);
+        scheduler.SelectCandidates(1, selected);
+        EXPECT_TRUE(selected.empty());
+        EXPECT_GT(scheduler.GetAccumulatedPriority(NetEntityId{ 1 }), 0.0f);
+    }
+}
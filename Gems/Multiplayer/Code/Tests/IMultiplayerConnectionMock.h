@@ -47,6 +47,12 @@ class IMultiplayerConnectionMock : public IConnection
 
         MOCK_CONST_METHOD0(GetConnectionMtu, uint32_t());
 
+        MOCK_CONST_METHOD0(GetSendBudget, uint32_t());
+
+        MOCK_CONST_METHOD0(GetSendRateBytesPerSecond, uint32_t());
+
+        MOCK_CONST_METHOD0(IsBitPackingEnabled, bool());
+
         MOCK_METHOD1(SetConnectionMtu, void(const ConnectionQuality&));
 
         MOCK_METHOD1(SetConnectionQuality, void(const ConnectionQuality&));
@@ -14,11 +14,13 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
 #include <AzTest/AzTest.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyChildComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <NetworkEntity/EntityReplication/PropertyPublisher.h>
 
 namespace Multiplayer
 {
@@ -195,6 +197,32 @@ namespace Multiplayer
         m_child->m_entity.reset();
     }
 
+    TEST_F(ServerSimpleHierarchyTests, Entity_Update_Is_Smaller_When_Bit_Packed)
+    {
+        PropertyPublisher* propertyPublisher = m_child->m_replicator->GetPropertyPublisher();
+        propertyPublisher->GenerateRecord();
+        EXPECT_TRUE(propertyPublisher->PrepareSerialization());
+
+        // Generate the same pending update for a byte aligned and a bit packed connection
+        ON_CALL(*m_mockConnection, IsBitPackingEnabled()).WillByDefault(Return(false));
+        NetworkEntityUpdateMessage byteAlignedMessage = m_child->m_replicator->GenerateUpdatePacket();
+        ON_CALL(*m_mockConnection, IsBitPackingEnabled()).WillByDefault(Return(true));
+        NetworkEntityUpdateMessage bitPackedMessage = m_child->m_replicator->GenerateUpdatePacket();
+        EXPECT_GT(bitPackedMessage.GetData()->GetSize(), 0u);
+        EXPECT_LE(bitPackedMessage.GetData()->GetSize(), byteAlignedMessage.GetData()->GetSize());
+
+        // Write each update the way its connection writes it into the entity updates packet
+        AZStd::array<uint8_t, 1024> byteAlignedBuffer;
+        NetworkInputSerializer byteAlignedSerializer(byteAlignedBuffer.data(), static_cast<uint32_t>(byteAlignedBuffer.size()));
+        EXPECT_TRUE(byteAlignedMessage.Serialize(byteAlignedSerializer));
+
+        AZStd::array<uint8_t, 1024> bitPackedBuffer;
+        NetworkBitInputSerializer bitPackedSerializer(bitPackedBuffer.data(), static_cast<uint32_t>(bitPackedBuffer.size()));
+        EXPECT_TRUE(bitPackedMessage.Serialize(bitPackedSerializer));
+
+        EXPECT_LT(bitPackedSerializer.GetSizeInBits(), byteAlignedSerializer.GetSizeInBits());
+    }
+
     /*
      * Parent -> Child -> ChildOfChild
      */
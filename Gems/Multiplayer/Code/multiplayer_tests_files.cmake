@@ -10,6 +10,7 @@ set(FILES
     Tests/Main.cpp
     Tests/MockInterfaces.h
     Tests/ClientHierarchyTests.cpp
+    Tests/EntityReplicationSchedulerTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/CommonHierarchySetup.h
     Tests/IMultiplayerConnectionMock.h
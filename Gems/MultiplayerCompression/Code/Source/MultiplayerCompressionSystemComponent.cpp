@@ -15,6 +15,7 @@
 #include "MultiplayerCompressionSystemComponent.h"
 #include "LZ4Compressor.h"
 #include "MultiplayerCompressionFactory.h"
+#include "ZstdCompressionFactory.h"
 
 namespace MultiplayerCompression
 {
@@ -51,11 +52,23 @@ namespace MultiplayerCompression
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+
+        m_zstdCompressionFactory = new ZstdCompressionFactory(AZ::Name(ZstdCompressorFactoryName), false);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_zstdCompressionFactory);
+
+        m_zstdStreamingCompressionFactory = new ZstdCompressionFactory(AZ::Name(ZstdStreamingCompressorFactoryName), true);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_zstdStreamingCompressionFactory);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
+
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_zstdCompressionFactory->GetFactoryName());
+        delete m_zstdCompressionFactory;
+
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_zstdStreamingCompressionFactory->GetFactoryName());
+        delete m_zstdStreamingCompressionFactory;
     }
 }
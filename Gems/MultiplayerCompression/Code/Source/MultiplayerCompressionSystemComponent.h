@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/unordered_set.h>
 
 #include <MultiplayerCompressionFactory.h>
+#include <ZstdCompressionFactory.h>
 
 namespace MultiplayerCompression
 {
@@ -41,5 +42,7 @@ namespace MultiplayerCompression
         ////////////////////////////////////////////////////////////////////////
     private:
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        ZstdCompressionFactory* m_zstdCompressionFactory;
+        ZstdCompressionFactory* m_zstdStreamingCompressionFactory;
     };
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressionFactory.h"
+#include "ZstdCompressor.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Path of a pre-trained Zstd dictionary, both endpoints must use the same dictionary. Only affects compressors created after it is set");
+    AZ_CVAR(int32_t, net_ZstdCompressionLevel, ZSTD_CLEVEL_DEFAULT, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Zstd compression level, higher levels trade compression time for smaller packets");
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdCapturePath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If set, Zstd compressors created afterwards append every packet they compress to this packet dump for net_ZstdTrainDictionary");
+
+    ZstdCompressionFactory::ZstdCompressionFactory(const AZ::Name& name, bool streaming)
+        : m_name(name)
+        , m_streaming(streaming)
+    {
+        ;
+    }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> ZstdCompressionFactory::Create()
+    {
+        const int32_t compressionLevel = net_ZstdCompressionLevel;
+        AZStd::unique_ptr<ZstdCompressor> compressor = AZStd::make_unique<ZstdCompressor>(GetDictionary(compressionLevel), m_streaming, compressionLevel);
+        if (!compressor->Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to initialize Zstd compressor");
+            return nullptr;
+        }
+
+        const AZ::CVarFixedString capturePath = net_ZstdCapturePath;
+        if (!capturePath.empty())
+        {
+            compressor->SetCapturePath(capturePath.c_str());
+        }
+        return compressor;
+    }
+
+    AZ::Name ZstdCompressionFactory::GetFactoryName() const
+    {
+        return m_name;
+    }
+
+    AZStd::shared_ptr<const ZstdDictionary> ZstdCompressionFactory::GetDictionary(int32_t compressionLevel)
+    {
+        const AZ::CVarFixedString dictionaryPath = net_ZstdDictionaryPath;
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_dictionaryMutex);
+        if ((dictionaryPath == m_dictionaryPath) && (compressionLevel == m_dictionaryCompressionLevel))
+        {
+            return m_dictionary;
+        }
+
+        m_dictionaryPath = dictionaryPath;
+        m_dictionaryCompressionLevel = compressionLevel;
+        m_dictionary = nullptr;
+        if (dictionaryPath.empty())
+        {
+            return m_dictionary;
+        }
+
+        auto dictionaryData = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(dictionaryPath);
+        if (!dictionaryData.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read Zstd dictionary %s: %s", dictionaryPath.c_str(), dictionaryData.GetError().c_str());
+            return m_dictionary;
+        }
+
+        const AZStd::vector<uint8_t>& dictionaryBytes = dictionaryData.GetValue();
+        auto dictionary = AZStd::make_shared<ZstdDictionary>(dictionaryBytes.data(), dictionaryBytes.size(), compressionLevel);
+        if (!dictionary->IsValid())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Zstd dictionary %s is invalid", dictionaryPath.c_str());
+            return m_dictionary;
+        }
+
+        m_dictionary = AZStd::move(dictionary);
+        return m_dictionary;
+    }
+}
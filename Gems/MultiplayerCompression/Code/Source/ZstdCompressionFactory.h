@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Console/IConsoleTypes.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+namespace MultiplayerCompression
+{
+    class ZstdDictionary;
+
+    //! Name of the factory creating stateless Zstd compressors, valid for both Udp and Tcp.
+    static const char* ZstdCompressorFactoryName = "MultiplayerZstdCompressor";
+
+    //! Name of the factory creating streaming Zstd compressors, only valid for Tcp where every connection owns its compressor.
+    //! Udp network interfaces refuse these compressors, since they require ordered delivery.
+    static const char* ZstdStreamingCompressorFactoryName = "MultiplayerZstdStreamingCompressor";
+
+    class ZstdCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! Constructor.
+        //! @param name      name the factory is registered under
+        //! @param streaming whether created compressors keep compression history across packets
+        ZstdCompressionFactory(const AZ::Name& name, bool streaming);
+
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the AZ Name of this compressor factory
+        //! @return the AZ Name of this compressor factory
+        AZ::Name GetFactoryName() const override;
+
+    private:
+        //! Returns the dictionary configured by net_ZstdDictionaryPath, reloading it if the cvars changed since the last call.
+        //! Safe to call from multiple threads, since network interfaces may create their compressors concurrently.
+        AZStd::shared_ptr<const ZstdDictionary> GetDictionary(int32_t compressionLevel);
+
+        const AZ::Name m_name;
+        const bool m_streaming;
+
+        AZStd::mutex m_dictionaryMutex;
+        AZ::CVarFixedString m_dictionaryPath;
+        int32_t m_dictionaryCompressionLevel = 0;
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+    };
+}
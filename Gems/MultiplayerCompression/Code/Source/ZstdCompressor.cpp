@@ -0,0 +1,428 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressor.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <zdict.h>
+#include <zstd_errors.h>
+
+namespace MultiplayerCompression
+{
+    // Captured packets are buffered and appended to the packet dump in batches of roughly this size
+    static constexpr size_t CaptureFlushSize = 64 * 1024;
+
+    // Dictionaries beyond a few kilobytes stop paying off for packets that fit in a single MTU
+    static constexpr uint32_t DefaultDictionarySize = 8 * 1024;
+
+    static AzNetworking::CompressorError GetCompressorError(size_t zstdResult)
+    {
+        return (ZSTD_getErrorCode(zstdResult) == ZSTD_error_dstSize_tooSmall)
+            ? AzNetworking::CompressorError::InsufficientBuffer
+            : AzNetworking::CompressorError::CorruptData;
+    }
+
+    ZstdDictionary::ZstdDictionary(const void* dictionaryData, size_t dictionarySize, int32_t compressionLevel)
+    {
+        m_compressionDictionary = ZSTD_createCDict(dictionaryData, dictionarySize, compressionLevel);
+        m_decompressionDictionary = ZSTD_createDDict(dictionaryData, dictionarySize);
+    }
+
+    ZstdDictionary::~ZstdDictionary()
+    {
+        ZSTD_freeCDict(m_compressionDictionary);
+        ZSTD_freeDDict(m_decompressionDictionary);
+    }
+
+    bool ZstdDictionary::IsValid() const
+    {
+        return (m_compressionDictionary != nullptr) && (m_decompressionDictionary != nullptr);
+    }
+
+    uint32_t ZstdDictionary::GetDictionaryId() const
+    {
+        return (m_decompressionDictionary != nullptr) ? ZSTD_getDictID_fromDDict(m_decompressionDictionary) : 0;
+    }
+
+    const ZSTD_CDict* ZstdDictionary::GetCompressionDictionary() const
+    {
+        return m_compressionDictionary;
+    }
+
+    const ZSTD_DDict* ZstdDictionary::GetDecompressionDictionary() const
+    {
+        return m_decompressionDictionary;
+    }
+
+    ZstdCompressor::ZstdCompressor(AZStd::shared_ptr<const ZstdDictionary> dictionary, bool streaming, int32_t compressionLevel)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_streaming(streaming)
+        , m_compressionLevel(compressionLevel)
+    {
+        if (m_dictionary && !m_dictionary->IsValid())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Invalid Zstd dictionary provided, compressing without a dictionary");
+            m_dictionary = nullptr;
+        }
+
+        if (m_streaming)
+        {
+            m_compressionStream = ZSTD_createCStream();
+            m_decompressionStream = ZSTD_createDStream();
+        }
+        else
+        {
+            m_compressionContext = ZSTD_createCCtx();
+            m_decompressionContext = ZSTD_createDCtx();
+        }
+        Init();
+    }
+
+    ZstdCompressor::~ZstdCompressor()
+    {
+        FlushCapture();
+        ZSTD_freeCCtx(m_compressionContext);
+        ZSTD_freeDCtx(m_decompressionContext);
+        ZSTD_freeCStream(m_compressionStream);
+        ZSTD_freeDStream(m_decompressionStream);
+    }
+
+    bool ZstdCompressor::Init()
+    {
+        if (!m_streaming)
+        {
+            return (m_compressionContext != nullptr) && (m_decompressionContext != nullptr);
+        }
+
+        if ((m_compressionStream == nullptr) || (m_decompressionStream == nullptr))
+        {
+            return false;
+        }
+
+        // Restarts both streams, any history shared with the remote endpoint is lost
+        const size_t compressInit = m_dictionary
+            ? ZSTD_initCStream_usingCDict(m_compressionStream, m_dictionary->GetCompressionDictionary())
+            : ZSTD_initCStream(m_compressionStream, m_compressionLevel);
+        const size_t decompressInit = m_dictionary
+            ? ZSTD_initDStream_usingDDict(m_decompressionStream, m_dictionary->GetDecompressionDictionary())
+            : ZSTD_initDStream(m_decompressionStream);
+        return !ZSTD_isError(compressInit) && !ZSTD_isError(decompressInit);
+    }
+
+    size_t ZstdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (!m_capturePath.empty())
+        {
+            AppendPacketDump(m_captureBuffer, uncompData, uncompSize);
+            if (m_captureBuffer.size() >= CaptureFlushSize)
+            {
+                FlushCapture();
+            }
+        }
+
+        if (m_streaming)
+        {
+            return CompressStream(uncompData, uncompSize, compData, compDataSize, compSize);
+        }
+
+        if (m_compressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Zstd compression context failed to allocate");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const size_t result = m_dictionary
+            ? ZSTD_compress_usingCDict(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_dictionary->GetCompressionDictionary())
+            : ZSTD_compressCCtx(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B) with error %s", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return GetCompressorError(result);
+        }
+        compSize = result;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_streaming)
+        {
+            return DecompressStream(compData, compDataSize, uncompData, uncompDataSize, consumedSizeOut, uncompSizeOut);
+        }
+
+        if (m_decompressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Zstd decompression context failed to allocate");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const size_t result = m_dictionary
+            ? ZSTD_decompress_usingDDict(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize, m_dictionary->GetDecompressionDictionary())
+            : ZSTD_decompressDCtx(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize);
+        consumedSizeOut = compDataSize;
+
+        if (ZSTD_isError(result))
+        {
+            // A dictionary mismatch between the two endpoints also ends up here, the frame records the dictionary id it was compressed with
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B) with error %s", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return GetCompressorError(result);
+        }
+        uncompSizeOut = result;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    void ZstdCompressor::SetCapturePath(const AZ::IO::Path& capturePath)
+    {
+        FlushCapture();
+        m_capturePath = capturePath;
+    }
+
+    AZStd::vector<uint8_t> ZstdCompressor::TrainDictionary(const AZStd::vector<uint8_t>& samples, const AZStd::vector<size_t>& sampleSizes, size_t maxDictionarySize)
+    {
+        AZStd::vector<uint8_t> dictionary;
+        dictionary.resize_no_construct(maxDictionarySize);
+
+        const size_t result = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), samples.data(), sampleSizes.data(), aznumeric_cast<unsigned>(sampleSizes.size()));
+        if (ZDICT_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to train a dictionary from %zu samples with error %s", sampleSizes.size(), ZDICT_getErrorName(result));
+            return AZStd::vector<uint8_t>();
+        }
+
+        dictionary.resize(result);
+        return dictionary;
+    }
+
+    void ZstdCompressor::AppendPacketDump(AZStd::vector<uint8_t>& packetDump, const void* packetData, size_t packetSize)
+    {
+        const uint32_t recordSize = aznumeric_cast<uint32_t>(packetSize);
+        const uint8_t* recordSizeBytes = reinterpret_cast<const uint8_t*>(&recordSize);
+        const uint8_t* packetBytes = reinterpret_cast<const uint8_t*>(packetData);
+        packetDump.insert(packetDump.end(), recordSizeBytes, recordSizeBytes + sizeof(recordSize));
+        packetDump.insert(packetDump.end(), packetBytes, packetBytes + packetSize);
+    }
+
+    bool ZstdCompressor::ParsePacketDump(const AZStd::vector<uint8_t>& packetDump, AZStd::vector<uint8_t>& samples, AZStd::vector<size_t>& sampleSizes)
+    {
+        samples.clear();
+        sampleSizes.clear();
+        samples.reserve(packetDump.size());
+
+        size_t offset = 0;
+        while (offset < packetDump.size())
+        {
+            uint32_t recordSize = 0;
+            if (packetDump.size() - offset < sizeof(recordSize))
+            {
+                return false;
+            }
+            memcpy(&recordSize, packetDump.data() + offset, sizeof(recordSize));
+            offset += sizeof(recordSize);
+
+            if (packetDump.size() - offset < recordSize)
+            {
+                return false;
+            }
+            samples.insert(samples.end(), packetDump.data() + offset, packetDump.data() + offset + recordSize);
+            sampleSizes.push_back(recordSize);
+            offset += recordSize;
+        }
+        return true;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::CompressStream(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize)
+    {
+        if (m_compressionStream == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Zstd compression stream failed to allocate");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        ZSTD_inBuffer input = { uncompData, uncompSize, 0 };
+        ZSTD_outBuffer output = { compData, compDataSize, 0 };
+        while (input.pos < input.size)
+        {
+            const size_t result = ZSTD_compressStream(m_compressionStream, &output, &input);
+            if (ZSTD_isError(result))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Stream compression failed for uncompSize:(%zu B) with error %s", uncompSize, ZSTD_getErrorName(result));
+                return GetCompressorError(result);
+            }
+
+            if (output.pos == output.size)
+            {
+                break;
+            }
+        }
+
+        // Flushing ends the current block so the remote endpoint can decode this packet without waiting on the next one,
+        // the frame stays open so later packets keep referencing earlier ones
+        const size_t remaining = (input.pos == input.size) ? ZSTD_flushStream(m_compressionStream, &output) : 1;
+        if (ZSTD_isError(remaining) || (remaining != 0))
+        {
+            // Part of the packet is left behind in the stream, every packet after this one will be undecodable by the remote endpoint
+            AZ_Warning("Multiplayer Compressor", false, "Stream compression output buffer (%zu B) was too small for uncompSize:(%zu B), stream is now corrupt", compDataSize, uncompSize);
+            return AzNetworking::CompressorError::InsufficientBuffer;
+        }
+        compSize = output.pos;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::DecompressStream(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (m_decompressionStream == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Zstd decompression stream failed to allocate");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        ZSTD_inBuffer input = { compData, compDataSize, 0 };
+        ZSTD_outBuffer output = { uncompData, uncompDataSize, 0 };
+        while ((input.pos < input.size) && (output.pos < output.size))
+        {
+            const size_t result = ZSTD_decompressStream(m_decompressionStream, &output, &input);
+            if (ZSTD_isError(result))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Stream decompression failed for compDataSize:(%zu B) with error %s", compDataSize, ZSTD_getErrorName(result));
+                return AzNetworking::CompressorError::CorruptData;
+            }
+        }
+        consumedSizeOut = input.pos;
+
+        if (input.pos < input.size)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Stream decompression output buffer (%zu B) was too small for compDataSize:(%zu B)", uncompDataSize, compDataSize);
+            return AzNetworking::CompressorError::InsufficientBuffer;
+        }
+        uncompSizeOut = output.pos;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    void ZstdCompressor::FlushCapture()
+    {
+        if (m_captureBuffer.empty())
+        {
+            return;
+        }
+
+        AZ::IO::SystemFile captureFile;
+        constexpr auto openMode = AZ::IO::SystemFile::OpenMode::SF_OPEN_APPEND
+            | AZ::IO::SystemFile::OpenMode::SF_OPEN_CREATE
+            | AZ::IO::SystemFile::OpenMode::SF_OPEN_CREATE_PATH
+            | AZ::IO::SystemFile::OpenMode::SF_OPEN_WRITE_ONLY;
+        if (captureFile.Open(m_capturePath.c_str(), openMode))
+        {
+            captureFile.Write(m_captureBuffer.data(), m_captureBuffer.size());
+            captureFile.Close();
+        }
+        else
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to open packet dump %s, dropping %zu captured bytes", m_capturePath.c_str(), m_captureBuffer.size());
+        }
+        m_captureBuffer.clear();
+    }
+
+    void net_ZstdTrainDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_INFO("Usage: net_ZstdTrainDictionary <packet dump path> <dictionary output path> [max dictionary bytes]");
+            return;
+        }
+
+        const AZ::IO::Path dumpPath(arguments[0]);
+        const AZ::IO::Path dictionaryPath(arguments[1]);
+        uint32_t maxDictionarySize = DefaultDictionarySize;
+        if ((arguments.size() > 2) && !AZ::ConsoleTypeHelpers::StringToValue<uint32_t>(maxDictionarySize, arguments[2]))
+        {
+            AZLOG_INFO("Max dictionary size %.*s was malformed", AZ_STRING_ARG(arguments[2]));
+            return;
+        }
+
+        auto packetDump = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(dumpPath.Native());
+        if (!packetDump.IsSuccess())
+        {
+            AZLOG_INFO("Failed to read packet dump %s: %s", dumpPath.c_str(), packetDump.GetError().c_str());
+            return;
+        }
+
+        AZStd::vector<uint8_t> samples;
+        AZStd::vector<size_t> sampleSizes;
+        if (!ZstdCompressor::ParsePacketDump(packetDump.GetValue(), samples, sampleSizes))
+        {
+            AZLOG_INFO("Packet dump %s is truncated or malformed", dumpPath.c_str());
+            return;
+        }
+
+        const AZStd::vector<uint8_t> dictionary = ZstdCompressor::TrainDictionary(samples, sampleSizes, maxDictionarySize);
+        if (dictionary.empty())
+        {
+            AZLOG_INFO("Failed to train a dictionary from %zu packets", sampleSizes.size());
+            return;
+        }
+
+        auto writeResult = AZ::Utils::WriteFile(AZStd::string_view(reinterpret_cast<const char*>(dictionary.data()), dictionary.size()), dictionaryPath.Native());
+        if (!writeResult.IsSuccess())
+        {
+            AZLOG_INFO("Failed to write dictionary %s: %s", dictionaryPath.c_str(), writeResult.GetError().c_str());
+            return;
+        }
+        AZLOG_INFO("Trained a %zu byte dictionary from %zu packets into %s", dictionary.size(), sampleSizes.size(), dictionaryPath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(net_ZstdTrainDictionary, AZ::ConsoleFunctorFlags::DontReplicate, "Trains a Zstd dictionary from a packet dump captured with net_ZstdCapturePath");
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+#ifndef ZSTD_STATIC_LINKING_ONLY
+#define ZSTD_STATIC_LINKING_ONLY
+#endif
+
+#include <zstd.h>
+
+namespace MultiplayerCompression
+{
+    static const char* ZstdCompressorName = "Zstd";
+    static const AzNetworking::CompressorType ZstdCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZstdCompressorName)));
+
+    //! @class ZstdDictionary
+    //! @brief Pre-trained Zstd dictionary, digested once and shared by every compressor that uses it.
+    //!
+    //! Both endpoints of a connection must load the same dictionary. Compressed packets carry the dictionary id, so
+    //! packets compressed with a different dictionary fail to decompress instead of producing garbage.
+    class ZstdDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionary, AZ::SystemAllocator, 0);
+
+        //! Constructor.
+        //! @param dictionaryData   raw dictionary content, as produced by ZstdCompressor::TrainDictionary
+        //! @param dictionarySize   size of the dictionary content in bytes
+        //! @param compressionLevel zstd compression level the dictionary is digested for
+        ZstdDictionary(const void* dictionaryData, size_t dictionarySize, int32_t compressionLevel);
+        ~ZstdDictionary();
+
+        //! Returns whether the dictionary was successfully digested.
+        bool IsValid() const;
+
+        //! Returns the dictionary id stored in compressed frames, 0 for raw content dictionaries.
+        uint32_t GetDictionaryId() const;
+
+        const ZSTD_CDict* GetCompressionDictionary() const;
+        const ZSTD_DDict* GetDecompressionDictionary() const;
+
+    private:
+        ZstdDictionary(const ZstdDictionary&) = delete;
+        ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+
+        ZSTD_CDict* m_compressionDictionary = nullptr;
+        ZSTD_DDict* m_decompressionDictionary = nullptr;
+    };
+
+    /**
+    * Implements a Zstd Compressor against AzNetworking's Compressor interface for use with the Multiplayer Gem.
+    * Small game packets compress poorly on their own, so the compressor can prime every packet with a dictionary trained
+    * on captured traffic, and can optionally keep its compression history from one packet to the next.
+    *
+    * Streaming mode is only valid when a compressor instance serves a single ordered and reliable stream, such as a
+    * TcpConnection. Udp network interfaces share one compressor between all connections and deliver packets out of order,
+    * so they must use the stateless mode.
+    */
+    class ZstdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdCompressor, AZ::SystemAllocator, 0);
+
+        //! Constructor.
+        //! @param dictionary       optional dictionary shared with the remote endpoint, may be nullptr
+        //! @param streaming        if true compression history is kept across packets, see class description
+        //! @param compressionLevel zstd compression level, only used if no dictionary is provided
+        ZstdCompressor(AZStd::shared_ptr<const ZstdDictionary> dictionary = nullptr, bool streaming = false, int32_t compressionLevel = ZSTD_CLEVEL_DEFAULT);
+        ~ZstdCompressor() override;
+
+        const char* GetName() const { return ZstdCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return ZstdCompressorType; };
+        bool RequiresOrderedDelivery() const override { return m_streaming; }
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+        //! Returns whether this compressor keeps compression history across packets.
+        bool IsStreaming() const { return m_streaming; }
+
+        //! Appends every packet passed to Compress() to a packet dump file that can later be used to train a dictionary.
+        //! Packets are buffered in memory and appended to the file in batches.
+        //! @param capturePath path of the packet dump to append to, an empty path disables capturing
+        void SetCapturePath(const AZ::IO::Path& capturePath);
+
+        //! Trains a dictionary from a set of sample packets.
+        //! @param samples           all sample packets, stored back to back
+        //! @param sampleSizes       size of each sample packet stored in samples
+        //! @param maxDictionarySize upper bound on the size of the trained dictionary
+        //! @return the trained dictionary, empty on failure
+        static AZStd::vector<uint8_t> TrainDictionary(const AZStd::vector<uint8_t>& samples, const AZStd::vector<size_t>& sampleSizes, size_t maxDictionarySize);
+
+        //! Appends a packet to a packet dump, packet dumps are a sequence of native endian uint32_t sizes each followed by that many bytes.
+        //! @param packetDump dump to append the packet to
+        //! @param packetData packet to append
+        //! @param packetSize size of the packet in bytes
+        static void AppendPacketDump(AZStd::vector<uint8_t>& packetDump, const void* packetData, size_t packetSize);
+
+        //! Splits a packet dump into the sample layout consumed by TrainDictionary.
+        //! @param packetDump  packet dump to parse
+        //! @param samples     receives all packets, stored back to back
+        //! @param sampleSizes receives the size of each packet
+        //! @return boolean true if the dump was well formed
+        static bool ParsePacketDump(const AZStd::vector<uint8_t>& packetDump, AZStd::vector<uint8_t>& samples, AZStd::vector<size_t>& sampleSizes);
+
+    private:
+        ZstdCompressor(const ZstdCompressor&) = delete;
+        ZstdCompressor& operator=(const ZstdCompressor&) = delete;
+
+        AzNetworking::CompressorError CompressStream(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize);
+        AzNetworking::CompressorError DecompressStream(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize);
+        void FlushCapture();
+
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        bool m_streaming = false;
+        int32_t m_compressionLevel = ZSTD_CLEVEL_DEFAULT;
+
+        ZSTD_CCtx* m_compressionContext = nullptr;
+        ZSTD_DCtx* m_decompressionContext = nullptr;
+        ZSTD_CStream* m_compressionStream = nullptr;
+        ZSTD_DStream* m_decompressionStream = nullptr;
+
+        AZ::IO::Path m_capturePath;
+        AZStd::vector<uint8_t> m_captureBuffer;
+    };
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <benchmark/benchmark.h>
+
+#include <LZ4Compressor.h>
+#include <ZstdCompressor.h>
+#include <PacketSampleGenerator.h>
+
+namespace Benchmark
+{
+    //! Every iteration compresses or decompresses a single packet, so the reported time is the cost per packet.
+    //! The Ratio counter is the uncompressed size over the compressed size across all packets processed.
+    class MultiplayerCompressionBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            UnitTest::PacketSampleGenerator trainingGenerator(1234);
+            trainingGenerator.Generate(TrainingPacketCount, m_trainingPackets, m_trainingPacketSizes);
+
+            UnitTest::PacketSampleGenerator testGenerator(5678);
+            testGenerator.Generate(TestPacketCount, m_testPackets, m_testPacketSizes);
+
+            m_packetOffsets.reserve(m_testPacketSizes.size());
+            size_t packetOffset = 0;
+            for (size_t packetSize : m_testPacketSizes)
+            {
+                m_packetOffsets.push_back(packetOffset);
+                packetOffset += packetSize;
+            }
+
+            const AZStd::vector<uint8_t> dictionary = MultiplayerCompression::ZstdCompressor::TrainDictionary(m_trainingPackets, m_trainingPacketSizes, DictionarySize);
+            m_dictionary = AZStd::make_shared<MultiplayerCompression::ZstdDictionary>(dictionary.data(), dictionary.size(), ZSTD_CLEVEL_DEFAULT);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_dictionary = nullptr;
+            m_trainingPackets = AZStd::vector<uint8_t>();
+            m_trainingPacketSizes = AZStd::vector<size_t>();
+            m_testPackets = AZStd::vector<uint8_t>();
+            m_testPacketSizes = AZStd::vector<size_t>();
+            m_packetOffsets = AZStd::vector<size_t>();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunCompress(benchmark::State& state, AzNetworking::ICompressor& compressor)
+        {
+            AZStd::vector<uint8_t> compressed(compressor.GetMaxCompressedBufferSize(AzNetworking::MaxUdpTransmissionUnit));
+            size_t packetIndex = 0;
+            size_t uncompressedBytes = 0;
+            size_t compressedBytes = 0;
+            for (auto _ : state)
+            {
+                const size_t packetSize = m_testPacketSizes[packetIndex];
+                size_t compressedSize = 0;
+                compressor.Compress(m_testPackets.data() + m_packetOffsets[packetIndex], packetSize, compressed.data(), compressed.size(), compressedSize);
+                benchmark::DoNotOptimize(compressed.data());
+
+                uncompressedBytes += packetSize;
+                compressedBytes += compressedSize;
+                packetIndex = (packetIndex + 1) % m_testPacketSizes.size();
+            }
+            state.SetItemsProcessed(state.iterations());
+            state.SetBytesProcessed(uncompressedBytes);
+            state.counters["Ratio"] = (compressedBytes > 0) ? static_cast<double>(uncompressedBytes) / static_cast<double>(compressedBytes) : 0.0;
+        }
+
+        void RunDecompress(benchmark::State& state, AzNetworking::ICompressor& compressor)
+        {
+            // Compress the whole test set up front, decompressing then cycles over the same packets
+            AZStd::vector<uint8_t> compressedPackets;
+            AZStd::vector<size_t> compressedOffsets;
+            AZStd::vector<size_t> compressedSizes;
+            AZStd::vector<uint8_t> compressed(compressor.GetMaxCompressedBufferSize(AzNetworking::MaxUdpTransmissionUnit));
+            for (size_t packetIndex = 0; packetIndex < m_testPacketSizes.size(); ++packetIndex)
+            {
+                size_t compressedSize = 0;
+                compressor.Compress(m_testPackets.data() + m_packetOffsets[packetIndex], m_testPacketSizes[packetIndex], compressed.data(), compressed.size(), compressedSize);
+                compressedOffsets.push_back(compressedPackets.size());
+                compressedSizes.push_back(compressedSize);
+                compressedPackets.insert(compressedPackets.end(), compressed.data(), compressed.data() + compressedSize);
+            }
+
+            AZStd::vector<uint8_t> decompressed(AzNetworking::MaxUdpTransmissionUnit);
+            size_t packetIndex = 0;
+            size_t uncompressedBytes = 0;
+            for (auto _ : state)
+            {
+                size_t consumedSize = 0;
+                size_t decompressedSize = 0;
+                compressor.Decompress(compressedPackets.data() + compressedOffsets[packetIndex], compressedSizes[packetIndex], decompressed.data(), decompressed.size(), consumedSize, decompressedSize);
+                benchmark::DoNotOptimize(decompressed.data());
+
+                uncompressedBytes += decompressedSize;
+                packetIndex = (packetIndex + 1) % compressedSizes.size();
+            }
+            state.SetItemsProcessed(state.iterations());
+            state.SetBytesProcessed(uncompressedBytes);
+        }
+
+        static constexpr uint32_t TrainingPacketCount = 2000;
+        static constexpr uint32_t TestPacketCount = 500;
+        static constexpr size_t DictionarySize = 4 * 1024;
+
+        AZStd::shared_ptr<const MultiplayerCompression::ZstdDictionary> m_dictionary;
+        AZStd::vector<uint8_t> m_trainingPackets;
+        AZStd::vector<size_t> m_trainingPacketSizes;
+        AZStd::vector<uint8_t> m_testPackets;
+        AZStd::vector<size_t> m_testPacketSizes;
+        AZStd::vector<size_t> m_packetOffsets;
+    };
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, LZ4_Compress)(benchmark::State& state)
+    {
+        MultiplayerCompression::LZ4Compressor compressor;
+        RunCompress(state, compressor);
+    }
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, LZ4_Compress)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, Zstd_Compress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor;
+        RunCompress(state, compressor);
+    }
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, Zstd_Compress)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, ZstdDictionary_Compress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor(m_dictionary);
+        RunCompress(state, compressor);
+    }
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, ZstdDictionary_Compress)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, ZstdStreaming_Compress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor(m_dictionary, true);
+        RunCompress(state, compressor);
+    }
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, ZstdStreaming_Compress)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, LZ4_Decompress)(benchmark::State& state)
+    {
+        MultiplayerCompression::LZ4Compressor compressor;
+        RunDecompress(state, compressor);
+    }
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, LZ4_Decompress)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(MultiplayerCompressionBenchmark, ZstdDictionary_Decompress)(benchmark::State& state)
+    {
+        MultiplayerCompression::ZstdCompressor compressor(m_dictionary);
+        RunDecompress(state, compressor);
+    }
+    BENCHMARK_REGISTER_F(MultiplayerCompressionBenchmark, ZstdDictionary_Decompress)->Unit(benchmark::kMicrosecond);
+}
+
+#endif
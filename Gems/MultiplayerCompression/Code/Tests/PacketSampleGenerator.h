@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+
+namespace UnitTest
+{
+    //! Generates packets shaped like entity replication updates, a handful of entities from a small pool each writing
+    //! slowly changing transforms and properties. Individual packets have little internal redundancy but share a lot of
+    //! structure with each other, which is the case dictionaries and streaming context are meant for.
+    class PacketSampleGenerator
+    {
+    public:
+        explicit PacketSampleGenerator(uint64_t seed)
+            : m_random(seed)
+        {
+            ;
+        }
+
+        //! Generates packetCount packets, stored back to back with their sizes recorded separately.
+        void Generate(uint32_t packetCount, AZStd::vector<uint8_t>& packets, AZStd::vector<size_t>& packetSizes)
+        {
+            for (uint32_t packetIndex = 0; packetIndex < packetCount; ++packetIndex)
+            {
+                AzNetworking::UdpPacketEncodingBuffer buffer;
+                AzNetworking::NetworkInputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+
+                uint32_t sequence = m_sequence++;
+                uint16_t entityCount = static_cast<uint16_t>(3 + m_random.GetRandom() % 6);
+                serializer.Serialize(sequence, "Sequence");
+                serializer.Serialize(entityCount, "EntityCount");
+                for (uint16_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+                {
+                    uint32_t netEntityId = 1000 + m_random.GetRandom() % EntityPoolSize;
+                    uint32_t dirtyBits = (m_random.GetRandom() % 4 == 0) ? 0x0000001F : 0x00000007;
+                    float positionX = 512.0f + static_cast<float>(netEntityId % 32) + static_cast<float>(sequence % 64) * 0.25f;
+                    float positionY = 256.0f - static_cast<float>(netEntityId % 16);
+                    float positionZ = 32.0f;
+                    uint16_t yaw = static_cast<uint16_t>((netEntityId * 97 + sequence * 3) & 0x3FF);
+                    uint16_t health = 100;
+                    uint8_t animationState = static_cast<uint8_t>(m_random.GetRandom() % 4);
+                    serializer.Serialize(netEntityId, "NetEntityId");
+                    serializer.Serialize(dirtyBits, "DirtyBits");
+                    serializer.Serialize(positionX, "PositionX");
+                    serializer.Serialize(positionY, "PositionY");
+                    serializer.Serialize(positionZ, "PositionZ");
+                    serializer.Serialize(yaw, "Yaw");
+                    serializer.Serialize(health, "Health");
+                    serializer.Serialize(animationState, "AnimationState");
+                }
+
+                packets.insert(packets.end(), buffer.GetBuffer(), buffer.GetBuffer() + serializer.GetSize());
+                packetSizes.push_back(serializer.GetSize());
+            }
+        }
+
+    private:
+        static constexpr uint32_t EntityPoolSize = 64;
+
+        AZ::SimpleLcgRandom m_random;
+        uint32_t m_sequence = 0;
+    };
+}
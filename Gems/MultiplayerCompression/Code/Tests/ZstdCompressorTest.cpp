@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzTest/AzTest.h>
+
+#include <ZstdCompressor.h>
+#include <PacketSampleGenerator.h>
+
+class ZstdCompressorTest
+    : public UnitTest::AllocatorsTestFixture
+{
+protected:
+
+    void SetUp() override
+    {
+        AllocatorsTestFixture::SetUp();
+
+        UnitTest::PacketSampleGenerator trainingGenerator(1234);
+        trainingGenerator.Generate(TrainingPacketCount, m_trainingPackets, m_trainingPacketSizes);
+
+        UnitTest::PacketSampleGenerator testGenerator(5678);
+        testGenerator.Generate(TestPacketCount, m_testPackets, m_testPacketSizes);
+    }
+
+    void TearDown() override
+    {
+        m_trainingPackets = AZStd::vector<uint8_t>();
+        m_trainingPacketSizes = AZStd::vector<size_t>();
+        m_testPackets = AZStd::vector<uint8_t>();
+        m_testPacketSizes = AZStd::vector<size_t>();
+        AllocatorsTestFixture::TearDown();
+    }
+
+    AZStd::shared_ptr<const MultiplayerCompression::ZstdDictionary> TrainDictionary()
+    {
+        const AZStd::vector<uint8_t> dictionaryData = MultiplayerCompression::ZstdCompressor::TrainDictionary(m_trainingPackets, m_trainingPacketSizes, DictionarySize);
+        EXPECT_FALSE(dictionaryData.empty());
+        EXPECT_LE(dictionaryData.size(), DictionarySize);
+        return AZStd::make_shared<MultiplayerCompression::ZstdDictionary>(dictionaryData.data(), dictionaryData.size(), ZSTD_CLEVEL_DEFAULT);
+    }
+
+    //! Sends every test packet from sender to receiver in order and returns the total compressed size
+    size_t RoundTripTestPackets(MultiplayerCompression::ZstdCompressor& sender, MultiplayerCompression::ZstdCompressor& receiver)
+    {
+        AZStd::vector<uint8_t> compressed(sender.GetMaxCompressedBufferSize(AzNetworking::MaxUdpTransmissionUnit));
+        AZStd::vector<uint8_t> decompressed(AzNetworking::MaxUdpTransmissionUnit);
+
+        size_t totalCompressedSize = 0;
+        const uint8_t* packet = m_testPackets.data();
+        for (size_t packetSize : m_testPacketSizes)
+        {
+            size_t compressedSize = 0;
+            EXPECT_EQ(sender.Compress(packet, packetSize, compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+
+            size_t consumedSize = 0;
+            size_t decompressedSize = 0;
+            EXPECT_EQ(receiver.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, decompressedSize), AzNetworking::CompressorError::Ok);
+            EXPECT_EQ(consumedSize, compressedSize);
+            EXPECT_EQ(decompressedSize, packetSize);
+            EXPECT_EQ(memcmp(packet, decompressed.data(), packetSize), 0);
+
+            totalCompressedSize += compressedSize;
+            packet += packetSize;
+        }
+        return totalCompressedSize;
+    }
+
+    static constexpr uint32_t TrainingPacketCount = 2000;
+    static constexpr uint32_t TestPacketCount = 200;
+    static constexpr size_t DictionarySize = 4 * 1024;
+
+    AZStd::vector<uint8_t> m_trainingPackets;
+    AZStd::vector<size_t> m_trainingPacketSizes;
+    AZStd::vector<uint8_t> m_testPackets;
+    AZStd::vector<size_t> m_testPacketSizes;
+};
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_RoundTripWithoutDictionary)
+{
+    MultiplayerCompression::ZstdCompressor compressor;
+    EXPECT_TRUE(compressor.Init());
+    EXPECT_FALSE(compressor.IsStreaming());
+    EXPECT_FALSE(compressor.RequiresOrderedDelivery());
+    RoundTripTestPackets(compressor, compressor);
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_DictionaryImprovesRatio)
+{
+    MultiplayerCompression::ZstdCompressor plainCompressor;
+    const size_t plainSize = RoundTripTestPackets(plainCompressor, plainCompressor);
+
+    auto dictionary = TrainDictionary();
+    ASSERT_TRUE(dictionary->IsValid());
+    MultiplayerCompression::ZstdCompressor dictionaryCompressor(dictionary);
+    const size_t dictionarySize = RoundTripTestPackets(dictionaryCompressor, dictionaryCompressor);
+
+    EXPECT_LT(dictionarySize, plainSize);
+    EXPECT_LT(dictionarySize, m_testPackets.size());
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_StreamingImprovesRatio)
+{
+    MultiplayerCompression::ZstdCompressor plainCompressor;
+    const size_t plainSize = RoundTripTestPackets(plainCompressor, plainCompressor);
+
+    MultiplayerCompression::ZstdCompressor streamSender(nullptr, true);
+    MultiplayerCompression::ZstdCompressor streamReceiver(nullptr, true);
+    EXPECT_TRUE(streamSender.IsStreaming());
+    EXPECT_TRUE(streamSender.RequiresOrderedDelivery());
+    const size_t streamingSize = RoundTripTestPackets(streamSender, streamReceiver);
+
+    EXPECT_LT(streamingSize, plainSize);
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_StreamingWithDictionary)
+{
+    auto dictionary = TrainDictionary();
+    MultiplayerCompression::ZstdCompressor streamSender(dictionary, true);
+    MultiplayerCompression::ZstdCompressor streamReceiver(dictionary, true);
+    RoundTripTestPackets(streamSender, streamReceiver);
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_MismatchedDictionaryTest)
+{
+    MultiplayerCompression::ZstdCompressor dictionaryCompressor(TrainDictionary());
+    MultiplayerCompression::ZstdCompressor plainCompressor;
+
+    AZStd::vector<uint8_t> compressed(dictionaryCompressor.GetMaxCompressedBufferSize(m_testPacketSizes[0]));
+    AZStd::vector<uint8_t> decompressed(AzNetworking::MaxUdpTransmissionUnit);
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t decompressedSize = 0;
+    EXPECT_EQ(dictionaryCompressor.Compress(m_testPackets.data(), m_testPacketSizes[0], compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(plainCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, decompressedSize), AzNetworking::CompressorError::CorruptData);
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_UndersizeTest)
+{
+    MultiplayerCompression::ZstdCompressor compressor;
+    uint8_t compressed[4];
+    size_t compressedSize = 0;
+    EXPECT_EQ(compressor.Compress(m_testPackets.data(), m_testPacketSizes[0], compressed, sizeof(compressed), compressedSize), AzNetworking::CompressorError::InsufficientBuffer);
+
+    AZStd::vector<uint8_t> validCompressed(compressor.GetMaxCompressedBufferSize(m_testPacketSizes[0]));
+    EXPECT_EQ(compressor.Compress(m_testPackets.data(), m_testPacketSizes[0], validCompressed.data(), validCompressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+
+    uint8_t decompressed[4];
+    size_t consumedSize = 0;
+    size_t decompressedSize = 0;
+    EXPECT_EQ(compressor.Decompress(validCompressed.data(), compressedSize, decompressed, sizeof(decompressed), consumedSize, decompressedSize), AzNetworking::CompressorError::InsufficientBuffer);
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_NullTest)
+{
+    MultiplayerCompression::ZstdCompressor compressor;
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t decompressedSize = 0;
+    EXPECT_EQ(compressor.Compress(nullptr, 4, nullptr, 4, compressedSize), AzNetworking::CompressorError::Uninitialized);
+    EXPECT_EQ(compressor.Decompress(nullptr, 4, nullptr, 4, consumedSize, decompressedSize), AzNetworking::CompressorError::Uninitialized);
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_PacketDumpTest)
+{
+    AZStd::vector<uint8_t> packetDump;
+    const uint8_t* packet = m_testPackets.data();
+    for (size_t packetSize : m_testPacketSizes)
+    {
+        MultiplayerCompression::ZstdCompressor::AppendPacketDump(packetDump, packet, packetSize);
+        packet += packetSize;
+    }
+
+    AZStd::vector<uint8_t> samples;
+    AZStd::vector<size_t> sampleSizes;
+    EXPECT_TRUE(MultiplayerCompression::ZstdCompressor::ParsePacketDump(packetDump, samples, sampleSizes));
+    EXPECT_EQ(samples, m_testPackets);
+    EXPECT_EQ(sampleSizes, m_testPacketSizes);
+
+    packetDump.pop_back();
+    EXPECT_FALSE(MultiplayerCompression::ZstdCompressor::ParsePacketDump(packetDump, samples, sampleSizes));
+}
@@ -7,5 +7,8 @@
 #
 
 set(FILES
+    Tests/MultiplayerCompressionBenchmarks.cpp
     Tests/MultiplayerCompressionTest.cpp
+    Tests/PacketSampleGenerator.h
+    Tests/ZstdCompressorTest.cpp
 )
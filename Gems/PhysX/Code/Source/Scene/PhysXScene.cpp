@@ -8,6 +8,11 @@
 #include <Scene/PhysXScene.h>
 
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -41,6 +46,32 @@ namespace PhysX
 
     namespace Internal
     {
+        //! Minimum number of requests processed by a single job when a scene query batch is split across the job threads.
+        static constexpr size_t SceneQueryBatchRequestsPerJob = 32;
+
+        //! Returns the number of ranges a batch of scene queries should be split into, including the range processed by the calling thread.
+        size_t GetSceneQueryBatchJobCount(size_t requestCount)
+        {
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            if (jobContext == nullptr)
+            {
+                return 1;
+            }
+            const size_t maxJobCount = aznumeric_cast<size_t>(jobContext->GetJobManager().GetNumWorkerThreads()) + 1;
+            const size_t jobCount = (requestCount + SceneQueryBatchRequestsPerJob - 1) / SceneQueryBatchRequestsPerJob;
+            return AZStd::clamp<size_t>(jobCount, 1, maxJobCount);
+        }
+
+        //! State shared by the jobs executing a single asynchronous scene query batch.
+        struct AsyncSceneQueryBatch
+        {
+            AzPhysics::SceneQuery::AsyncRequestId m_requestId;
+            AzPhysics::SceneQuery::AsyncBatchCallback m_callback;
+            AzPhysics::SceneQueryRequests m_requests;
+            AzPhysics::SceneQueryHitsList m_results;
+            AZStd::atomic<size_t> m_remainingJobs{ 0 };
+        };
+
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
             SceneSimulationFilterCallback* filterCallback,
             SceneSimulationEventCallback* simEventCallback)
@@ -494,6 +525,14 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // Asynchronous scene queries still running reference the scene, wait for them to complete.
+        // Their callbacks are not issued as the scene is going away.
+        while (m_pendingAsyncSceneQueries > 0)
+        {
+            AZStd::this_thread::yield();
+        }
+        m_asyncSceneQueryCallbacks.clear();
+
         s_overlapBuffer.swap({});
         s_rayCastBuffer.swap({});
         s_sweepBuffer.swap({});
@@ -552,6 +591,8 @@ namespace PhysX
     {
         AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
 
+        DispatchAsyncSceneQueryCallbacks();
+
         if (!IsEnabled())
         {
             return;
@@ -950,27 +991,146 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        AzPhysics::SceneQueryHitsList results(requests.size());
+        const size_t jobCount = Internal::GetSceneQueryBatchJobCount(requests.size());
+        if (jobCount <= 1)
         {
-            results.emplace_back(QueryScene(request.get()));
+            QuerySceneRange(requests, results, 0, requests.size());
+            return results;
         }
+
+        // Scene queries only require the scene read lock and use thread local hit buffers, so the batch is split across the job threads.
+        // The calling thread processes the first range instead of idling while it waits on the jobs.
+        const size_t requestsPerJob = (requests.size() + jobCount - 1) / jobCount;
+        AZ::JobCompletion jobCompletion;
+        for (size_t begin = requestsPerJob; begin < requests.size(); begin += requestsPerJob)
+        {
+            const size_t end = AZStd::min(begin + requestsPerJob, requests.size());
+            AZ::Job* queryJob = AZ::CreateJobFunction([this, &requests, &results, begin, end]()
+                {
+                    QuerySceneRange(requests, results, begin, end);
+                }, true);
+            queryJob->SetDependent(&jobCompletion);
+            queryJob->Start();
+        }
+        QuerySceneRange(requests, results, 0, requestsPerJob);
+        jobCompletion.StartAndWaitForCompletion();
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        auto queryFunction = [this, requestId, request, callback = AZStd::move(callback)]()
+        {
+            AzPhysics::SceneQueryHits hits = QueryScene(request);
+            QueueAsyncSceneQueryCallback([requestId, callback, hits = AZStd::move(hits)]()
+                {
+                    callback(requestId, hits);
+                });
+        };
+
+        m_pendingAsyncSceneQueries++;
+        if (AZ::JobContext::GetGlobalContext() == nullptr)
+        {
+            // No job threads to run on, the callback is still deferred until FinishSimulation
+            queryFunction();
+            return true;
+        }
+        AZ::CreateJobFunction(AZStd::move(queryFunction), true)->Start();
+        return true;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (!callback)
+        {
+            return false;
+        }
+
+        // The requests are shared pointers, so holding on to a copy of the list keeps them alive until the jobs complete
+        auto batch = AZStd::make_shared<Internal::AsyncSceneQueryBatch>();
+        batch->m_requestId = requestId;
+        batch->m_callback = AZStd::move(callback);
+        batch->m_requests = requests;
+        batch->m_results.resize(requests.size());
+
+        const size_t jobCount = Internal::GetSceneQueryBatchJobCount(requests.size());
+        const size_t requestsPerJob = AZStd::max<size_t>((requests.size() + jobCount - 1) / jobCount, 1);
+        batch->m_remainingJobs = jobCount;
+
+        auto queryFunction = [this, batch](size_t begin, size_t end)
+        {
+            QuerySceneRange(batch->m_requests, batch->m_results, begin, end);
+            if (--batch->m_remainingJobs == 0)
+            {
+                // The last job to complete hands the results over to the callback
+                QueueAsyncSceneQueryCallback([batch]()
+                    {
+                        batch->m_callback(batch->m_requestId, AZStd::move(batch->m_results));
+                    });
+            }
+        };
+
+        m_pendingAsyncSceneQueries++;
+        if (AZ::JobContext::GetGlobalContext() == nullptr)
+        {
+            // No job threads to run on, the callback is still deferred until FinishSimulation
+            queryFunction(0, requests.size());
+            return true;
+        }
+        for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+        {
+            const size_t begin = AZStd::min(jobIndex * requestsPerJob, requests.size());
+            const size_t end = AZStd::min(begin + requestsPerJob, requests.size());
+            AZ::CreateJobFunction([queryFunction, begin, end]()
+                {
+                    queryFunction(begin, end);
+                }, true)->Start();
+        }
+        return true;
+    }
+
+    void PhysXScene::QuerySceneRange(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results, size_t begin, size_t end)
+    {
+        // The individual queries take the read lock again, which is cheap as PhysX read locks are reentrant on the owning thread
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+        for (size_t i = begin; i < end; ++i)
+        {
+            results[i] = QueryScene(requests[i].get());
+        }
+    }
+
+    void PhysXScene::QueueAsyncSceneQueryCallback(AZStd::function<void()>&& callback)
+    {
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+            m_asyncSceneQueryCallbacks.emplace_back(AZStd::move(callback));
+        }
+        // The scene may be destroyed as soon as the last pending query completes, so this must be the last access to it
+        m_pendingAsyncSceneQueries--;
+    }
+
+    void PhysXScene::DispatchAsyncSceneQueryCallbacks()
+    {
+        AZStd::vector<AZStd::function<void()>> callbacks;
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+            callbacks.swap(m_asyncSceneQueryCallbacks);
+        }
+
+        for (AZStd::function<void()>& callback : callbacks)
+        {
+            callback();
+        }
     }
 
     void PhysXScene::SuppressCollisionEvents(
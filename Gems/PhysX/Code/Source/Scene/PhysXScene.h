@@ -12,6 +12,9 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
@@ -28,6 +31,9 @@ namespace physx
 namespace PhysX
 {
     //! PhysX implementation of the AzPhysics::Scene.
+    //! Batched scene queries are split across the job threads, each job holding the scene read lock for its range of requests.
+    //! Asynchronous scene queries run on the job threads and their callbacks are issued from FinishSimulation,
+    //! on the thread that updates the scene.
     class PhysXScene
         : public AzPhysics::Scene
     {
@@ -90,6 +96,13 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        //! Executes the requests in the range [begin, end) and stores the results at the same indices, holding the scene read lock once.
+        void QuerySceneRange(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results, size_t begin, size_t end);
+
+        //! Queues the callback of a completed asynchronous scene query to be issued on the next FinishSimulation.
+        void QueueAsyncSceneQueryCallback(AZStd::function<void()>&& callback);
+        void DispatchAsyncSceneQueryCallbacks();
+
         bool m_isEnabled = true;
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
@@ -118,5 +131,9 @@ namespace PhysX
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
+
+        AZStd::mutex m_asyncSceneQueryMutex; //!< Guards the completed asynchronous scene query callbacks.
+        AZStd::vector<AZStd::function<void()>> m_asyncSceneQueryCallbacks; //!< Callbacks of completed asynchronous scene queries, waiting to be issued.
+        AZStd::atomic<AZ::u32> m_pendingAsyncSceneQueries{ 0 }; //!< Number of asynchronous scene queries which have not completed yet.
     };
 }
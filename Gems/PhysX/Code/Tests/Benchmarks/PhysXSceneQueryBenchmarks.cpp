@@ -13,6 +13,8 @@
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <Tests/PhysXGenericTestFixture.h>
 #include <Tests/PhysXTestCommon.h>
 #include <Benchmarks/PhysXBenchmarksCommon.h>
@@ -226,6 +228,88 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        // One ray towards every box, issued as a single batch
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(m_numBoxes);
+        for (const AZ::Vector3& box : m_boxes)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = box.GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            auto start = std::chrono::system_clock::now();
+
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            auto timeElasped = std::chrono::nanoseconds(std::chrono::system_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(results);
+        }
+        state.SetItemsProcessed(state.iterations() * m_numBoxes);
+
+        //get the P50, P90, P99 percentiles of each batch and the standard deviation and mean
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchRandomBoxes)(benchmark::State& state)
+    {
+        // One ray towards every box, issued as a single asynchronous batch
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(m_numBoxes);
+        for (const AZ::Vector3& box : m_boxes)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = box.GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* scene = AZ::Interface<AzPhysics::SystemInterface>::Get()->GetScene(m_testSceneHandle);
+
+        for (auto _ : state)
+        {
+            bool completed = false;
+            auto start = std::chrono::system_clock::now();
+
+            const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 0, requests,
+                [&completed](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList results)
+                {
+                    benchmark::DoNotOptimize(results);
+                    completed = true;
+                });
+
+            // Callbacks are issued when the scene finishes simulating, so the measured time includes a scene update
+            while (queued && !completed)
+            {
+                scene->StartSimulation(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+                scene->FinishSimulation();
+            }
+
+            auto timeElasped = std::chrono::nanoseconds(std::chrono::system_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+        }
+        state.SetItemsProcessed(state.iterations() * m_numBoxes);
+
+        //get the P50, P90, P99 percentiles of each batch and the standard deviation and mean
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -250,5 +334,21 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[1])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[2])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[1])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[2])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
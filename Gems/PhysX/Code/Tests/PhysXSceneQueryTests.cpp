@@ -7,6 +7,8 @@
  */
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1009,4 +1011,134 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_MatchesIndividualQueries)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup a ring of bodies, large enough that the batch is split across multiple jobs
+        constexpr AZ::u32 NumBodies = 16;
+        constexpr AZ::u32 NumRequests = 512;
+        for (AZ::u32 i = 0; i < NumBodies; i++)
+        {
+            const float angle = AZ::Constants::TwoPi * aznumeric_cast<float>(i) / aznumeric_cast<float>(NumBodies);
+            TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(AZ::Cos(angle), AZ::Sin(angle), 0.0f) * 20.0f, 2.0f);
+        }
+
+        //create raycast requests in every direction around the ring, some of which will miss
+        AzPhysics::SceneQueryRequests requests;
+        for (AZ::u32 i = 0; i < NumRequests; i++)
+        {
+            const float angle = AZ::Constants::TwoPi * aznumeric_cast<float>(i) / aznumeric_cast<float>(NumRequests);
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = AZ::Vector3(AZ::Cos(angle), AZ::Sin(angle), 0.0f);
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //each result should be in the same order as the requests and match running the request on its own
+        ASSERT_EQ(results.size(), requests.size());
+        size_t numHits = 0;
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            AzPhysics::SceneQueryHits expected = sceneInterface->QueryScene(m_testSceneHandle, requests[i].get());
+            ASSERT_EQ(results[i].m_hits.size(), expected.m_hits.size());
+            if (expected)
+            {
+                EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == expected.m_hits[0].m_bodyHandle);
+                numHits++;
+            }
+        }
+        EXPECT_GT(numHits, 0);
+        EXPECT_LT(numHits, results.size());
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackIssuedOnFinishSimulation)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX();
+        request.m_distance = 200.0f;
+
+        constexpr AzPhysics::SceneQuery::AsyncRequestId RequestId = 42;
+        bool callbackCalled = false;
+        AzPhysics::SceneQueryHits result;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, RequestId, &request,
+            [&callbackCalled, &result](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+            {
+                EXPECT_EQ(requestId, RequestId);
+                result = AZStd::move(hits);
+                callbackCalled = true;
+            });
+        ASSERT_TRUE(queued);
+
+        //the callback is only issued when the scene is updated, once the query has completed
+        for (AZ::u32 i = 0; i < 1000 && !callbackCalled; i++)
+        {
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        ASSERT_TRUE(callbackCalled);
+        ASSERT_EQ(result.m_hits.size(), 1);
+        EXPECT_TRUE(result.m_hits[0].m_bodyHandle == sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallbackIssuedWithAllResults)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = pos.GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        constexpr AzPhysics::SceneQuery::AsyncRequestId RequestId = 7;
+        bool callbackCalled = false;
+        AzPhysics::SceneQueryHitsList results;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, RequestId, requests,
+            [&callbackCalled, &results](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                EXPECT_EQ(requestId, RequestId);
+                results = AZStd::move(hits);
+                callbackCalled = true;
+            });
+        ASSERT_TRUE(queued);
+
+        for (AZ::u32 i = 0; i < 1000 && !callbackCalled; i++)
+        {
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        ASSERT_TRUE(callbackCalled);
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
 }
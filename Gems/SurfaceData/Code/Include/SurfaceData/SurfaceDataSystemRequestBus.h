@@ -38,6 +38,8 @@ namespace SurfaceData
         // Get all surface points for every input position within an AABB region.  Only the XY dimensions of the AABB region are used.
         // The input positions are chosen by starting at the min sides of inRegion and incrementing by stepSize.  This method is inclusive
         // on the min sides of the AABB, and exclusive on the max sides (i.e. for a box of (0,0) - (4,4), the point (0,0) is included but (4,4) isn't).
+        // Providers and modifiers are queried from the calling thread, after which the points of large regions get combined, sorted and
+        // filtered in parallel tiles.  The output order is the same regardless of how the region got split up.
         virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
                                                 SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
 
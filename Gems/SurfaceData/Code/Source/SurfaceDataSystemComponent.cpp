@@ -7,10 +7,13 @@
  */
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 
 #include "SurfaceDataSystemComponent.h"
 #include <SurfaceData/SurfaceDataConstants.h>
@@ -23,6 +26,15 @@
 
 namespace SurfaceData
 {
+    namespace
+    {
+        // The minimum number of positions in a region tile, so that splitting up a region query doesn't cost more than it saves.
+        constexpr size_t MinPositionsPerRegionTile = 256;
+        // The maximum number of tiles the points of a region query get split into.  This isn't tied to the number of task workers, since having
+        // more tiles than workers lets the workers that finish early pick up the remaining tiles.
+        constexpr size_t MaxRegionTiles = 64;
+    }
+
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SurfaceTag::Reflect(context);
@@ -184,52 +196,67 @@ namespace SurfaceData
         AZ_PROFILE_FUNCTION(Entity);
 
         const bool hasDesiredTags = HasValidTags(desiredTags);
-        const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+        // Gather the providers and modifiers at the position first, and release the registration lock before querying them, since
+        // they are free to make surface data requests of their own.
+        SurfaceDataRegistryBoundsList providers;
+        SurfaceDataRegistryBoundsList modifiers;
+        {
+            AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
 
-        surfacePointList.clear();
+            const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-        //gather all intersecting points
-        for (const auto& entryPair : m_registeredSurfaceDataProviders)
-        {
-            const AZ::u32 entryAddress = entryPair.first;
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            AZ::Vector3 point2d(inPosition.GetX(), inPosition.GetY(), entry.m_bounds.GetMax().GetZ());
-            if (!entry.m_bounds.IsValid() || entry.m_bounds.Contains(point2d))
+            for (const auto& entryPair : m_registeredSurfaceDataProviders)
             {
-                if (!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags))
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                if (!entry.m_bounds.IsValid() || AabbContains2D(entry.m_bounds, inPosition))
                 {
-                    SurfaceDataProviderRequestBus::Event(entryAddress, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point2d, surfacePointList);
+                    if (!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags))
+                    {
+                        providers.emplace_back(entryPair.first, entry.m_bounds);
+                    }
                 }
             }
-        }
 
-        if (!surfacePointList.empty())
-        {
-            //modify or annotate reported points
             for (const auto& entryPair : m_registeredSurfaceDataModifiers)
             {
-                const AZ::u32 entryAddress = entryPair.first;
                 const SurfaceDataRegistryEntry& entry = entryPair.second;
-                AZ::Vector3 point2d(inPosition.GetX(), inPosition.GetY(), entry.m_bounds.GetMax().GetZ());
-                if (!entry.m_bounds.IsValid() || entry.m_bounds.Contains(point2d))
+                if (!entry.m_bounds.IsValid() || AabbContains2D(entry.m_bounds, inPosition))
                 {
-                    SurfaceDataModifierRequestBus::Event(entryAddress, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
+                    modifiers.emplace_back(entryPair.first, entry.m_bounds);
                 }
             }
-            
+        }
+
+        surfacePointList.clear();
+
+        //gather all intersecting points
+        for (const auto& [entryAddress, entryBounds] : providers)
+        {
+            AZ::Vector3 point2d(inPosition.GetX(), inPosition.GetY(), entryBounds.GetMax().GetZ());
+            SurfaceDataProviderRequestBus::Event(entryAddress, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point2d, surfacePointList);
+        }
+
+        if (!surfacePointList.empty())
+        {
+            //modify or annotate reported points
+            for (const auto& [entryAddress, entryBounds] : modifiers)
+            {
+                SurfaceDataModifierRequestBus::Event(entryAddress, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
+            }
+
             // After we've finished creating and annotating all the surface points, combine any points together that have effectively the
             // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
             // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
             // doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
-            CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags);
+            SurfacePointList targetPointList;
+            CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags, targetPointList);
         }
     }
 
     void SurfaceDataSystemComponent::GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const
     {
-        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+        AZ_PROFILE_FUNCTION(Entity);
 
         surfacePointListPerPosition.clear();
         surfacePointListPerPosition.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
@@ -245,29 +272,115 @@ namespace SurfaceData
         }
 
         const bool hasDesiredTags = HasValidTags(desiredTags);
-        const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-        // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
-        for (const auto& entryPair : m_registeredSurfaceDataProviders)
+        // Check the tags and the overall AABB bounds of each provider and modifier just once for the entire region, instead of once
+        // per point.  The registration lock is released before querying them, since they are free to make surface data requests
+        // of their own.
+        SurfaceDataRegistryBoundsList providers;
+        SurfaceDataRegistryBoundsList modifiers;
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool alwaysApplies = !entry.m_bounds.IsValid();
+            AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
+            const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-            if ((!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags)) &&
-                ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
-                )
+            for (const auto& entryPair : m_registeredSurfaceDataProviders)
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                if ((!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags)) &&
+                    (!entry.m_bounds.IsValid() || AabbOverlaps2D(entry.m_bounds, inRegion)))
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                    if (alwaysApplies || entry.m_bounds.Contains(point3d))
-                    {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
-                    }
+                    providers.emplace_back(entryPair.first, entry.m_bounds);
+                }
+            }
+
+            for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+            {
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                if (!entry.m_bounds.IsValid() || AabbOverlaps2D(entry.m_bounds, inRegion))
+                {
+                    modifiers.emplace_back(entryPair.first, entry.m_bounds);
+                }
+            }
+        }
+
+        if (providers.empty())
+        {
+            return;
+        }
+
+        // Query the providers and modifiers for every position on this thread.  They may make surface data requests of their own
+        // (e.g. a modifier that samples a gradient), so they're only ever queried while this thread holds the bus lock, which keeps
+        // the lock order of the surface data system bus before the provider and modifier buses.
+        const size_t numPositions = surfacePointListPerPosition.size();
+        QueryRegionProvidersAndModifiers(surfacePointListPerPosition, providers, modifiers);
+
+        // Every tile combines, sorts and filters its own range of the output list with its own scratch list, so the tiles don't need
+        // to synchronize, and the output ends up in the same order as a serial query.  This doesn't touch any bus, so the tiles are
+        // free to run on the task workers while this thread keeps holding the bus lock.
+        auto processTile = [&](size_t tileStart, size_t tileEnd)
+        {
+            SurfacePointList targetPointList;
+            CombineSortAndFilterRegionTile(
+                surfacePointListPerPosition.begin() + tileStart, surfacePointListPerPosition.begin() + tileEnd,
+                hasDesiredTags, desiredTags, targetPointList);
+        };
+
+        const size_t numTiles = GetRegionTileCount(numPositions);
+        if (numTiles <= 1)
+        {
+            processTile(0, numPositions);
+            return;
+        }
+
+        // Split the positions into tiles of consecutive positions, and process the tiles in parallel.
+        static const AZ::TaskDescriptor regionTileTaskDescriptor{ "SurfaceDataSystemComponent::CombineSortAndFilterRegionTile", "SurfaceData" };
+        AZ::TaskGraph taskGraph;
+        const size_t positionsPerTile = (numPositions + numTiles - 1) / numTiles;
+        for (size_t tileStart = 0; tileStart < numPositions; tileStart += positionsPerTile)
+        {
+            const size_t tileEnd = AZStd::min(tileStart + positionsPerTile, numPositions);
+            taskGraph.AddTask(regionTileTaskDescriptor, [&processTile, tileStart, tileEnd]()
+            {
+                processTile(tileStart, tileEnd);
+            });
+        }
+
+        AZ::TaskGraphEvent regionTilesEvent;
+        taskGraph.Submit(&regionTilesEvent);
+        regionTilesEvent.Wait();
+    }
+
+    size_t SurfaceDataSystemComponent::GetRegionTileCount(size_t numPositions)
+    {
+        // Queries made from within a task are processed serially, since waiting on the tiles would block the worker thread.
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (!taskGraphActiveInterface || !taskGraphActiveInterface->IsTaskGraphActive() ||
+            AZ::TaskExecutor::Instance().GetWorkerIndex() != AZ::TaskExecutor::InvalidWorkerIndex)
+        {
+            return 1;
+        }
+
+        // Only split the region up when it's large enough to be worth the task overhead.
+        return AZStd::clamp(numPositions / MinPositionsPerRegionTile, size_t(1), MaxRegionTiles);
+    }
+
+    void SurfaceDataSystemComponent::QueryRegionProvidersAndModifiers(
+        SurfacePointListPerPosition& surfacePointListPerPosition,
+        const SurfaceDataRegistryBoundsList& providers, const SurfaceDataRegistryBoundsList& modifiers) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Loop through each data provider, and query all the points for each one.  This allows for an eventual optimization in which
+        // we could send the list of points directly into each SurfaceDataProvider.
+        for (const auto& [entryAddress, entryBounds] : providers)
+        {
+            const bool alwaysApplies = !entryBounds.IsValid();
+            for (auto& [point2d, surfacePointList] : surfacePointListPerPosition)
+            {
+                AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entryBounds.GetMax().GetZ());
+                if (alwaysApplies || entryBounds.Contains(point3d))
+                {
+                    SurfaceDataProviderRequestBus::Event(entryAddress, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
                 }
             }
         }
@@ -277,44 +390,45 @@ namespace SurfaceData
         // create new surface points, but surface data *modifiers* simply annotate points that have already been created.  The modifiers
         // are used to annotate points that occur within a volume.  A common example is marking points as "underwater" for points that occur
         // within a water volume.
-        for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+        for (const auto& [entryAddress, entryBounds] : modifiers)
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool alwaysApplies = !entry.m_bounds.IsValid();
-
-            if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
+            const bool alwaysApplies = !entryBounds.IsValid();
+            for (auto& [point2d, surfacePointList] : surfacePointListPerPosition)
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                if (!surfacePointList.empty())
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
+                    AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entryBounds.GetMax().GetZ());
+                    if (alwaysApplies || entryBounds.Contains(point3d))
                     {
-                        AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                        if (alwaysApplies || entry.m_bounds.Contains(point3d))
-                        {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
-                        }
+                        SurfaceDataModifierRequestBus::Event(entryAddress, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
                     }
                 }
             }
         }
+    }
+
+    void SurfaceDataSystemComponent::CombineSortAndFilterRegionTile(
+        SurfacePointListPerPosition::iterator tileBegin, SurfacePointListPerPosition::iterator tileEnd,
+        bool hasDesiredTags, const SurfaceTagVector& desiredTags, SurfacePointList& targetPointList) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
         // After we've finished creating and annotating all the surface points, combine any points together that have effectively the
         // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
         // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
         // doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
-        for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+        for (auto it = tileBegin; it != tileEnd; ++it)
         {
-            auto& surfacePointList = surfacePointListAndPoint.second;
+            auto& surfacePointList = it->second;
             if (!surfacePointList.empty())
             {
-                CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags);
+                CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags, targetPointList);
             }
         }
     }
 
-    void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const
+    void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(
+        SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags, SurfacePointList& targetPointList) const
     {
         AZ_PROFILE_FUNCTION(Entity);
 
@@ -339,8 +453,8 @@ namespace SurfaceData
         size_t targetPointIndex = 0;
         size_t sourcePointIndex = 0;
 
-        m_targetPointList.clear();
-        m_targetPointList.reserve(sourcePointCount);
+        targetPointList.clear();
+        targetPointList.reserve(sourcePointCount);
 
         // Locate the first point that matches our desired tags, if one exists.
         for (sourcePointIndex = 0; sourcePointIndex < sourcePointCount; sourcePointIndex++)
@@ -354,7 +468,7 @@ namespace SurfaceData
         if (sourcePointIndex < sourcePointCount)
         {
             // We found a point that matches our tags, so add it to our target list as the first point.
-            m_targetPointList.push_back(sourcePointList[sourcePointIndex++]);
+            targetPointList.push_back(sourcePointList[sourcePointIndex++]);
 
             //iterate over subsequent source points for comparison and consolidation with the last added target/unique point
             for (; sourcePointIndex < sourcePointCount; ++sourcePointIndex)
@@ -363,7 +477,7 @@ namespace SurfaceData
 
                 if (!hasDesiredTags || (HasMatchingTags(sourcePoint.m_masks, desiredTags)))
                 {
-                    auto& targetPoint = m_targetPointList[targetPointIndex];
+                    auto& targetPoint = targetPointList[targetPointIndex];
 
                     // [LY-90907] need to add a configurable tolerance for comparison
                     if (targetPoint.m_position.IsClose(sourcePoint.m_position) &&
@@ -375,12 +489,12 @@ namespace SurfaceData
                     }
 
                     //if the points were too different, we have to add a new target point to compare against
-                    m_targetPointList.push_back(sourcePoint);
+                    targetPointList.push_back(sourcePoint);
                     ++targetPointIndex;
                 }
             }
 
-            AZStd::swap(sourcePointList, m_targetPointList);
+            AZStd::swap(sourcePointList, targetPointList);
         }
     }
 
@@ -28,6 +28,10 @@ namespace SurfaceData
         static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
         static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
 
+        //! Returns the number of tiles that the points of a region query with the given number of positions get combined, sorted and
+        //! filtered in on the calling thread.  This is 1 when the task graph is inactive or when called from a task.
+        static size_t GetRegionTileCount(size_t numPositions);
+
     protected:
         ////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
@@ -51,7 +55,19 @@ namespace SurfaceData
 
         void RefreshSurfaceData(const AZ::Aabb& dirtyArea) override;
     private:
-        void CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const;
+        // The handles and bounds of the registered providers or modifiers that apply to a query.  These get gathered while holding the
+        // registration lock, so that the providers and modifiers can be queried without holding it.
+        using SurfaceDataRegistryBoundsList = AZStd::vector<AZStd::pair<SurfaceDataRegistryHandle, AZ::Aabb>>;
+
+        void QueryRegionProvidersAndModifiers(
+            SurfacePointListPerPosition& surfacePointListPerPosition,
+            const SurfaceDataRegistryBoundsList& providers, const SurfaceDataRegistryBoundsList& modifiers) const;
+        void CombineSortAndFilterRegionTile(
+            SurfacePointListPerPosition::iterator tileBegin, SurfacePointListPerPosition::iterator tileEnd,
+            bool hasDesiredTags, const SurfaceTagVector& desiredTags, SurfacePointList& targetPointList) const;
+        void CombineSortAndFilterNeighboringPoints(
+            SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags,
+            SurfacePointList& targetPointList) const;
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry);
         SurfaceDataRegistryEntry UnregisterSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle);
@@ -67,8 +83,5 @@ namespace SurfaceData
         SurfaceDataRegistryHandle m_registeredSurfaceDataProviderHandleCounter = InvalidSurfaceDataRegistryHandle;
         SurfaceDataRegistryHandle m_registeredSurfaceDataModifierHandleCounter = InvalidSurfaceDataRegistryHandle;
         AZStd::unordered_set<AZ::u32> m_registeredModifierTags;
-
-        //point vector reserved for reuse
-        mutable SurfacePointList m_targetPointList;
     };
 }
@@ -14,12 +14,21 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <SurfaceDataSystemComponent.h>
 #include <SurfaceDataModule.h>
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
@@ -81,11 +90,19 @@ class MockSurfaceProvider
             Unregister();
         }
 
+        // Makes the modifier lock the surface data system bus while modifying points, the same way a modifier that samples a gradient
+        // does through GradientSampler.
+        void LockSurfaceDataSystemWhenModifying()
+        {
+            m_lockSurfaceDataSystem = true;
+        }
+
     private:
         AZStd::unordered_map<AZStd::pair<float, float>, SurfaceData::SurfacePointList> m_GetSurfacePoints;
         SurfaceData::SurfaceTagVector m_tags;
         ProviderType m_providerType;
         AZ::EntityId m_id;
+        bool m_lockSurfaceDataSystem = false;
 
         void SetPoints(AZ::Vector3 start, AZ::Vector3 end, AZ::Vector3 stepSize)
         {
@@ -187,6 +204,13 @@ class MockSurfaceProvider
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override
         {
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            AZStd::unique_lock<decltype(surfaceDataContext.m_contextMutex)> surfaceDataLock(surfaceDataContext.m_contextMutex, AZStd::defer_lock);
+            if (m_lockSurfaceDataSystem)
+            {
+                surfaceDataLock.lock();
+            }
+
             for (auto& point : surfacePointList)
             {
                 auto surfacePoints = m_GetSurfacePoints.find(AZStd::make_pair(point.m_position.GetX(), point.m_position.GetY()));
@@ -282,6 +306,75 @@ public:
 
 };
 
+// Activates the task graph for the lifetime of the object, so that large region queries get split up into tiles that are processed
+// in parallel.  The application's TaskGraphSystemComponent normally provides the task executor and the active interface, in which
+// case the task graph just needs to be switched on.  Otherwise, both are provided here.
+class ScopedTaskGraphActivation
+    : public AZ::TaskGraphActiveInterface
+{
+public:
+    ScopedTaskGraphActivation()
+    {
+        if (AZ::Interface<AZ::TaskGraphActiveInterface>::Get())
+        {
+            m_console = AZ::Interface<AZ::IConsole>::Get();
+            AZ_Assert(m_console, "The console is needed to activate the task graph of the application.");
+            m_console->GetCvarValue("cl_activateTaskGraph", m_savedActivateTaskGraph);
+            m_console->PerformCommand("cl_activateTaskGraph true");
+        }
+        else
+        {
+            m_executor = aznew AZ::TaskExecutor();
+            AZ::TaskExecutor::SetInstance(m_executor);
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+        }
+    }
+
+    ~ScopedTaskGraphActivation()
+    {
+        if (m_executor)
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+            AZ::TaskExecutor::SetInstance(nullptr);
+            azdestroy(m_executor);
+        }
+        else
+        {
+            m_console->PerformCommand(m_savedActivateTaskGraph ? "cl_activateTaskGraph true" : "cl_activateTaskGraph false");
+        }
+    }
+
+    bool IsTaskGraphActive() const override
+    {
+        return true;
+    }
+
+private:
+    AZ::IConsole* m_console = nullptr;
+    AZ::TaskExecutor* m_executor = nullptr;
+    bool m_savedActivateTaskGraph = false;
+};
+
+class SurfaceDataTaskGraphTestApp
+    : public SurfaceDataTestApp
+{
+public:
+    void SetUp() override
+    {
+        SurfaceDataTestApp::SetUp();
+        m_taskGraphActivation = AZStd::make_unique<ScopedTaskGraphActivation>();
+        ASSERT_TRUE(AZ::Interface<AZ::TaskGraphActiveInterface>::Get()->IsTaskGraphActive());
+    }
+
+    void TearDown() override
+    {
+        m_taskGraphActivation.reset();
+        SurfaceDataTestApp::TearDown();
+    }
+
+    AZStd::unique_ptr<ScopedTaskGraphActivation> m_taskGraphActivation;
+};
+
 TEST_F(SurfaceDataTestApp, SurfaceData_TestRegisteredTags)
 {
     AZStd::vector<AZStd::pair<AZ::u32, AZStd::string>> registeredTags = SurfaceData::SurfaceTag::GetRegisteredTags();
@@ -743,4 +836,218 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTaskGraphTestApp, SurfaceData_TestSurfacePointsFromRegion_LargeRegionMatchesSinglePointQueries)
+{
+    // This test verifies that a region large enough to get split up into tiles produces the same points, in the same order,
+    // as querying every position individually.
+
+    // Create a mock Surface Provider that covers from (0, 0) - (16, 16) in space.
+    // It defines points spaced 0.25 apart, with heights of 0 and 4, and with the tag "test_surface1".
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(16.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    // Create a mock Surface Modifier that covers half of the provider, from (0, 0) - (8, 16) in space, and adds the tag "test_surface2".
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f, 16.0f, 8.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    // Query for all the surface points from (0, 0) - (16, 16) with a step size of 0.25, which gives us 64 x 64 positions.
+    SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+    AZ::Vector2 stepSize(0.25f, 0.25f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(16.0f));
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, testTags, availablePointsPerPosition);
+
+    ASSERT_EQ(availablePointsPerPosition.size(), 64 * 64);
+
+    // Verify that the region actually got split up.
+    EXPECT_GT(SurfaceData::SurfaceDataSystemComponent::GetRegionTileCount(availablePointsPerPosition.size()), 1u);
+
+    // The positions are expected in row order, and every position needs to have the same points as a single point query.
+    size_t index = 0;
+    for (float y = 0.0f; y < 16.0f; y += stepSize.GetY())
+    {
+        for (float x = 0.0f; x < 16.0f; x += stepSize.GetX())
+        {
+            const auto& queryPosition = availablePointsPerPosition[index++];
+            EXPECT_EQ(queryPosition.first.GetX(), x);
+            EXPECT_EQ(queryPosition.first.GetY(), y);
+
+            SurfaceData::SurfacePointList pointList;
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints, AZ::Vector3(x, y, 0.0f), testTags, pointList);
+
+            ASSERT_EQ(queryPosition.second.size(), pointList.size());
+            for (size_t pointIndex = 0; pointIndex < pointList.size(); ++pointIndex)
+            {
+                EXPECT_EQ(queryPosition.second[pointIndex].m_position, pointList[pointIndex].m_position);
+                EXPECT_EQ(queryPosition.second[pointIndex].m_masks.size(), pointList[pointIndex].m_masks.size());
+            }
+        }
+    }
+}
+
+TEST_F(SurfaceDataTaskGraphTestApp, SurfaceData_TestSurfacePointsFromRegion_ConcurrentWithSinglePointQueries)
+{
+    // This test verifies that tiled region queries don't deadlock with single point queries made from another thread, while a
+    // modifier that locks the surface data system bus (like one that samples a gradient) is registered.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(16.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(16.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+    mockModifier.LockSurfaceDataSystemWhenModifying();
+
+    AZ::Vector2 stepSize(0.25f, 0.25f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(16.0f));
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    ASSERT_GT(SurfaceData::SurfaceDataSystemComponent::GetRegionTileCount(64 * 64), 1u);
+
+    constexpr int NumQueries = 20;
+    AZStd::atomic_int numPointQueriesWithPoints{ 0 };
+    AZStd::thread pointQueryThread([&testTags, &numPointQueriesWithPoints]()
+    {
+        for (int i = 0; i < NumQueries * 64; ++i)
+        {
+            SurfaceData::SurfacePointList pointList;
+            const float position = aznumeric_cast<float>(i % 64) * 0.25f;
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints, AZ::Vector3(position, position, 0.0f), testTags, pointList);
+            if (!pointList.empty())
+            {
+                ++numPointQueriesWithPoints;
+            }
+        }
+    });
+
+    for (int i = 0; i < NumQueries; ++i)
+    {
+        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            regionBounds, stepSize, testTags, availablePointsPerPosition);
+        ASSERT_EQ(availablePointsPerPosition.size(), 64 * 64);
+        EXPECT_FALSE(availablePointsPerPosition[0].second.empty());
+    }
+
+    pointQueryThread.join();
+    EXPECT_EQ(numPointQueriesWithPoints, NumQueries * 64);
+}
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Measures a region query of 128 x 128 positions, with the task graph inactive (0) or active (1).  The providers and modifiers
+    //! are always queried from the calling thread, so the speedup of the tiled query only comes from combining, sorting and filtering
+    //! the points of the positions in parallel.
+    class SurfaceDataRegionQueryBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpApplication(state.range(0) != 0);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpApplication(state.range(0) != 0);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            TearDownApplication();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            TearDownApplication();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void SetUpApplication(bool activateTaskGraph)
+        {
+            m_mocks = AZStd::make_unique<MockGlobalEnvironment>();
+
+            AZ::ComponentApplication::StartupParameters appStartup;
+            appStartup.m_createStaticModulesCallback =
+                [](AZStd::vector<AZ::Module*>& modules)
+            {
+                modules.emplace_back(new SurfaceData::SurfaceDataModule);
+            };
+
+            m_application = aznew AZ::ComponentApplication();
+            AZ::Entity* systemEntity = m_application->Create(AZ::ComponentApplication::Descriptor(), appStartup);
+            systemEntity->Init();
+            systemEntity->Activate();
+
+            if (activateTaskGraph)
+            {
+                m_taskGraphActivation = AZStd::make_unique<ScopedTaskGraphActivation>();
+            }
+
+            // A provider with two points per position, half of which get modified.
+            m_provider = AZStd::make_unique<MockSurfaceProvider>(
+                MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, SurfaceData::SurfaceTagVector{ SurfaceData::SurfaceTag(ProviderTag) },
+                AZ::Vector3(0.0f), AZ::Vector3(RegionSize), AZ::Vector3(0.25f, 0.25f, RegionSize / 2.0f));
+            m_modifier = AZStd::make_unique<MockSurfaceProvider>(
+                MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, SurfaceData::SurfaceTagVector{ SurfaceData::SurfaceTag(ModifierTag) },
+                AZ::Vector3(0.0f), AZ::Vector3(RegionSize / 2.0f, RegionSize, RegionSize), AZ::Vector3(0.25f, 0.25f, RegionSize / 2.0f));
+        }
+
+        void TearDownApplication()
+        {
+            m_modifier.reset();
+            m_provider.reset();
+            m_taskGraphActivation.reset();
+            m_application->Destroy();
+            delete m_application;
+            m_application = nullptr;
+            m_mocks.reset();
+        }
+
+        static constexpr float RegionSize = 32.0f;
+        static constexpr AZ::Crc32 ProviderTag = AZ_CRC_CE("test_surface1");
+        static constexpr AZ::Crc32 ModifierTag = AZ_CRC_CE("test_surface2");
+
+        AZStd::unique_ptr<MockGlobalEnvironment> m_mocks;
+        AZ::ComponentApplication* m_application = nullptr;
+        AZStd::unique_ptr<ScopedTaskGraphActivation> m_taskGraphActivation;
+        AZStd::unique_ptr<MockSurfaceProvider> m_provider;
+        AZStd::unique_ptr<MockSurfaceProvider> m_modifier;
+    };
+
+    BENCHMARK_DEFINE_F(SurfaceDataRegionQueryBenchmark, GetSurfacePointsFromRegion)(benchmark::State& state)
+    {
+        const AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(RegionSize));
+        const AZ::Vector2 stepSize(0.25f, 0.25f);
+        const SurfaceData::SurfaceTagVector desiredTags = { SurfaceData::SurfaceTag(ProviderTag), SurfaceData::SurfaceTag(ModifierTag) };
+
+        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+        for (auto _ : state)
+        {
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+                regionBounds, stepSize, desiredTags, availablePointsPerPosition);
+            benchmark::DoNotOptimize(availablePointsPerPosition.data());
+        }
+        state.SetItemsProcessed(state.iterations() * availablePointsPerPosition.size());
+    }
+    BENCHMARK_REGISTER_F(SurfaceDataRegionQueryBenchmark, GetSurfacePointsFromRegion)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+}
+#endif
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -34,6 +34,7 @@ namespace UnitTest
         MOCK_METHOD1(RegisterArea, void(AZ::EntityId areaId));
         MOCK_METHOD1(UnregisterArea, void(AZ::EntityId areaId));
         MOCK_METHOD1(RefreshArea, void(AZ::EntityId areaId));
+        MOCK_METHOD1(SetHeightCacheEnabled, void(bool enabled));
     };
 
     class MockTerrainDataNotificationListener : public AzFramework::Terrain::TerrainDataNotificationBus::Handler
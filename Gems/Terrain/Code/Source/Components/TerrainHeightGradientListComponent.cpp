@@ -173,6 +173,42 @@ namespace Terrain
         outPosition.SetZ(AZ::GetClamp(height, m_cachedMinWorldHeight, m_cachedMaxWorldHeight));
     }
 
+    void TerrainHeightGradientListComponent::GetHeights(AZStd::vector<AZ::Vector3>& inOutPositions, AZStd::vector<bool>& terrainExists)
+    {
+        const size_t numPositions = inOutPositions.size();
+
+        // The gradients get sampled at a Z of 0, same as in GetHeight.
+        AZStd::vector<AZ::Vector3> samplePositions;
+        samplePositions.reserve(numPositions);
+        for (const AZ::Vector3& position : inOutPositions)
+        {
+            samplePositions.emplace_back(position.GetX(), position.GetY(), 0.0f);
+        }
+
+        // Use the highest point from each gradient, same as in GetHeight, but query every gradient for all positions at once.
+        AZStd::vector<float> maxSamples(numPositions, 0.0f);
+        AZStd::vector<float> samples(numPositions, 0.0f);
+        for (auto& gradientId : m_configuration.m_gradientEntities)
+        {
+            AZStd::fill(samples.begin(), samples.end(), 0.0f);
+            GradientSignal::GradientRequestBus::Event(
+                gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, samplePositions, samples);
+
+            for (size_t index = 0; index < numPositions; ++index)
+            {
+                maxSamples[index] = AZ::GetMax(maxSamples[index], samples[index]);
+            }
+        }
+
+        const bool hasGradients = !m_configuration.m_gradientEntities.empty();
+        for (size_t index = 0; index < numPositions; ++index)
+        {
+            const float height = AZ::Lerp(m_cachedShapeBounds.GetMin().GetZ(), m_cachedShapeBounds.GetMax().GetZ(), maxSamples[index]);
+            inOutPositions[index].SetZ(AZ::GetClamp(height, m_cachedMinWorldHeight, m_cachedMaxWorldHeight));
+            terrainExists[index] = hasGradients;
+        }
+    }
+
     void TerrainHeightGradientListComponent::OnCompositionChanged()
     {
         RefreshMinMaxHeights();
@@ -65,6 +65,7 @@ namespace Terrain
         ~TerrainHeightGradientListComponent() = default;
 
         void GetHeight(const AZ::Vector3& inPosition, AZ::Vector3& outPosition, bool& terrainExists) override;
+        void GetHeights(AZStd::vector<AZ::Vector3>& inOutPositions, AZStd::vector<bool>& terrainExists) override;
 
         //////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainHeightCache.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
+
+using namespace Terrain;
+
+namespace
+{
+    // The largest quantized height value. Heights are quantized across the full 16 bit range.
+    constexpr float MaxQuantizedHeight = 65535.0f;
+}
+
+void TerrainHeightCache::Reset(const AZ::Aabb& worldBounds, const AZ::Vector2& queryResolution)
+{
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+    m_tiles.clear();
+    m_generation++;
+
+    m_queryResolution = queryResolution;
+    if (worldBounds.IsValid())
+    {
+        m_minHeight = worldBounds.GetMin().GetZ();
+        m_heightRange = worldBounds.GetMax().GetZ() - worldBounds.GetMin().GetZ();
+    }
+    else
+    {
+        m_minHeight = 0.0f;
+        m_heightRange = 0.0f;
+    }
+}
+
+void TerrainHeightCache::InvalidateRegion(const AZ::Aabb& region)
+{
+    if (!region.IsValid())
+    {
+        return;
+    }
+
+    // The query resolution is guarded by the tile lock as well, so it's taken before computing the covered tiles.
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+    // Get the range of grid points covered by the region, rounding outwards so that the grid points on the edges are included.
+    const int32_t minGridX = aznumeric_cast<int32_t>(floorf(region.GetMin().GetX() / m_queryResolution.GetX()));
+    const int32_t minGridY = aznumeric_cast<int32_t>(floorf(region.GetMin().GetY() / m_queryResolution.GetY()));
+    const int32_t maxGridX = aznumeric_cast<int32_t>(ceilf(region.GetMax().GetX() / m_queryResolution.GetX()));
+    const int32_t maxGridY = aznumeric_cast<int32_t>(ceilf(region.GetMax().GetY() / m_queryResolution.GetY()));
+
+    const int32_t minTileX = GetTileCoordinate(minGridX);
+    const int32_t minTileY = GetTileCoordinate(minGridY);
+    const int32_t maxTileX = GetTileCoordinate(maxGridX);
+    const int32_t maxTileY = GetTileCoordinate(maxGridY);
+
+    // Bump the generation even if there are no tiles to drop, since heights of the region might be getting computed right now.
+    m_generation++;
+
+    const int64_t numRegionTiles = (int64_t(maxTileX) - minTileX + 1) * (int64_t(maxTileY) - minTileY + 1);
+    if (numRegionTiles > aznumeric_cast<int64_t>(m_tiles.size()))
+    {
+        // The region covers more tiles than we have cached, so it's cheaper to check every cached tile against the region.
+        for (auto it = m_tiles.begin(); it != m_tiles.end();)
+        {
+            const int32_t tileX = static_cast<int32_t>(static_cast<uint32_t>(it->first >> 32));
+            const int32_t tileY = static_cast<int32_t>(static_cast<uint32_t>(it->first & 0xFFFFFFFF));
+            if (tileX >= minTileX && tileX <= maxTileX && tileY >= minTileY && tileY <= maxTileY)
+            {
+                it = m_tiles.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+    else
+    {
+        for (int32_t tileY = minTileY; tileY <= maxTileY; ++tileY)
+        {
+            for (int32_t tileX = minTileX; tileX <= maxTileX; ++tileX)
+            {
+                m_tiles.erase(GetTileKey(tileX, tileY));
+            }
+        }
+    }
+}
+
+TerrainHeightCache::GridPoint TerrainHeightCache::GetGridPoint(float x, float y) const
+{
+    // The query resolution can be changed by Reset from another thread.
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+    // Positions are expected to lie on the grid already, rounding just protects against floating point error.
+    return GridPoint{ aznumeric_cast<int32_t>(floorf((x / m_queryResolution.GetX()) + 0.5f)),
+                      aznumeric_cast<int32_t>(floorf((y / m_queryResolution.GetY()) + 0.5f)) };
+}
+
+bool TerrainHeightCache::GetHeight(const GridPoint& gridPoint, float& outHeight, HeightState& outState, uint32_t& outGeneration) const
+{
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+    outGeneration = m_generation;
+
+    const Tile* tile = FindTile(gridPoint);
+    if (tile)
+    {
+        TouchTile(*tile);
+        const size_t pointIndex = GetPointIndex(gridPoint);
+        if (tile->m_states[pointIndex] != HeightState::Unknown)
+        {
+            outHeight = DequantizeHeight(tile->m_heights[pointIndex]);
+            outState = tile->m_states[pointIndex];
+            return true;
+        }
+    }
+
+    outState = HeightState::Unknown;
+    return false;
+}
+
+void TerrainHeightCache::SetHeight(uint32_t generation, const GridPoint& gridPoint, float height, HeightState state)
+{
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+    if (generation == m_generation)
+    {
+        StoreHeight(gridPoint, height, state);
+    }
+}
+
+uint32_t TerrainHeightCache::GetHeights(
+    const AZStd::vector<GridPoint>& gridPoints, AZStd::vector<float>& outHeights, AZStd::vector<HeightState>& outStates,
+    AZStd::vector<size_t>& outMissingIndices) const
+{
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+    // Consecutive grid points usually share the same tile, so remember the last one instead of looking it up every time.
+    uint64_t lastTileKey = 0;
+    const Tile* lastTile = nullptr;
+    bool hasLastTile = false;
+
+    for (size_t index = 0; index < gridPoints.size(); ++index)
+    {
+        const GridPoint& gridPoint = gridPoints[index];
+        const uint64_t tileKey = GetTileKey(GetTileCoordinate(gridPoint.m_x), GetTileCoordinate(gridPoint.m_y));
+
+        if (!hasLastTile || tileKey != lastTileKey)
+        {
+            lastTile = FindTile(gridPoint);
+            lastTileKey = tileKey;
+            hasLastTile = true;
+            if (lastTile)
+            {
+                TouchTile(*lastTile);
+            }
+        }
+
+        if (lastTile)
+        {
+            const size_t pointIndex = GetPointIndex(gridPoint);
+            if (lastTile->m_states[pointIndex] != HeightState::Unknown)
+            {
+                outHeights[index] = DequantizeHeight(lastTile->m_heights[pointIndex]);
+                outStates[index] = lastTile->m_states[pointIndex];
+                continue;
+            }
+        }
+
+        outStates[index] = HeightState::Unknown;
+        outMissingIndices.emplace_back(index);
+    }
+
+    return m_generation;
+}
+
+void TerrainHeightCache::SetHeights(
+    uint32_t generation, const AZStd::vector<GridPoint>& gridPoints, const AZStd::vector<float>& heights,
+    const AZStd::vector<HeightState>& states, const AZStd::vector<size_t>& indices)
+{
+    if (indices.empty())
+    {
+        return;
+    }
+
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+    if (generation != m_generation)
+    {
+        return;
+    }
+
+    for (size_t index : indices)
+    {
+        StoreHeight(gridPoints[index], heights[index], states[index]);
+    }
+}
+
+void TerrainHeightCache::SetMaxTiles(size_t maxTiles)
+{
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+    m_maxTiles = AZStd::max<size_t>(maxTiles, 1);
+    if (m_tiles.size() > m_maxTiles)
+    {
+        EvictTiles(m_maxTiles);
+    }
+}
+
+size_t TerrainHeightCache::GetNumTiles() const
+{
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+    return m_tiles.size();
+}
+
+uint64_t TerrainHeightCache::GetTileKey(int32_t tileX, int32_t tileY)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(tileY));
+}
+
+int32_t TerrainHeightCache::GetTileCoordinate(int32_t gridCoordinate)
+{
+    // Round towards negative infinity, so that negative grid coordinates end up in their own tiles.
+    return (gridCoordinate >= 0) ? (gridCoordinate / TileSize) : ((gridCoordinate - (TileSize - 1)) / TileSize);
+}
+
+size_t TerrainHeightCache::GetPointIndex(const GridPoint& gridPoint)
+{
+    const int32_t tileX = GetTileCoordinate(gridPoint.m_x);
+    const int32_t tileY = GetTileCoordinate(gridPoint.m_y);
+    return aznumeric_cast<size_t>(((gridPoint.m_y - (tileY * TileSize)) * TileSize) + (gridPoint.m_x - (tileX * TileSize)));
+}
+
+const TerrainHeightCache::Tile* TerrainHeightCache::FindTile(const GridPoint& gridPoint) const
+{
+    auto tileIt = m_tiles.find(GetTileKey(GetTileCoordinate(gridPoint.m_x), GetTileCoordinate(gridPoint.m_y)));
+    return (tileIt != m_tiles.end()) ? tileIt->second.get() : nullptr;
+}
+
+void TerrainHeightCache::StoreHeight(const GridPoint& gridPoint, float height, HeightState state)
+{
+    const uint64_t tileKey = GetTileKey(GetTileCoordinate(gridPoint.m_x), GetTileCoordinate(gridPoint.m_y));
+    if (m_tiles.size() >= m_maxTiles && m_tiles.find(tileKey) == m_tiles.end())
+    {
+        // Evict a quarter of the budget at once, so that finding the least recently used tiles isn't needed for every new tile.
+        EvictTiles(m_maxTiles - AZStd::max<size_t>(m_maxTiles / 4, 1));
+    }
+
+    AZStd::unique_ptr<Tile>& tile = m_tiles[tileKey];
+    if (!tile)
+    {
+        tile = AZStd::make_unique<Tile>();
+        tile->m_states.fill(HeightState::Unknown);
+    }
+    TouchTile(*tile);
+
+    const size_t pointIndex = GetPointIndex(gridPoint);
+    tile->m_heights[pointIndex] = QuantizeHeight(height);
+    tile->m_states[pointIndex] = state;
+}
+
+void TerrainHeightCache::TouchTile(const Tile& tile) const
+{
+    tile.m_lastUsed.store(m_useCounter.fetch_add(1, AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+}
+
+void TerrainHeightCache::EvictTiles(size_t numTilesToKeep)
+{
+    if (m_tiles.size() <= numTilesToKeep)
+    {
+        return;
+    }
+
+    AZStd::vector<AZStd::pair<uint64_t, uint64_t>> tileUses;
+    tileUses.reserve(m_tiles.size());
+    for (const auto& [tileKey, tile] : m_tiles)
+    {
+        tileUses.emplace_back(tile->m_lastUsed.load(AZStd::memory_order_relaxed), tileKey);
+    }
+
+    // Sort by use stamp so that the least recently used tiles come first.
+    AZStd::sort(tileUses.begin(), tileUses.end());
+    const size_t numTilesToEvict = tileUses.size() - numTilesToKeep;
+    for (size_t index = 0; index < numTilesToEvict; ++index)
+    {
+        m_tiles.erase(tileUses[index].second);
+    }
+}
+
+uint16_t TerrainHeightCache::QuantizeHeight(float height) const
+{
+    if (m_heightRange <= 0.0f)
+    {
+        return 0;
+    }
+
+    const float normalizedHeight = AZ::GetClamp((height - m_minHeight) / m_heightRange, 0.0f, 1.0f);
+    return aznumeric_cast<uint16_t>((normalizedHeight * MaxQuantizedHeight) + 0.5f);
+}
+
+float TerrainHeightCache::DequantizeHeight(uint16_t quantizedHeight) const
+{
+    return m_minHeight + ((quantizedHeight / MaxQuantizedHeight) * m_heightRange);
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Terrain
+{
+    //! Caches the terrain heights of the height query grid in square tiles, so that repeated queries of the same grid points
+    //! don't need to go back to the terrain areas. Heights are quantized to 16 bits across the height range of the world bounds.
+    //! Grid points are cached lazily as they get queried, and tiles get dropped when a region of the terrain is invalidated.
+    //! The number of cached tiles is limited by a tile budget, the least recently used tiles get dropped when it's exceeded.
+    //! The cache is safe to use from multiple threads.
+    class TerrainHeightCache
+    {
+    public:
+        //! The number of grid points along each side of a tile.
+        static constexpr int32_t TileSize = 64;
+        //! The default number of tiles the cache keeps, each tile takes about 12KB.
+        static constexpr size_t DefaultMaxTiles = 1024;
+
+        //! A grid point on the height query grid, in units of the query resolution.
+        struct GridPoint
+        {
+            int32_t m_x = 0;
+            int32_t m_y = 0;
+        };
+
+        //! The state of the terrain at a grid point.
+        enum class HeightState : uint8_t
+        {
+            Unknown,        //!< The grid point isn't cached yet.
+            TerrainExists,  //!< A terrain area provided the height, and terrain exists at the grid point.
+            NoTerrain,      //!< A terrain area provided the height, but there's a hole at the grid point.
+            NoTerrainArea   //!< There's no terrain area at the grid point.
+        };
+
+        //! Drop all cached heights and set up the grid the heights are cached for.
+        void Reset(const AZ::Aabb& worldBounds, const AZ::Vector2& queryResolution);
+
+        //! Drop all cached heights of the tiles overlapping the given region.
+        void InvalidateRegion(const AZ::Aabb& region);
+
+        //! Get the grid point for a position that lies on the height query grid.
+        GridPoint GetGridPoint(float x, float y) const;
+
+        //! Get the cached height of a single grid point.
+        //! @param outGeneration The generation of the cache, which needs to be passed to SetHeight when storing a missing height.
+        //! @return true if the height was cached, false if it still needs to be computed.
+        bool GetHeight(const GridPoint& gridPoint, float& outHeight, HeightState& outState, uint32_t& outGeneration) const;
+
+        //! Store the height of a single grid point, unless the cache got invalidated since the given generation.
+        void SetHeight(uint32_t generation, const GridPoint& gridPoint, float height, HeightState state);
+
+        //! Get the cached heights of a list of grid points.
+        //! Grid points that aren't cached yet are added to outMissingIndices, and their state is set to HeightState::Unknown.
+        //! @return the generation of the cache, which needs to be passed to SetHeights when storing the missing heights.
+        uint32_t GetHeights(
+            const AZStd::vector<GridPoint>& gridPoints, AZStd::vector<float>& outHeights, AZStd::vector<HeightState>& outStates,
+            AZStd::vector<size_t>& outMissingIndices) const;
+
+        //! Store the heights of the grid points at the given indices. The heights are dropped if the cache got invalidated since the
+        //! given generation, as they might have been computed from outdated terrain data.
+        void SetHeights(
+            uint32_t generation, const AZStd::vector<GridPoint>& gridPoints, const AZStd::vector<float>& heights,
+            const AZStd::vector<HeightState>& states, const AZStd::vector<size_t>& indices);
+
+        //! Set the number of tiles the cache keeps, dropping the least recently used tiles if there are more cached already.
+        void SetMaxTiles(size_t maxTiles);
+
+        size_t GetNumTiles() const;
+
+    private:
+        struct Tile
+        {
+            AZStd::array<uint16_t, TileSize * TileSize> m_heights;
+            AZStd::array<HeightState, TileSize * TileSize> m_states;
+            //! The use stamp of the last query that read or wrote the tile. It's updated by readers holding the shared lock.
+            mutable AZStd::atomic<uint64_t> m_lastUsed{ 0 };
+        };
+
+        static uint64_t GetTileKey(int32_t tileX, int32_t tileY);
+        static int32_t GetTileCoordinate(int32_t gridCoordinate);
+        static size_t GetPointIndex(const GridPoint& gridPoint);
+
+        //! Find the tile containing the grid point, expects m_tileMutex to be locked by the caller.
+        const Tile* FindTile(const GridPoint& gridPoint) const;
+        //! Store the height of a grid point, expects m_tileMutex to be locked for writing by the caller.
+        void StoreHeight(const GridPoint& gridPoint, float height, HeightState state);
+        //! Mark a tile as used by the current query.
+        void TouchTile(const Tile& tile) const;
+        //! Drop the least recently used tiles until at most the given number of tiles is left, expects m_tileMutex to be locked
+        //! for writing by the caller.
+        void EvictTiles(size_t numTilesToKeep);
+
+        uint16_t QuantizeHeight(float height) const;
+        float DequantizeHeight(uint16_t quantizedHeight) const;
+
+        mutable AZStd::shared_mutex m_tileMutex;
+        AZStd::unordered_map<uint64_t, AZStd::unique_ptr<Tile>> m_tiles;
+        uint32_t m_generation = 0;
+        size_t m_maxTiles = DefaultMaxTiles;
+        mutable AZStd::atomic<uint64_t> m_useCounter{ 0 };
+
+        AZ::Vector2 m_queryResolution{ 1.0f };
+        float m_minHeight = 0.0f;
+        float m_heightRange = 0.0f;
+    };
+} // namespace Terrain
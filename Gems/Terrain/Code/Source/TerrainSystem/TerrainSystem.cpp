@@ -14,6 +14,18 @@
 
 using namespace Terrain;
 
+namespace
+{
+    void ApplyHeightState(TerrainHeightCache::HeightState state, bool& terrainExists)
+    {
+        // Like GetTerrainAreaHeight, leave terrainExists untouched when there's no terrain area at the position.
+        if (state != TerrainHeightCache::HeightState::NoTerrainArea)
+        {
+            terrainExists = (state == TerrainHeightCache::HeightState::TerrainExists);
+        }
+    }
+}
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/keylookup.
@@ -76,6 +88,8 @@ void TerrainSystem::Activate()
         m_registeredAreas.clear();
     }
 
+    m_heightCache.Reset(m_currentSettings.m_worldBounds, m_currentSettings.m_heightQueryResolution);
+
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusConnect();
 
     // Register any terrain spawners that were already active before the terrain system activated.
@@ -105,6 +119,8 @@ void TerrainSystem::Deactivate()
         m_registeredAreas.clear();
     }
 
+    m_heightCache.Reset(m_currentSettings.m_worldBounds, m_currentSettings.m_heightQueryResolution);
+
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainHeightDirty = true;
     m_terrainSettingsDirty = true;
@@ -126,6 +142,12 @@ void TerrainSystem::SetTerrainHeightQueryResolution(AZ::Vector2 queryResolution)
     m_terrainSettingsDirty = true;
 }
 
+void TerrainSystem::SetHeightCacheEnabled(bool enabled)
+{
+    m_requestedSettings.m_heightCacheEnabled = enabled;
+    m_terrainSettingsDirty = true;
+}
+
 AZ::Aabb TerrainSystem::GetTerrainAabb() const
 {
     return m_currentSettings.m_worldBounds;
@@ -172,10 +194,10 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             ClampPosition(x, y, pos0, normalizedDelta);
             const AZ::Vector2 pos1 = pos0 + m_currentSettings.m_heightQueryResolution;
 
-            const float heightX0Y0 = GetTerrainAreaHeight(pos0.GetX(), pos0.GetY(), terrainExists);
-            const float heightX1Y0 = GetTerrainAreaHeight(pos1.GetX(), pos0.GetY(), terrainExists);
-            const float heightX0Y1 = GetTerrainAreaHeight(pos0.GetX(), pos1.GetY(), terrainExists);
-            const float heightX1Y1 = GetTerrainAreaHeight(pos1.GetX(), pos1.GetY(), terrainExists);
+            const float heightX0Y0 = GetGridHeight(pos0.GetX(), pos0.GetY(), terrainExists);
+            const float heightX1Y0 = GetGridHeight(pos1.GetX(), pos0.GetY(), terrainExists);
+            const float heightX0Y1 = GetGridHeight(pos0.GetX(), pos1.GetY(), terrainExists);
+            const float heightX1Y1 = GetGridHeight(pos1.GetX(), pos1.GetY(), terrainExists);
             const float heightXY0 = AZ::Lerp(heightX0Y0, heightX1Y0, normalizedDelta.GetX());
             const float heightXY1 = AZ::Lerp(heightX0Y1, heightX1Y1, normalizedDelta.GetX());
             height = AZ::Lerp(heightXY0, heightXY1, normalizedDelta.GetY());
@@ -189,7 +211,7 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             AZ::Vector2 clampedPosition;
             ClampPosition(x, y, clampedPosition, normalizedDelta);
 
-            height = GetTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
+            height = GetGridHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
         }
         break;
 
@@ -233,6 +255,251 @@ float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists)
     return height;
 }
 
+void TerrainSystem::GetTerrainAreaHeights(AZStd::vector<AZ::Vector3>& inOutPositions, AZStd::vector<HeightState>& outStates) const
+{
+    const float minHeight = m_currentSettings.m_worldBounds.GetMin().GetZ();
+    outStates.assign(inOutPositions.size(), HeightState::NoTerrainArea);
+
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+
+    AZStd::vector<size_t> areaIndices;
+    AZStd::vector<AZ::Vector3> areaPositions;
+    AZStd::vector<bool> areaTerrainExists;
+
+    // Hand every area all of the positions it's the highest priority area for, so that every area only gets queried once.
+    for (auto& [areaId, areaBounds] : m_registeredAreas)
+    {
+        areaIndices.clear();
+        areaPositions.clear();
+
+        for (size_t index = 0; index < inOutPositions.size(); ++index)
+        {
+            if (outStates[index] != HeightState::NoTerrainArea)
+            {
+                continue;
+            }
+
+            const AZ::Vector3 inPosition(inOutPositions[index].GetX(), inOutPositions[index].GetY(), areaBounds.GetMin().GetZ());
+            if (areaBounds.Contains(inPosition))
+            {
+                // Mark the position as taken, so that lower priority areas skip it.
+                outStates[index] = HeightState::NoTerrain;
+                areaIndices.emplace_back(index);
+                areaPositions.emplace_back(inPosition);
+            }
+        }
+
+        if (areaIndices.empty())
+        {
+            continue;
+        }
+
+        areaTerrainExists.assign(areaPositions.size(), false);
+        Terrain::TerrainAreaHeightRequestBus::Event(
+            areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights, areaPositions, areaTerrainExists);
+
+        for (size_t areaIndex = 0; areaIndex < areaIndices.size(); ++areaIndex)
+        {
+            const size_t index = areaIndices[areaIndex];
+            inOutPositions[index].SetZ(areaPositions[areaIndex].GetZ());
+            outStates[index] = areaTerrainExists[areaIndex] ? HeightState::TerrainExists : HeightState::NoTerrain;
+        }
+    }
+
+    for (size_t index = 0; index < inOutPositions.size(); ++index)
+    {
+        if (outStates[index] == HeightState::NoTerrainArea)
+        {
+            inOutPositions[index].SetZ(minHeight);
+        }
+    }
+}
+
+float TerrainSystem::GetGridHeight(float x, float y, bool& terrainExists) const
+{
+    if (!m_currentSettings.m_heightCacheEnabled)
+    {
+        return GetTerrainAreaHeight(x, y, terrainExists);
+    }
+
+    const TerrainHeightCache::GridPoint gridPoint = m_heightCache.GetGridPoint(x, y);
+    float height = 0.0f;
+    HeightState state = HeightState::Unknown;
+    uint32_t generation = 0;
+
+    if (!m_heightCache.GetHeight(gridPoint, height, state, generation))
+    {
+        AZStd::vector<AZ::Vector3> positions{ AZ::Vector3(x, y, 0.0f) };
+        AZStd::vector<HeightState> states;
+        GetTerrainAreaHeights(positions, states);
+
+        height = positions[0].GetZ();
+        state = states[0];
+        m_heightCache.SetHeight(generation, gridPoint, height, state);
+    }
+
+    ApplyHeightState(state, terrainExists);
+    return height;
+}
+
+void TerrainSystem::GetGridHeights(AZStd::vector<AZ::Vector3>& inOutPositions, AZStd::vector<HeightState>& outStates) const
+{
+    if (!m_currentSettings.m_heightCacheEnabled)
+    {
+        GetTerrainAreaHeights(inOutPositions, outStates);
+        return;
+    }
+
+    const size_t numPositions = inOutPositions.size();
+    AZStd::vector<TerrainHeightCache::GridPoint> gridPoints;
+    gridPoints.reserve(numPositions);
+    for (const AZ::Vector3& position : inOutPositions)
+    {
+        gridPoints.emplace_back(m_heightCache.GetGridPoint(position.GetX(), position.GetY()));
+    }
+
+    AZStd::vector<float> heights(numPositions, 0.0f);
+    AZStd::vector<size_t> missingIndices;
+    outStates.resize(numPositions);
+    const uint32_t generation = m_heightCache.GetHeights(gridPoints, heights, outStates, missingIndices);
+
+    // Only query the terrain areas for the grid points that aren't cached yet, then add them to the cache.
+    if (!missingIndices.empty())
+    {
+        AZStd::vector<AZ::Vector3> missingPositions;
+        AZStd::vector<HeightState> missingStates;
+        missingPositions.reserve(missingIndices.size());
+        for (size_t index : missingIndices)
+        {
+            missingPositions.emplace_back(inOutPositions[index]);
+        }
+
+        GetTerrainAreaHeights(missingPositions, missingStates);
+
+        for (size_t missingIndex = 0; missingIndex < missingIndices.size(); ++missingIndex)
+        {
+            const size_t index = missingIndices[missingIndex];
+            heights[index] = missingPositions[missingIndex].GetZ();
+            outStates[index] = missingStates[missingIndex];
+        }
+
+        m_heightCache.SetHeights(generation, gridPoints, heights, outStates, missingIndices);
+    }
+
+    for (size_t index = 0; index < numPositions; ++index)
+    {
+        inOutPositions[index].SetZ(heights[index]);
+    }
+}
+
+void TerrainSystem::GetHeights(AZStd::vector<AZ::Vector3>& inOutPositions, Sampler sampler, AZStd::vector<bool>* terrainExistsList) const
+{
+    const size_t numPositions = inOutPositions.size();
+    if (terrainExistsList)
+    {
+        terrainExistsList->assign(numPositions, false);
+    }
+
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+
+    AZStd::vector<HeightState> states;
+
+    switch (sampler)
+    {
+    // Query the four grid points around every position in one batch, then bilinear filter between them like GetHeightSynchronous.
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR:
+        {
+            AZStd::vector<AZ::Vector3> gridPositions;
+            AZStd::vector<AZ::Vector2> normalizedDeltas;
+            gridPositions.reserve(numPositions * 4);
+            normalizedDeltas.reserve(numPositions);
+
+            for (const AZ::Vector3& position : inOutPositions)
+            {
+                AZ::Vector2 normalizedDelta;
+                AZ::Vector2 pos0;
+                ClampPosition(position.GetX(), position.GetY(), pos0, normalizedDelta);
+                const AZ::Vector2 pos1 = pos0 + m_currentSettings.m_heightQueryResolution;
+
+                gridPositions.emplace_back(pos0.GetX(), pos0.GetY(), 0.0f);
+                gridPositions.emplace_back(pos1.GetX(), pos0.GetY(), 0.0f);
+                gridPositions.emplace_back(pos0.GetX(), pos1.GetY(), 0.0f);
+                gridPositions.emplace_back(pos1.GetX(), pos1.GetY(), 0.0f);
+                normalizedDeltas.emplace_back(normalizedDelta);
+            }
+
+            GetGridHeights(gridPositions, states);
+
+            for (size_t index = 0; index < numPositions; ++index)
+            {
+                const size_t cornerIndex = index * 4;
+                const AZ::Vector2& normalizedDelta = normalizedDeltas[index];
+                const float heightXY0 =
+                    AZ::Lerp(gridPositions[cornerIndex].GetZ(), gridPositions[cornerIndex + 1].GetZ(), normalizedDelta.GetX());
+                const float heightXY1 =
+                    AZ::Lerp(gridPositions[cornerIndex + 2].GetZ(), gridPositions[cornerIndex + 3].GetZ(), normalizedDelta.GetX());
+                inOutPositions[index].SetZ(AZ::Lerp(heightXY0, heightXY1, normalizedDelta.GetY()));
+
+                if (terrainExistsList)
+                {
+                    bool terrainExists = false;
+                    for (size_t corner = 0; corner < 4; ++corner)
+                    {
+                        ApplyHeightState(states[cornerIndex + corner], terrainExists);
+                    }
+                    (*terrainExistsList)[index] = terrainExists;
+                }
+            }
+        }
+        break;
+
+    //! Clamp the input points to the terrain sample grid, then get the heights at the given grid locations.
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP:
+        {
+            AZStd::vector<AZ::Vector3> gridPositions;
+            gridPositions.reserve(numPositions);
+
+            for (const AZ::Vector3& position : inOutPositions)
+            {
+                AZ::Vector2 normalizedDelta;
+                AZ::Vector2 clampedPosition;
+                ClampPosition(position.GetX(), position.GetY(), clampedPosition, normalizedDelta);
+                gridPositions.emplace_back(clampedPosition.GetX(), clampedPosition.GetY(), 0.0f);
+            }
+
+            GetGridHeights(gridPositions, states);
+
+            for (size_t index = 0; index < numPositions; ++index)
+            {
+                inOutPositions[index].SetZ(gridPositions[index].GetZ());
+            }
+        }
+        break;
+
+    //! Directly get the values at the locations, regardless of terrain sample grid density.
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
+        [[fallthrough]];
+    default:
+        GetTerrainAreaHeights(inOutPositions, states);
+        break;
+    }
+
+    if (terrainExistsList && (sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR))
+    {
+        for (size_t index = 0; index < numPositions; ++index)
+        {
+            (*terrainExistsList)[index] = (states[index] == HeightState::TerrainExists);
+        }
+    }
+
+    const float minHeight = m_currentSettings.m_worldBounds.GetMin().GetZ();
+    const float maxHeight = m_currentSettings.m_worldBounds.GetMax().GetZ();
+    for (AZ::Vector3& position : inOutPositions)
+    {
+        position.SetZ(AZ::GetClamp(position.GetZ(), minHeight, maxHeight));
+    }
+}
+
 float TerrainSystem::GetHeight(AZ::Vector3 position, Sampler sampler, bool* terrainExistsPtr) const
 {
     return GetHeightSynchronous(position.GetX(), position.GetY(), sampler, terrainExistsPtr);
@@ -290,6 +557,52 @@ AZ::Vector3 TerrainSystem::GetNormalFromFloats(float x, float y, Sampler sampler
 }
 
 
+void TerrainSystem::GetNormals(
+    const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<AZ::Vector3>& outNormals, Sampler sampler,
+    AZStd::vector<bool>* terrainExistsList) const
+{
+    const size_t numPositions = positions.size();
+    const AZ::Vector2 range = (m_currentSettings.m_heightQueryResolution / 2.0f);
+
+    // Gather the same four neighbors as GetNormalSynchronous for every position, so that all of their heights get queried at once.
+    AZStd::vector<AZ::Vector3> neighbors;
+    neighbors.reserve(numPositions * 4);
+    for (const AZ::Vector3& position : positions)
+    {
+        const float x = position.GetX();
+        const float y = position.GetY();
+        neighbors.emplace_back(x, y - range.GetY(), 0.0f);
+        neighbors.emplace_back(x - range.GetX(), y, 0.0f);
+        neighbors.emplace_back(x + range.GetX(), y, 0.0f);
+        neighbors.emplace_back(x, y + range.GetY(), 0.0f);
+    }
+
+    AZStd::vector<bool> neighborTerrainExists;
+    GetHeights(neighbors, sampler, terrainExistsList ? &neighborTerrainExists : nullptr);
+
+    outNormals.resize(numPositions);
+    if (terrainExistsList)
+    {
+        terrainExistsList->resize(numPositions);
+    }
+
+    for (size_t index = 0; index < numPositions; ++index)
+    {
+        const size_t neighborIndex = index * 4;
+        const AZ::Vector3& up = neighbors[neighborIndex];
+        const AZ::Vector3& left = neighbors[neighborIndex + 1];
+        const AZ::Vector3& right = neighbors[neighborIndex + 2];
+        const AZ::Vector3& down = neighbors[neighborIndex + 3];
+        outNormals[index] = (right - left).Cross(down - up).GetNormalized();
+
+        if (terrainExistsList)
+        {
+            // GetNormalSynchronous reports whether terrain exists at the last neighbor it sampled.
+            (*terrainExistsList)[index] = neighborTerrainExists[neighborIndex + 3];
+        }
+    }
+}
+
 AzFramework::SurfaceData::SurfaceTagWeight TerrainSystem::GetMaxSurfaceWeight(
     [[maybe_unused]] AZ::Vector3 position, [[maybe_unused]] Sampler sampleFilter, [[maybe_unused]] bool* terrainExistsPtr) const
 {
@@ -419,6 +732,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
     AZ::Aabb aabb = AZ::Aabb::CreateNull();
     LmbrCentral::ShapeComponentRequestsBus::EventResult(aabb, areaId, &LmbrCentral::ShapeComponentRequestsBus::Events::GetEncompassingAabb);
     m_registeredAreas[areaId] = aabb;
+    m_heightCache.InvalidateRegion(aabb);
     m_dirtyRegion.AddAabb(aabb);
     m_terrainHeightDirty = true;
 }
@@ -437,6 +751,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             auto const& [entityId, aabb] = item;
             if (areaId == entityId)
             {
+                m_heightCache.InvalidateRegion(aabb);
                 m_dirtyRegion.AddAabb(aabb);
                 m_terrainHeightDirty = true;
                 return true;
@@ -459,6 +774,7 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId)
     AZ::Aabb expandedAabb = oldAabb;
     expandedAabb.AddAabb(newAabb);
 
+    m_heightCache.InvalidateRegion(expandedAabb);
     m_dirtyRegion.AddAabb(expandedAabb);
     m_terrainHeightDirty = true;
 }
@@ -489,6 +805,9 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // The cached heights depend on the world bounds and query resolution, so start over with an empty cache.
+        m_heightCache.Reset(m_currentSettings.m_worldBounds, m_currentSettings.m_heightQueryResolution);
     }
 
     if (terrainSettingsChanged || m_terrainHeightDirty)
@@ -23,6 +23,7 @@
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainSystem/TerrainSystemBus.h>
+#include <TerrainSystem/TerrainHeightCache.h>
 
 namespace Terrain
 {
@@ -49,6 +50,8 @@ namespace Terrain
         void UnregisterArea(AZ::EntityId areaId) override;
         void RefreshArea(AZ::EntityId areaId) override;
 
+        void SetHeightCacheEnabled(bool enabled) override;
+
         ///////////////////////////////////////////
         // TerrainDataRequestBus::Handler Impl
         AZ::Vector2 GetTerrainHeightQueryResolution() const override;
@@ -93,11 +96,27 @@ namespace Terrain
         AZ::Vector3 GetNormalFromFloats(
             float x, float y, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const override;
 
+        //! Batched versions of GetHeight and GetNormal. Every terrain area only gets queried once per batch,
+        //! and the heights of the query grid get served from the height cache when it's enabled.
+        void GetHeights(
+            AZStd::vector<AZ::Vector3>& inOutPositions, Sampler sampler = Sampler::BILINEAR,
+            AZStd::vector<bool>* terrainExistsList = nullptr) const override;
+        void GetNormals(
+            const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<AZ::Vector3>& outNormals, Sampler sampler = Sampler::BILINEAR,
+            AZStd::vector<bool>* terrainExistsList = nullptr) const override;
+
     private:
+        using HeightState = TerrainHeightCache::HeightState;
+
         void ClampPosition(float x, float y, AZ::Vector2& outPosition, AZ::Vector2& normalizedDelta) const;
 
         float GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
         float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
+        void GetTerrainAreaHeights(AZStd::vector<AZ::Vector3>& inOutPositions, AZStd::vector<HeightState>& outStates) const;
+
+        // Get the heights of points on the query grid, using the height cache when it's enabled.
+        float GetGridHeight(float x, float y, bool& terrainExists) const;
+        void GetGridHeights(AZStd::vector<AZ::Vector3>& inOutPositions, AZStd::vector<HeightState>& outStates) const;
         AZ::Vector3  GetNormalSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
 
         // AZ::TickBus::Handler overrides ...
@@ -108,6 +127,7 @@ namespace Terrain
             AZ::Aabb m_worldBounds;
             AZ::Vector2 m_heightQueryResolution{ 1.0f };
             bool m_systemActive{ false };
+            bool m_heightCacheEnabled{ false };
         };
 
         TerrainSystemSettings m_currentSettings;
@@ -119,5 +139,7 @@ namespace Terrain
 
         mutable AZStd::shared_mutex m_areaMutex;
         AZStd::map<AZ::EntityId, AZ::Aabb, TerrainLayerPriorityComparator> m_registeredAreas;
+
+        mutable TerrainHeightCache m_heightCache;
     };
 } // namespace Terrain
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/ComponentBus.h>
@@ -45,6 +46,9 @@ namespace Terrain
         virtual void RegisterArea(AZ::EntityId areaId) = 0;
         virtual void UnregisterArea(AZ::EntityId areaId) = 0;
         virtual void RefreshArea(AZ::EntityId areaId) = 0;
+
+        // cache the heights of the query grid, so that repeated queries don't need to recompute them
+        virtual void SetHeightCacheEnabled(bool enabled) = 0;
     };
 
     using TerrainSystemServiceRequestBus = AZ::EBus<TerrainSystemServiceRequests>;
@@ -67,6 +71,20 @@ namespace Terrain
 
         // Synchronous single input location.  The Vector3 input position versions are defined to ignore the input Z value.
         virtual void GetHeight(const AZ::Vector3& inPosition, AZ::Vector3& outPosition, bool& terrainExists) = 0;
+
+        // Synchronous list of input locations, which replaces the Z value of every position with the height.
+        // The terrainExists list is expected to have the same size as the list of positions.
+        virtual void GetHeights(AZStd::vector<AZ::Vector3>& inOutPositions, AZStd::vector<bool>& terrainExists)
+        {
+            for (size_t index = 0; index < inOutPositions.size(); ++index)
+            {
+                AZ::Vector3 outPosition = inOutPositions[index];
+                bool exists = false;
+                GetHeight(inOutPositions[index], outPosition, exists);
+                inOutPositions[index].SetZ(outPosition.GetZ());
+                terrainExists[index] = exists;
+            }
+        }
     };
 
     using TerrainAreaHeightRequestBus = AZ::EBus<TerrainAreaHeightRequests>;
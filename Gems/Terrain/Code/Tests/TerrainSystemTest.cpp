@@ -473,3 +473,191 @@ TEST_F(TerrainSystemTest, TerrainHeightQueriesWithBilinearSamplersUseQueryGridTo
         EXPECT_NEAR(height, expectedHeight, epsilon);
     }
 }
+
+TEST_F(TerrainSystemTest, TerrainBatchedHeightQueriesMatchSingleHeightQueries)
+{
+    // Verify that GetHeights, GetNormals, and GetHeightsFromRegion return the same results as the equivalent single position queries
+    // for every sampler, both inside and outside of the terrain layer spawner bounds.
+
+    // Create a mock terrain layer spawner that uses a box of (-10,-10,-5) - (10,10,15) and generates a height equal to X + Y,
+    // with a hole wherever X is negative.
+    const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+    auto entity = CreateAndActivateMockTerrainLayerSpawner(
+        spawnerBox,
+        [](AZ::Vector3& position, bool& terrainExists)
+        {
+            position.SetZ(position.GetX() + position.GetY());
+            terrainExists = (position.GetX() >= 0.0f);
+        });
+
+    // Create and activate the terrain system with our testing defaults for world bounds, and a query resolution at 0.25 meter intervals.
+    const AZ::Vector2 queryResolution(0.25f);
+    CreateAndActivateTerrainSystem(queryResolution);
+
+    const AZStd::vector<AZ::Vector3> testPositions = {
+        AZ::Vector3(0.0f, 0.0f, 0.0f),     AZ::Vector3(0.3f, 0.3f, 0.0f),     AZ::Vector3(3.25f, 5.25f, 0.0f),
+        AZ::Vector3(7.71f, 9.74f, 0.0f),   AZ::Vector3(-2.8f, -2.8f, 0.0f),   AZ::Vector3(-7.7f, 7.7f, 0.0f),
+        AZ::Vector3(9.9f, 9.9f, 0.0f),     AZ::Vector3(-9.9f, -9.9f, 0.0f),   AZ::Vector3(20.0f, 0.0f, 0.0f),
+        AZ::Vector3(-50.0f, 50.0f, 0.0f)
+    };
+
+    const AzFramework::Terrain::TerrainDataRequests::Sampler samplers[] = {
+        AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT,
+        AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP,
+        AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR
+    };
+
+    for (auto sampler : samplers)
+    {
+        AZStd::vector<AZ::Vector3> positions = testPositions;
+        AZStd::vector<bool> terrainExistsList;
+        m_terrainSystem->GetHeights(positions, sampler, &terrainExistsList);
+
+        AZStd::vector<AZ::Vector3> normals;
+        AZStd::vector<bool> normalTerrainExistsList;
+        m_terrainSystem->GetNormals(testPositions, normals, sampler, &normalTerrainExistsList);
+
+        ASSERT_EQ(positions.size(), testPositions.size());
+        ASSERT_EQ(terrainExistsList.size(), testPositions.size());
+        ASSERT_EQ(normals.size(), testPositions.size());
+        ASSERT_EQ(normalTerrainExistsList.size(), testPositions.size());
+
+        for (size_t index = 0; index < testPositions.size(); ++index)
+        {
+            bool terrainExists = false;
+            const float height = m_terrainSystem->GetHeight(testPositions[index], sampler, &terrainExists);
+            EXPECT_FLOAT_EQ(positions[index].GetX(), testPositions[index].GetX());
+            EXPECT_FLOAT_EQ(positions[index].GetY(), testPositions[index].GetY());
+            EXPECT_NEAR(positions[index].GetZ(), height, 0.0001f);
+            EXPECT_EQ(terrainExistsList[index], terrainExists);
+
+            const AZ::Vector3 normal = m_terrainSystem->GetNormal(testPositions[index], sampler, &terrainExists);
+            EXPECT_TRUE(normals[index].IsClose(normal));
+            EXPECT_EQ(normalTerrainExistsList[index], terrainExists);
+        }
+
+        // Verify that the region query produces the same heights as querying each grid position individually.
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(-12.0f, -12.0f, 0.0f, 12.0f, 12.0f, 0.0f);
+        const AZ::Vector2 stepSize(1.5f);
+        AZStd::vector<AZ::Vector3> regionPositions;
+        m_terrainSystem->GetHeightsFromRegion(region, stepSize, regionPositions, sampler);
+        ASSERT_EQ(regionPositions.size(), 16 * 16);
+        for (const AZ::Vector3& position : regionPositions)
+        {
+            EXPECT_NEAR(position.GetZ(), m_terrainSystem->GetHeight(position, sampler), 0.0001f);
+        }
+    }
+}
+
+TEST_F(TerrainSystemTest, TerrainHeightCacheReturnsCachedHeightsUntilAreaIsRefreshed)
+{
+    // Verify that with the height cache enabled, heights are served from the cache until the terrain area that provides them
+    // gets refreshed.
+
+    // Create a mock terrain layer spawner that uses a box of (-10,-10,-5) - (10,10,15) and generates a height equal
+    // to X + Y plus an offset that the test can change.
+    float heightOffset = 0.0f;
+    const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+    auto entity = CreateAndActivateMockTerrainLayerSpawner(
+        spawnerBox,
+        [&heightOffset](AZ::Vector3& position, bool& terrainExists)
+        {
+            position.SetZ(position.GetX() + position.GetY() + heightOffset);
+            terrainExists = true;
+        });
+
+    CreateAndActivateTerrainSystem();
+    m_terrainSystem->SetHeightCacheEnabled(true);
+    AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+
+    // Heights are quantized to 16 bits across the height range of the world bounds.
+    const AZ::Aabb worldBounds = m_terrainSystem->GetTerrainAabb();
+    const float epsilon = worldBounds.GetExtents().GetZ() / 65535.0f;
+
+    AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(1.0f, 2.0f, 0.0f), AZ::Vector3(3.5f, 4.25f, 0.0f),
+                                             AZ::Vector3(-5.0f, -6.0f, 0.0f) };
+    m_terrainSystem->GetHeights(positions, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+    EXPECT_NEAR(positions[0].GetZ(), 3.0f, epsilon);
+    EXPECT_NEAR(positions[1].GetZ(), 7.75f, epsilon);
+    EXPECT_NEAR(positions[2].GetZ(), -11.0f, epsilon);
+
+    // Changing the heights without refreshing the area should still return the cached heights.
+    heightOffset = 1.0f;
+    EXPECT_NEAR(
+        m_terrainSystem->GetHeight(AZ::Vector3(1.0f, 2.0f, 0.0f), AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 3.0f,
+        epsilon);
+
+    // Refreshing the area should drop the cached heights, so the new heights get returned.
+    m_terrainSystem->RefreshArea(entity->GetId());
+    EXPECT_NEAR(
+        m_terrainSystem->GetHeight(AZ::Vector3(1.0f, 2.0f, 0.0f), AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 4.0f,
+        epsilon);
+
+    positions = { AZ::Vector3(1.0f, 2.0f, 0.0f), AZ::Vector3(3.5f, 4.25f, 0.0f), AZ::Vector3(-5.0f, -6.0f, 0.0f) };
+    m_terrainSystem->GetHeights(positions, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+    EXPECT_NEAR(positions[0].GetZ(), 4.0f, epsilon);
+    EXPECT_NEAR(positions[1].GetZ(), 8.75f, epsilon);
+    EXPECT_NEAR(positions[2].GetZ(), -10.0f, epsilon);
+}
+
+TEST_F(TerrainSystemTest, TerrainHeightCacheEvictsLeastRecentlyUsedTilesOverBudget)
+{
+    // Verify that the height cache doesn't grow past its tile budget, and that the tiles it drops are the least recently used ones.
+    using Terrain::TerrainHeightCache;
+
+    TerrainHeightCache heightCache;
+    heightCache.Reset(AZ::Aabb::CreateFromMinMaxValues(-1000.0f, -1000.0f, 0.0f, 1000.0f, 1000.0f, 100.0f), AZ::Vector2(1.0f));
+
+    constexpr size_t MaxTiles = 8;
+    heightCache.SetMaxTiles(MaxTiles);
+
+    // Each grid point is in a tile of its own.
+    auto getTileGridPoint = [](int32_t tileIndex)
+    {
+        return TerrainHeightCache::GridPoint{ tileIndex * TerrainHeightCache::TileSize, 0 };
+    };
+    auto isCached = [&heightCache](const TerrainHeightCache::GridPoint& gridPoint)
+    {
+        float height = 0.0f;
+        TerrainHeightCache::HeightState state;
+        uint32_t generation = 0;
+        return heightCache.GetHeight(gridPoint, height, state, generation);
+    };
+
+    float height = 0.0f;
+    TerrainHeightCache::HeightState state;
+    uint32_t generation = 0;
+    EXPECT_FALSE(heightCache.GetHeight(getTileGridPoint(0), height, state, generation));
+
+    // Fill the budget, then use the first tile again so that the second and third tiles are the least recently used ones.
+    for (int32_t tileIndex = 0; tileIndex < aznumeric_cast<int32_t>(MaxTiles); ++tileIndex)
+    {
+        heightCache.SetHeight(generation, getTileGridPoint(tileIndex), 10.0f, TerrainHeightCache::HeightState::TerrainExists);
+    }
+    EXPECT_EQ(heightCache.GetNumTiles(), MaxTiles);
+    EXPECT_TRUE(isCached(getTileGridPoint(0)));
+
+    // Adding a tile over the budget evicts a quarter of the budget, starting with the least recently used tiles.
+    heightCache.SetHeight(
+        generation, getTileGridPoint(aznumeric_cast<int32_t>(MaxTiles)), 10.0f, TerrainHeightCache::HeightState::TerrainExists);
+    EXPECT_EQ(heightCache.GetNumTiles(), MaxTiles - (MaxTiles / 4) + 1);
+    EXPECT_TRUE(isCached(getTileGridPoint(0)));
+    EXPECT_FALSE(isCached(getTileGridPoint(1)));
+    EXPECT_FALSE(isCached(getTileGridPoint(2)));
+    EXPECT_TRUE(isCached(getTileGridPoint(3)));
+    EXPECT_TRUE(isCached(getTileGridPoint(aznumeric_cast<int32_t>(MaxTiles))));
+
+    // Querying far more tiles than the budget never grows the cache past it.
+    for (int32_t tileIndex = 0; tileIndex < 100; ++tileIndex)
+    {
+        heightCache.SetHeight(
+            generation, TerrainHeightCache::GridPoint{ 0, tileIndex * TerrainHeightCache::TileSize }, 10.0f,
+            TerrainHeightCache::HeightState::TerrainExists);
+        EXPECT_LE(heightCache.GetNumTiles(), MaxTiles);
+    }
+
+    // Lowering the budget drops the tiles over it right away.
+    heightCache.SetMaxTiles(2);
+    EXPECT_EQ(heightCache.GetNumTiles(), 2u);
+    EXPECT_TRUE(isCached(TerrainHeightCache::GridPoint{ 0, 99 * TerrainHeightCache::TileSize }));
+}
@@ -25,5 +25,7 @@ set(FILES
     Source/TerrainRenderer/TerrainFeatureProcessor.h
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
+    Source/TerrainSystem/TerrainHeightCache.cpp
+    Source/TerrainSystem/TerrainHeightCache.h
     Source/TerrainSystem/TerrainSystemBus.h
 )